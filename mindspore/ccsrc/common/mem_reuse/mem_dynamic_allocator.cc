@@ -16,6 +16,8 @@
 
 #include "common/mem_reuse/mem_dynamic_allocator.h"
 #include <string>
+#include <algorithm>
+#include <unordered_map>
 #include "include/common/utils/convert_utils.h"
 #include "utils/log_adapter.h"
 #include "utils/ms_context.h"
@@ -28,6 +30,17 @@ constexpr size_t kGBToByte = 1024 << 20;
 // The smallest memory request size, if it is smaller than this size, the device memory request may fail
 // Set experience value to 10M
 const size_t kMinimumAllocMem = 10 << 20;
+// The size classes of size class cache, the memory larger than the last one is allocated from the best-fit pool.
+constexpr size_t kSizeClasses[] = {512,  1024,  1536,  2048,  3072,  4096,  6144,
+                                   8192, 12288, 16384, 24576, 32768, 49152, 65536};
+constexpr size_t kSizeClassNum = sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+// The span size of size classes, which is allocated from the best-fit pool.
+constexpr size_t kSizeClassSpanSize = 1 << 20;
+// The slot number moved between the thread cache and the central free list at once.
+constexpr size_t kSizeClassBatchNum = 16;
+// The maximum slot number of each size class in the thread cache.
+constexpr size_t kThreadCacheMaxNum = 64;
+static const char kSizeClassSpanName[] = "SizeClassSpan";
 
 thread_local AllocatorDebugInfo DynamicMemAllocatorDebugInfo::debug_info_;
 
@@ -43,13 +56,246 @@ static const std::map<AllocatorType, std::string> kAllocatorTypeString = {
   {AllocatorType::kOther, "other"},
 };
 
+// The slots cached by the thread, which are returned to the central free lists when the thread exits.
+struct ThreadMemCache {
+  ~ThreadMemCache() {
+    auto mem_cache = mem_cache_.lock();
+    if (mem_cache == nullptr || generation_ != mem_cache->generation_) {
+      return;
+    }
+    for (size_t i = 0; i < kSizeClassNum; ++i) {
+      mem_cache->ReturnSlots(i, &bins_[i], bins_[i].size());
+    }
+  }
+
+  std::weak_ptr<SizeClassMemCache> mem_cache_;
+  uint64_t generation_{0};
+  std::vector<DeviceMemPtr> bins_[kSizeClassNum];
+};
+
+namespace {
+std::atomic<uint64_t> size_class_cache_id{0};
+
+struct ThreadMemCaches {
+  std::unordered_map<uint64_t, std::unique_ptr<ThreadMemCache>> caches_;
+  uint64_t last_id_{UINT64_MAX};
+  ThreadMemCache *last_cache_{nullptr};
+};
+thread_local ThreadMemCaches thread_mem_caches;
+}  // namespace
+
+SizeClassMemCache::SizeClassMemCache(DynamicMemPoolBestFit *mem_pool)
+    : mem_pool_(mem_pool),
+      id_(size_class_cache_id++),
+      central_mutexes_(kSizeClassNum),
+      central_free_lists_(kSizeClassNum) {
+  MS_EXCEPTION_IF_NULL(mem_pool_);
+  (void)span_tables_.emplace_back(std::make_unique<SpanTable>());
+  span_table_ = span_tables_.back().get();
+}
+
+size_t SizeClassMemCache::SizeClassIndex(size_t size) {
+  return static_cast<size_t>(std::lower_bound(kSizeClasses, kSizeClasses + kSizeClassNum, size) - kSizeClasses);
+}
+
+size_t SizeClassMemCache::SlotOffset(const Span *span, const DeviceMemPtr &device_addr) {
+  return static_cast<size_t>(static_cast<uint8_t *>(device_addr) - static_cast<uint8_t *>(span->device_addr_));
+}
+
+ThreadMemCache *SizeClassMemCache::LocalCache() {
+  auto &thread_caches = thread_mem_caches;
+  ThreadMemCache *cache = thread_caches.last_cache_;
+  if (thread_caches.last_id_ != id_) {
+    auto &cache_ptr = thread_caches.caches_[id_];
+    if (cache_ptr == nullptr) {
+      cache_ptr = std::make_unique<ThreadMemCache>();
+      cache_ptr->mem_cache_ = weak_from_this();
+      cache_ptr->generation_ = generation_;
+    }
+    cache = cache_ptr.get();
+    thread_caches.last_id_ = id_;
+    thread_caches.last_cache_ = cache;
+  }
+  // The cached slots are invalid after the spans are dropped.
+  uint64_t generation = generation_;
+  if (cache->generation_ != generation) {
+    for (auto &bin : cache->bins_) {
+      bin.clear();
+    }
+    cache->generation_ = generation;
+  }
+  return cache;
+}
+
+const SizeClassMemCache::Span *SizeClassMemCache::FindSpan(const DeviceMemPtr &device_addr) const {
+  const SpanTable *span_table = span_table_.load(std::memory_order_acquire);
+  auto iter = std::upper_bound(span_table->begin(), span_table->end(), device_addr,
+                               [](const DeviceMemPtr &addr, const SpanPtr &span) { return addr < span->device_addr_; });
+  if (iter == span_table->begin()) {
+    return nullptr;
+  }
+  const auto &span = *(--iter);
+  if (device_addr >= AddressOffset(span->device_addr_, span->size_)) {
+    return nullptr;
+  }
+  return span.get();
+}
+
+bool SizeClassMemCache::AddSpan(size_t class_index) {
+  // The span is allocated by the best-fit pool with its own debug info, then the slots are allocated with the debug
+  // info of callers.
+  auto debug_info = DynamicMemAllocatorDebugInfo::GetDebugInfo();
+  DynamicMemAllocatorDebugInfo::SetDebugInfo(kSizeClassSpanName, AllocatorType::kOther);
+  auto device_addr = mem_pool_->AllocTensorMemByBestFit(kSizeClassSpanSize, false);
+  DynamicMemAllocatorDebugInfo::SetDebugInfo(debug_info.name_, debug_info.type_);
+  if (device_addr == nullptr) {
+    return false;
+  }
+
+  size_t slot_size = kSizeClasses[class_index];
+  size_t slot_num = kSizeClassSpanSize / slot_size;
+  auto span = std::make_shared<Span>();
+  span->device_addr_ = device_addr;
+  span->size_ = slot_num * slot_size;
+  span->class_index_ = class_index;
+  span->slot_types_ = std::make_unique<std::atomic<int>[]>(slot_num);
+  {
+    std::lock_guard<std::mutex> locker(span_mutex_);
+    auto span_table = std::make_unique<SpanTable>(*span_table_.load(std::memory_order_relaxed));
+    auto iter = std::upper_bound(span_table->begin(), span_table->end(), device_addr,
+                                 [](const DeviceMemPtr &addr, const SpanPtr &item) { return addr < item->device_addr_; });
+    (void)span_table->insert(iter, span);
+    span_table_.store(span_table.get(), std::memory_order_release);
+    (void)span_tables_.emplace_back(std::move(span_table));
+  }
+  {
+    std::lock_guard<std::mutex> locker(central_mutexes_[class_index]);
+    auto &free_list = central_free_lists_[class_index];
+    // The slots are popped from the back, so the low address is used first.
+    for (size_t i = slot_num; i > 0; --i) {
+      free_list.emplace_back(AddressOffset(device_addr, (i - 1) * slot_size));
+    }
+  }
+  // The tail of span which is smaller than the slot is idle as well.
+  idle_size_ += kSizeClassSpanSize;
+  ++span_num_;
+  return true;
+}
+
+bool SizeClassMemCache::FetchSlots(size_t class_index, std::vector<DeviceMemPtr> *bin) {
+  MS_EXCEPTION_IF_NULL(bin);
+  std::lock_guard<std::mutex> locker(central_mutexes_[class_index]);
+  auto &free_list = central_free_lists_[class_index];
+  size_t num = std::min(free_list.size(), kSizeClassBatchNum);
+  (void)bin->insert(bin->end(), free_list.end() - SizeToLong(num), free_list.end());
+  free_list.resize(free_list.size() - num);
+  return num > 0;
+}
+
+void SizeClassMemCache::ReturnSlots(size_t class_index, std::vector<DeviceMemPtr> *bin, size_t num) {
+  MS_EXCEPTION_IF_NULL(bin);
+  num = std::min(num, bin->size());
+  std::lock_guard<std::mutex> locker(central_mutexes_[class_index]);
+  auto &free_list = central_free_lists_[class_index];
+  (void)free_list.insert(free_list.end(), bin->end() - SizeToLong(num), bin->end());
+  bin->resize(bin->size() - num);
+}
+
+DeviceMemPtr SizeClassMemCache::Alloc(size_t size) {
+  size_t class_index = SizeClassIndex(size);
+  if (class_index >= kSizeClassNum) {
+    return nullptr;
+  }
+  auto &bin = LocalCache()->bins_[class_index];
+  if (bin.empty() && !FetchSlots(class_index, &bin)) {
+    if (!AddSpan(class_index) || !FetchSlots(class_index, &bin)) {
+      return nullptr;
+    }
+  }
+  auto device_addr = bin.back();
+  bin.pop_back();
+
+  auto span = FindSpan(device_addr);
+  MS_EXCEPTION_IF_NULL(span);
+  size_t slot_size = kSizeClasses[class_index];
+  auto type = static_cast<int>(DynamicMemAllocatorDebugInfo::GetDebugInfo().type_);
+  MS_EXCEPTION_IF_CHECK_FAIL((type < ALLOCATOR_TYPE_NUM), "Allocator type is out of range.");
+  span->slot_types_[SlotOffset(span, device_addr) / slot_size].store(type, std::memory_order_relaxed);
+  idle_size_ -= slot_size;
+  used_size_[type] += slot_size;
+  return device_addr;
+}
+
+bool SizeClassMemCache::Free(const DeviceMemPtr &device_addr) {
+  auto span = FindSpan(device_addr);
+  if (span == nullptr) {
+    return false;
+  }
+  size_t class_index = span->class_index_;
+  size_t slot_size = kSizeClasses[class_index];
+  size_t offset = SlotOffset(span, device_addr);
+  if (offset % slot_size != 0) {
+    MS_LOG(EXCEPTION) << "The device address[" << device_addr << "] is not the slot address of size class["
+                      << slot_size << "].";
+  }
+  auto type = span->slot_types_[offset / slot_size].load(std::memory_order_relaxed);
+  used_size_[type] -= slot_size;
+  idle_size_ += slot_size;
+
+  auto &bin = LocalCache()->bins_[class_index];
+  bin.emplace_back(device_addr);
+  if (bin.size() > kThreadCacheMaxNum) {
+    ReturnSlots(class_index, &bin, kSizeClassBatchNum);
+  }
+  return true;
+}
+
+void SizeClassMemCache::Clear() {
+  // The slots in the thread caches are dropped lazily by the generation.
+  ++generation_;
+  for (size_t i = 0; i < kSizeClassNum; ++i) {
+    std::lock_guard<std::mutex> locker(central_mutexes_[i]);
+    central_free_lists_[i].clear();
+  }
+  {
+    std::lock_guard<std::mutex> locker(span_mutex_);
+    (void)span_tables_.emplace_back(std::make_unique<SpanTable>());
+    span_table_.store(span_tables_.back().get(), std::memory_order_release);
+  }
+  idle_size_ = 0;
+  for (auto &used_size : used_size_) {
+    used_size = 0;
+  }
+  span_num_ = 0;
+}
+
 DynamicMemPoolBestFit::~DynamicMemPoolBestFit() {
+  size_class_cache_ = nullptr;
   persistent_mem_->clear();
   common_mem_->clear();
 }
 
+void DynamicMemPoolBestFit::EnableSizeClassCache() {
+  if (size_class_cache_ == nullptr) {
+    size_class_cache_ = std::make_shared<SizeClassMemCache>(this);
+  }
+}
+
 DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem) {
   size_t align_size = AlignMemorySize(size);
+  if (size_class_cache_ != nullptr && !from_persistent_mem) {
+    auto device_addr = size_class_cache_->Alloc(align_size);
+    if (device_addr != nullptr) {
+      MS_LOG(DEBUG) << "Alloc memory from size class cache, name:"
+                    << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_ << ", address:" << device_addr
+                    << ", size:" << size << "B.";
+      return device_addr;
+    }
+  }
+  return AllocTensorMemByBestFit(align_size, from_persistent_mem);
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemByBestFit(size_t align_size, bool from_persistent_mem) {
   std::lock_guard<std::mutex> locker(mutex_);
   // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
   DeviceMemPtr device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
@@ -64,7 +310,8 @@ DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persis
   }
 
   MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
-                << ", address:" << device_addr << ", size:" << size << "B, total allocated mem:" << TotalMemStatistics()
+                << ", address:" << device_addr << ", size:" << align_size
+                << "B, total allocated mem:" << TotalMemStatistics()
                 << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
                 << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
   return device_addr;
@@ -73,8 +320,8 @@ DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persis
 std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const std::vector<size_t> &size_list) {
   std::vector<DeviceMemPtr> device_addr_list;
   size_t total_size = std::accumulate(size_list.begin(), size_list.end(), IntToSize(0));
-  // Pre-alloc the one whole piece memory.
-  auto device_addr = AllocTensorMem(total_size, false);
+  // Pre-alloc the one whole piece memory, which must be a memory buf of the best-fit pool to be split.
+  auto device_addr = AllocTensorMemByBestFit(AlignMemorySize(total_size), false);
   if (!device_addr) {
     return device_addr_list;
   }
@@ -317,6 +564,9 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
   MS_EXCEPTION_IF_NULL(device_addr);
+  if (size_class_cache_ != nullptr && size_class_cache_->Free(device_addr)) {
+    return;
+  }
   std::lock_guard<std::mutex> locker(mutex_);
   auto fn = [this](const MemStatusManagerPtr &mem_mng, const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
     auto mem_block = FindMemBlock(device_addr, mem_mng);
@@ -423,6 +673,10 @@ void DynamicMemPoolBestFit::EraseIdleMemBuf(size_t size, const DeviceMemPtr &dev
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
   std::lock_guard<std::mutex> locker(mutex_);
   DumpDynamicMemPoolStateInfo();
+  // The spans of size class cache are in the memory blocks to be released.
+  if (size_class_cache_ != nullptr) {
+    size_class_cache_->Clear();
+  }
 
   auto fn = [this](const MemStatusManagerPtr &mem_mng) {
     MS_EXCEPTION_IF_NULL(mem_mng);
@@ -459,6 +713,10 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
            mb != mem_mng->mem_block_list_[i]->block_all_mem_buf_map_.end(); ++mb) {
         if (mb->second->status_ == DynamicMemBufStatus::kMemBufUsed) {
           mem_block_used_size += mb->second->size_;
+          // The used size of the span is counted by the slots in size class cache.
+          if (mb->second->allocator_name_ == kSizeClassSpanName) {
+            continue;
+          }
           MS_EXCEPTION_IF_CHECK_FAIL((static_cast<int>(mb->second->allocator_type_) < ALLOCATOR_TYPE_NUM),
                                      "Allocator type is out of range.");
           total_used_size_list[static_cast<int>(mb->second->allocator_type_)] += mb->second->size_;
@@ -479,6 +737,13 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
 
   fn(common_mem_, std::string(kCommonMem));
   fn(persistent_mem_, std::string(kPersistentParamMem));
+  if (size_class_cache_ != nullptr) {
+    for (int i = 0; i < ALLOCATOR_TYPE_NUM; ++i) {
+      total_used_size_list[i] += size_class_cache_->UsedSize(static_cast<AllocatorType>(i));
+    }
+    MS_LOG(INFO) << "Size class cache info: span counts:" << size_class_cache_->SpanNum()
+                 << ", idle mem:" << size_class_cache_->IdleSize() / kMBToByte << "M.";
+  }
   MS_LOG(INFO) << "The dynamic memory pool total allocated mem:" << TotalMemStatistics() / kMBToByte
                << "M, peak used mem:" << UsedMemPeakStatistics() / kMBToByte
                << "M, in used mem:" << TotalUsedMemStatistics() / kMBToByte
@@ -544,6 +809,11 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
   MS_LOG(WARNING) << "Start dump dynamic memory pool debug info.";
   fn(common_mem_, std::string(kCommonMem));
   fn(persistent_mem_, std::string(kPersistentParamMem));
+  if (size_class_cache_ != nullptr) {
+    MS_LOG(WARNING) << "Size class cache info: span counts[" << size_class_cache_->SpanNum() << "] idle memory["
+                    << size_class_cache_->IdleSize() << "], the spans are the memory bufs named "
+                    << kSizeClassSpanName << ".";
+  }
   MS_LOG(WARNING) << "Finish dump dynamic memory pool debug info.";
 }
 }  // namespace device
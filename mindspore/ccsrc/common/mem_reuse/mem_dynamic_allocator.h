@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_DYNAMIC_ALLOCATOR_H_
 #define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_MEM_REUSE_MEM_DYNAMIC_ALLOCATOR_H_
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <vector>
@@ -144,6 +145,77 @@ struct MemStatusManager {
 };
 using MemStatusManagerPtr = std::shared_ptr<MemStatusManager>;
 
+class DynamicMemPoolBestFit;
+struct ThreadMemCache;
+
+// The front end of dynamic memory pool for the small memory, which is segregated by the size classes. The spans of a
+// size class are allocated from the best-fit pool and carved into the slots of same size, and the freed slots are
+// cached by the thread, so that most of the memory alloc and free only touch the cache of current thread without lock.
+// The slots are moved between the thread caches and the central free lists of size classes in batches.
+class SizeClassMemCache : public std::enable_shared_from_this<SizeClassMemCache> {
+ public:
+  explicit SizeClassMemCache(DynamicMemPoolBestFit *mem_pool);
+  ~SizeClassMemCache() = default;
+
+  // Alloc the slot by the aligned size, return nullptr if the size is larger than all the size classes or the memory
+  // of new span is not enough.
+  DeviceMemPtr Alloc(size_t size);
+  // Free the slot, return false if the device address is not in any span.
+  bool Free(const DeviceMemPtr &device_addr);
+  // Drop all the spans and the cached slots, the memory of spans is released by the best-fit pool.
+  void Clear();
+
+  // The statistics information, the idle size is the memory of slots which are not in use.
+  size_t IdleSize() const { return idle_size_; }
+  size_t UsedSize(AllocatorType type) const { return used_size_[static_cast<int>(type)]; }
+  size_t SpanNum() const { return span_num_; }
+
+  // Get the index of size class which the aligned size fits in, and the size class number if it fits in nothing.
+  static size_t SizeClassIndex(size_t size);
+
+ private:
+  friend struct ThreadMemCache;
+
+  // The span is a piece of memory from the best-fit pool, whose slots belong to one size class.
+  struct Span {
+    DeviceMemPtr device_addr_{nullptr};
+    size_t size_{0};
+    size_t class_index_{0};
+    // The allocator type of each slot for the statistics information.
+    std::unique_ptr<std::atomic<int>[]> slot_types_;
+  };
+  using SpanPtr = std::shared_ptr<Span>;
+  // The spans sorted by device address, which is replaced as a whole when a span is added, so the span lookup of
+  // memory free is lock-free.
+  using SpanTable = std::vector<SpanPtr>;
+
+  ThreadMemCache *LocalCache();
+  const Span *FindSpan(const DeviceMemPtr &device_addr) const;
+  static size_t SlotOffset(const Span *span, const DeviceMemPtr &device_addr);
+  bool AddSpan(size_t class_index);
+  // Move the slots between the central free list and the bin of thread cache.
+  bool FetchSlots(size_t class_index, std::vector<DeviceMemPtr> *bin);
+  void ReturnSlots(size_t class_index, std::vector<DeviceMemPtr> *bin, size_t num);
+
+  DynamicMemPoolBestFit *mem_pool_;
+  // Identify the cache in the thread caches, and the cached slots are dropped when the generation is changed by Clear.
+  uint64_t id_;
+  std::atomic<uint64_t> generation_{0};
+
+  std::vector<std::mutex> central_mutexes_;
+  std::vector<std::vector<DeviceMemPtr>> central_free_lists_;
+
+  std::mutex span_mutex_;
+  std::atomic<const SpanTable *> span_table_{nullptr};
+  // All the versions of span table, the old ones may still be read by other threads.
+  std::vector<std::unique_ptr<SpanTable>> span_tables_;
+
+  std::atomic<size_t> idle_size_{0};
+  std::atomic<size_t> used_size_[ALLOCATOR_TYPE_NUM]{};
+  std::atomic<size_t> span_num_{0};
+};
+using SizeClassMemCachePtr = std::shared_ptr<SizeClassMemCache>;
+
 // The main class of dynamic memory pool.
 class DynamicMemPoolBestFit {
  public:
@@ -171,7 +243,9 @@ class DynamicMemPoolBestFit {
     return common_mem_->mps_.total_mem_size_ + persistent_mem_->mps_.total_mem_size_;
   }
   size_t TotalUsedMemStatistics() const {
-    return common_mem_->mps_.total_used_mem_size_ + persistent_mem_->mps_.total_used_mem_size_;
+    // The idle slots of size class cache are in use for the best-fit pool.
+    size_t idle_size = (size_class_cache_ == nullptr) ? 0 : size_class_cache_->IdleSize();
+    return common_mem_->mps_.total_used_mem_size_ + persistent_mem_->mps_.total_used_mem_size_ - idle_size;
   }
   size_t UsedMemPeakStatistics() const {
     return common_mem_->mps_.used_mem_peak_size_ + persistent_mem_->mps_.used_mem_peak_size_;
@@ -196,8 +270,14 @@ class DynamicMemPoolBestFit {
   virtual size_t AlignMemorySize(size_t size) const;
   // Calculate memory block required alloc size when adding the memory block.
   virtual size_t CalMemBlockAllocSize(size_t size, bool from_persistent_mem);
+  // Put the size class cache in front of the best-fit pool for the small memory, which is not from persistent mem.
+  void EnableSizeClassCache();
 
  private:
+  friend class SizeClassMemCache;
+
+  // Alloc the memory by the aligned size from the best-fit pool.
+  DeviceMemPtr AllocTensorMemByBestFit(size_t size, bool from_persistent_mem);
   // Find the idle memory buf by aligned size when memory alloc.
   DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem);
   // Add the memory block and memory buf when memory alloc not find the idle memory buf.
@@ -223,6 +303,7 @@ class DynamicMemPoolBestFit {
   // In the graph mode, the unit size set in the context will be modified through the FetchMemUnitSize function, so it
   // needs to be changed back after that
   size_t config_unit_size_{DYNAMIC_MEM_ALLOC_UNIT_SIZE};
+  SizeClassMemCachePtr size_class_cache_{nullptr};
 };
 }  // namespace device
 }  // namespace mindspore
@@ -665,6 +665,7 @@ constexpr auto kFlagIsDynamicStructure = "is_dynamic_structure";
 constexpr auto kFlagIsPynativeBpropGraph = "is_pynative_bprop_graph";
 constexpr auto kFlagPyNativeRunInGraph = "pynative_run_in_graph";
 constexpr auto kFlagNeedRenormalize = "need_renormalize";
+constexpr auto kFlagLinearPlan = "linear_plan";
 
 // TODO(dsj): for ms_function running in graph_mode. should be delete later
 constexpr auto kAttrMSFunction = "ms_function_graph";
@@ -688,6 +689,10 @@ constexpr auto kTensorValueIsType = "tensor_value_is_type";
 
 // env key
 constexpr auto kGraphOpRun = "GRAPH_OP_RUN";
+// Launch the static graph on CPU by the linear plan of super kernel actor, and "parallel" launches the independent
+// kernels of graph in parallel additionally. It only takes effect with the memory_optimize_level O1.
+constexpr auto kCPULinearPlan = "MS_CPU_LINEAR_PLAN";
+constexpr auto kCPULinearPlanParallel = "parallel";
 
 // some size
 const size_t kShape4dDims = 4;
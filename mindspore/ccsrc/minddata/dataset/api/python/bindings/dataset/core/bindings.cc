@@ -75,6 +75,24 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_multiprocessing_timeout_interval", &ConfigManager::multiprocessing_timeout_interval)
                     .def("set_dynamic_shape", &ConfigManager::set_dynamic_shape)
                     .def("get_dynamic_shape", &ConfigManager::dynamic_shape)
+                    .def("set_enable_mindrecord_mmap", &ConfigManager::set_enable_mindrecord_mmap)
+                    .def("get_enable_mindrecord_mmap", &ConfigManager::enable_mindrecord_mmap)
+                    .def("set_enable_lock_free_queue", &ConfigManager::set_enable_lock_free_queue)
+                    .def("get_enable_lock_free_queue", &ConfigManager::enable_lock_free_queue)
+                    .def("set_enable_jpeg_scaled_decode", &ConfigManager::set_enable_jpeg_scaled_decode)
+                    .def("get_enable_jpeg_scaled_decode", &ConfigManager::enable_jpeg_scaled_decode)
+                    .def("set_enable_autotune_cost_model", &ConfigManager::set_enable_autotune_cost_model)
+                    .def("get_enable_autotune_cost_model", &ConfigManager::enable_autotune_cost_model)
+                    .def("set_enable_seekable_shuffle", &ConfigManager::set_enable_seekable_shuffle)
+                    .def("get_enable_seekable_shuffle", &ConfigManager::enable_seekable_shuffle)
+                    .def("set_enable_row_tracing", &ConfigManager::set_enable_row_tracing)
+                    .def("get_enable_row_tracing", &ConfigManager::enable_row_tracing)
+                    .def("set_enable_row_block", &ConfigManager::set_enable_row_block)
+                    .def("get_enable_row_block", &ConfigManager::enable_row_block)
+                    .def("set_enable_csv_split", &ConfigManager::set_enable_csv_split)
+                    .def("get_enable_csv_split", &ConfigManager::enable_csv_split)
+                    .def("set_source_snapshot_dir", &ConfigManager::set_source_snapshot_dir)
+                    .def("get_source_snapshot_dir", &ConfigManager::source_snapshot_dir)
                     .def("load", [](ConfigManager &c, const std::string &s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -1315,7 +1315,6 @@ Status Stft(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
             float power, bool onesided) {
   CHECK_FAIL_RETURN_UNEXPECTED(win_length != 0, "Spectrogram: win_length can not be zero.");
   double win_sum = 0.;
-  float twice = 2.0;
   for (auto iter_win = win->begin<float>(); iter_win != win->end<float>(); iter_win++) {
     win_sum += (*iter_win) * (*iter_win);
   }
@@ -1326,44 +1325,24 @@ Status Stft(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
     Tensor::CreateEmpty(TensorShape({input->shape()[0], n_fft / 2 + 1, n_columns, 2}), input->type(), &spec_f));
 
   auto spec_f_begin = spec_f->begin<T>();
-  auto input_win_begin = input->begin<T>();
   std::vector<int> spec_f_slice = {(n_fft / 2 + 1) * n_columns * 2, n_columns * 2, 2};
-  std::vector<int> input_win_slice = {n_columns * win_length, win_length};
   std::shared_ptr<Tensor> spec_p;
   RETURN_IF_NOT_OK(
     Tensor::CreateEmpty(TensorShape({input->shape()[0], n_fft / 2 + 1, n_columns}), input->type(), &spec_p));
-  std::shared_ptr<Tensor> exp_complex;
-  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({n_fft / 2 + 1, win_length, 2}), input->type(), &exp_complex));
-  auto exp_complex_begin = exp_complex->begin<T>();
-  std::vector<int> exp_complex_slice = {win_length * 2, 2};
-  for (int i = 0; i < (n_fft / TWO + 1); i++) {
-    for (int k = 0; k <= win_length - 1; k++) {
-      ptrdiff_t exp_complex_offset_0 = i * exp_complex_slice[0] + k * exp_complex_slice[1];
-      ptrdiff_t exp_complex_offset_1 = exp_complex_offset_0 + 1;
-      *(exp_complex_begin + exp_complex_offset_0) = std::cos(twice * PI * i * k / win_length);
-      *(exp_complex_begin + exp_complex_offset_1) = std::sin(twice * PI * i * k / win_length);
-    }
-  }
+  // the fft plan of win_length is built once and reused by all frames of all channels
+  Eigen::FFT<T> fft;
+  fft.SetFlag(Eigen::FFT<T>::HalfSpectrum);
+  std::vector<std::complex<T>> spectrum(std::max(win_length, n_fft / TWO + 1));
+  const T *input_win_data = &(*input->begin<T>());
   for (int r = 0; r < input->shape()[0]; r++) {
-    for (int i = 0; i < (n_fft / TWO + 1); i++) {
-      for (int j = 0; j < n_columns; j++) {
-        T spec_f_0 = 0.;
-        T spec_f_1 = 0.;
-        ptrdiff_t exp_complex_offset_0 = i * exp_complex_slice[0];
-        for (int k = 0; k < win_length; k++) {
-          ptrdiff_t exp_complex_offset_1 = exp_complex_offset_0 + 1;
-          T exp_complex_a = *(exp_complex_begin + exp_complex_offset_0);
-          T exp_complex_b = *(exp_complex_begin + exp_complex_offset_1);
-          ptrdiff_t input_win_offset = r * input_win_slice[0] + j * input_win_slice[1] + k;
-          T input_value = *(input_win_begin + input_win_offset);
-          spec_f_0 += input_value * exp_complex_a;
-          spec_f_1 += -input_value * exp_complex_b;
-          exp_complex_offset_0 = exp_complex_offset_1 + 1;
-        }
+    for (int j = 0; j < n_columns; j++) {
+      fft.fwd(spectrum.data(), input_win_data + (static_cast<ptrdiff_t>(r) * n_columns + j) * win_length,
+              win_length);
+      for (int i = 0; i < (n_fft / TWO + 1); i++) {
         ptrdiff_t spec_f_offset_0 = r * spec_f_slice[0] + i * spec_f_slice[1] + j * spec_f_slice[2];
         ptrdiff_t spec_f_offset_1 = spec_f_offset_0 + 1;
-        *(spec_f_begin + spec_f_offset_0) = spec_f_0;
-        *(spec_f_begin + spec_f_offset_1) = spec_f_1;
+        *(spec_f_begin + spec_f_offset_0) = spectrum[i].real();
+        *(spec_f_begin + spec_f_offset_1) = spectrum[i].imag();
       }
     }
   }
@@ -1403,20 +1382,9 @@ Status Stft(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   return Status::OK();
 }
 
-template <typename T>
-Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int pad,
-                       WindowType window, int n_fft, int hop_length, int win_length, float power, bool normalized,
-                       bool center, BorderType pad_mode, bool onesided) {
+Status CreateSpectrogramWindow(std::shared_ptr<Tensor> *output, WindowType window, int n_fft, int win_length) {
+  RETURN_UNEXPECTED_IF_NULL(output);
   std::shared_ptr<Tensor> fft_window_tensor;
-  std::shared_ptr<Tensor> fft_window_later;
-  TensorShape shape = input->shape();
-  std::vector output_shape = shape.AsVector();
-  output_shape.pop_back();
-  int input_len = input->shape()[-1];
-
-  RETURN_IF_NOT_OK(input->Reshape(TensorShape({input->Size() / input_len, input_len})));
-
-  DataType data_type = input->type();
   // get the windows
   RETURN_IF_NOT_OK(Window(&fft_window_tensor, window, win_length));
   if (win_length == 1) {
@@ -1429,8 +1397,28 @@ Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Ten
   int pad_left = (n_fft - win_length) / 2;
   int pad_right = n_fft - win_length - pad_left;
   RETURN_IF_NOT_OK(fft_window_tensor->Reshape(TensorShape({1, win_length})));
-  RETURN_IF_NOT_OK(Pad<float>(fft_window_tensor, &fft_window_later, pad_left, pad_right, BorderType::kConstant));
-  RETURN_IF_NOT_OK(fft_window_later->Reshape(TensorShape({n_fft})));
+  RETURN_IF_NOT_OK(Pad<float>(fft_window_tensor, output, pad_left, pad_right, BorderType::kConstant));
+  RETURN_IF_NOT_OK((*output)->Reshape(TensorShape({n_fft})));
+  return Status::OK();
+}
+
+template <typename T>
+Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int pad,
+                       WindowType window, int n_fft, int hop_length, int win_length, float power, bool normalized,
+                       bool center, BorderType pad_mode, bool onesided,
+                       const std::shared_ptr<Tensor> &fft_window = nullptr) {
+  std::shared_ptr<Tensor> fft_window_later = fft_window;
+  TensorShape shape = input->shape();
+  std::vector output_shape = shape.AsVector();
+  output_shape.pop_back();
+  int input_len = input->shape()[-1];
+
+  RETURN_IF_NOT_OK(input->Reshape(TensorShape({input->Size() / input_len, input_len})));
+
+  DataType data_type = input->type();
+  if (fft_window_later == nullptr) {
+    RETURN_IF_NOT_OK(CreateSpectrogramWindow(&fft_window_later, window, n_fft, win_length));
+  }
 
   int length = input_len + pad * 2 + n_fft;
 
@@ -1498,7 +1486,7 @@ Status SpectrogramImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Ten
 
 Status Spectrogram(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int pad, WindowType window,
                    int n_fft, int hop_length, int win_length, float power, bool normalized, bool center,
-                   BorderType pad_mode, bool onesided) {
+                   BorderType pad_mode, bool onesided, const std::shared_ptr<Tensor> &fft_window) {
   TensorShape input_shape = input->shape();
 
   CHECK_FAIL_RETURN_UNEXPECTED(
@@ -1511,11 +1499,11 @@ Status Spectrogram(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor>
   if (input->type() != DataType::DE_FLOAT64) {
     RETURN_IF_NOT_OK(TypeCast(input, &input_tensor, DataType(DataType::DE_FLOAT32)));
     return SpectrogramImpl<float>(input_tensor, output, pad, window, n_fft, hop_length, win_length, power, normalized,
-                                  center, pad_mode, onesided);
+                                  center, pad_mode, onesided, fft_window);
   } else {
     input_tensor = input;
     return SpectrogramImpl<double>(input_tensor, output, pad, window, n_fft, hop_length, win_length, power, normalized,
-                                   center, pad_mode, onesided);
+                                   center, pad_mode, onesided, fft_window);
   }
 }
 
@@ -1803,6 +1791,9 @@ Status GriffinLimImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tens
     auto win = fft_window_tensor->begin<float>();
     *(win) = 1;
   }
+  // the window of stft is shared by all iterations
+  std::shared_ptr<Tensor> stft_window;
+  RETURN_IF_NOT_OK(CreateSpectrogramWindow(&stft_window, window_type, n_fft, win_length));
   std::shared_ptr<Tensor> final_results;
   for (int dim = 0; dim < new_shape[0]; dim++) {
     // init complex phase
@@ -1842,7 +1833,7 @@ Status GriffinLimImpl(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tens
       // stft
       std::shared_ptr<Tensor> stft_out;
       RETURN_IF_NOT_OK(SpectrogramImpl<T>(inverse, &stft_out, 0, window_type, n_fft, hop_length, win_length, 0, false,
-                                          true, BorderType::kReflect, true));
+                                          true, BorderType::kReflect, true, stft_window));
 
       rebuilt.transposeInPlace();
       Tensor::TensorIterator<T> itr = stft_out->begin<T>();
@@ -2099,17 +2090,15 @@ Status ResampleSingle(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tens
   std::shared_ptr<Tensor> multi_input;
   int32_t resample_num = static_cast<int32_t>(ceil(static_cast<float>(target_length) / kernel_x));
   RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({resample_num, kernel_y}), input->type(), &multi_input));
+  auto multi_input_ptr = &*multi_input->begin<T>();
+  std::fill(multi_input_ptr, multi_input_ptr + multi_input->Size(), static_cast<T>(0));
+  const T *input_ptr = &*input->begin<T>();
   int x_dim = 0;
-  // Slice the waveform with stride orig_freq and length kernel_y
+  // Copy the frames of the waveform with stride orig_freq and length kernel_y
   for (int i = 0; i + kernel_y < pad_length && x_dim < resample_num; i += orig_freq) {
-    std::vector<dsize_t> slice_idx(kernel_y);
-    std::iota(slice_idx.begin(), slice_idx.end(), i);
-    std::shared_ptr<Tensor> input_slice;
-    RETURN_IF_NOT_OK(input->Slice(&input_slice, std::vector<SliceOption>({SliceOption(slice_idx)})));
-    RETURN_IF_NOT_OK(multi_input->InsertTensor({x_dim}, input_slice));
+    std::copy(input_ptr + i, input_ptr + i + kernel_y, multi_input_ptr + static_cast<ptrdiff_t>(x_dim) * kernel_y);
     ++x_dim;
   }
-  auto multi_input_ptr = &*multi_input->begin<T>();
   auto kernel_ptr = &*kernel->begin<T>();
   Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> multi_input_matrix(multi_input_ptr, kernel_y,
                                                                                   resample_num);
@@ -234,6 +234,68 @@ Status Gain(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
   return Status::OK();
 }
 
+constexpr size_t kLFilterLanes = 8;   // channels which are filtered together, one simd lane per channel
+constexpr size_t kLFilterTile = 256;  // samples of each channel which are transposed into the lanes at a time
+
+/// \brief Evaluate the difference equation on up to kLFilterLanes channels at once.
+/// \param input/output: Channels of n_time samples.
+/// \param a_coeffs/b_coeffs: Coefficients normalized by a0, both of size (n_order + 1).
+template <typename T>
+void LFilterChannels(const T *input, T *output, size_t n_lanes, size_t n_time, const std::vector<T> &a_coeffs,
+                     const std::vector<T> &b_coeffs, bool clamp) {
+  const size_t order = a_coeffs.size() - 1;
+  // x_hist[j * kLFilterLanes + l] is x[n - j] of lane l, y_hist likewise
+  std::vector<T> x_hist((order + 1) * kLFilterLanes, static_cast<T>(0));
+  std::vector<T> y_hist((order + 1) * kLFilterLanes, static_cast<T>(0));
+  std::vector<T> x_tile(kLFilterTile * kLFilterLanes, static_cast<T>(0));
+  std::vector<T> y_tile(kLFilterTile * kLFilterLanes, static_cast<T>(0));
+  for (size_t t0 = 0; t0 < n_time; t0 += kLFilterTile) {
+    size_t len = std::min(kLFilterTile, n_time - t0);
+    for (size_t l = 0; l < n_lanes; l++) {
+      for (size_t t = 0; t < len; t++) {
+        x_tile[t * kLFilterLanes + l] = input[l * n_time + t0 + t];
+      }
+    }
+    for (size_t t = 0; t < len; t++) {
+      for (size_t j = order; j > 0; j--) {
+        for (size_t l = 0; l < kLFilterLanes; l++) {
+          x_hist[j * kLFilterLanes + l] = x_hist[(j - 1) * kLFilterLanes + l];
+          y_hist[j * kLFilterLanes + l] = y_hist[(j - 1) * kLFilterLanes + l];
+        }
+      }
+      T acc[kLFilterLanes];
+      for (size_t l = 0; l < kLFilterLanes; l++) {
+        x_hist[l] = x_tile[t * kLFilterLanes + l];
+        acc[l] = static_cast<T>(0);
+      }
+      for (size_t j = 0; j <= order; j++) {
+        for (size_t l = 0; l < kLFilterLanes; l++) {
+          acc[l] += b_coeffs[j] * x_hist[j * kLFilterLanes + l];
+        }
+      }
+      for (size_t j = 1; j <= order; j++) {
+        for (size_t l = 0; l < kLFilterLanes; l++) {
+          acc[l] -= a_coeffs[j] * y_hist[j * kLFilterLanes + l];
+        }
+      }
+      for (size_t l = 0; l < kLFilterLanes; l++) {
+        y_hist[l] = acc[l];
+        T value = acc[l];
+        if (clamp) {
+          value = value > static_cast<T>(1) ? static_cast<T>(1) : value;
+          value = value < static_cast<T>(-1) ? static_cast<T>(-1) : value;
+        }
+        y_tile[t * kLFilterLanes + l] = value;
+      }
+    }
+    for (size_t l = 0; l < n_lanes; l++) {
+      for (size_t t = 0; t < len; t++) {
+        output[l * n_time + t0 + t] = y_tile[t * kLFilterLanes + l];
+      }
+    }
+  }
+}
+
 /// \brief Perform an IIR filter by evaluating difference equation.
 /// \param input/output: Tensor of shape <..., time>
 /// \param a_coeffs: denominator coefficients of difference equation of dimension of (n_order + 1).
@@ -243,19 +305,8 @@ Status Gain(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *outpu
 template <typename T>
 Status LFilter(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<T> a_coeffs,
                std::vector<T> b_coeffs, bool clamp) {
-  //  pack batch
-  TensorShape input_shape = input->shape();
-  TensorShape toShape({input->Size() / input_shape[-1], input_shape[-1]});
-  input->Reshape(toShape);
-  auto shape_0 = static_cast<size_t>(input->shape()[0]);
-  auto shape_1 = static_cast<size_t>(input->shape()[1]);
-  std::vector<T> signal;
-  std::shared_ptr<Tensor> out;
-  std::vector<T> out_vect(shape_0 * shape_1);
-  size_t x_idx = 0;
-  size_t channel_idx = 1;
-  size_t m_num_order = b_coeffs.size() - 1;
-  size_t m_den_order = a_coeffs.size() - 1;
+  CHECK_FAIL_RETURN_UNEXPECTED(!a_coeffs.empty() && !b_coeffs.empty(),
+                               "Invalid data, 'a_coeffs' and 'b_coeffs' should not be empty.");
   CHECK_FAIL_RETURN_UNEXPECTED(a_coeffs[0] != static_cast<T>(0),
                                "Invalid data, the first value of 'a_coeffs' should not be 0, but got 0.");
   // init A_coeffs and B_coeffs by div(a0)
@@ -265,63 +316,27 @@ Status LFilter(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *ou
   for (size_t i = 0; i < b_coeffs.size(); i++) {
     b_coeffs[i] /= a_coeffs[0];
   }
-  // Sliding window
-  T *m_px = new T[m_num_order + 1];
-  T *m_py = new T[m_den_order + 1];
+  size_t n_coeffs = std::max(a_coeffs.size(), b_coeffs.size());
+  a_coeffs.resize(n_coeffs, static_cast<T>(0));
+  b_coeffs.resize(n_coeffs, static_cast<T>(0));
 
-  // Tensor -> vector
-  for (auto itr = input->begin<T>(); itr != input->end<T>();) {
-    while (x_idx < shape_1 * channel_idx) {
-      signal.push_back(*itr);
-      itr++;
-      x_idx++;
-    }
-    // Sliding window
-    for (size_t j = 0; j < m_den_order; j++) {
-      m_px[j] = static_cast<T>(0);
-    }
-    for (size_t j = 0; j <= m_den_order; j++) {
-      m_py[j] = static_cast<T>(0);
-    }
-    // Each channel is processed with the sliding window
-    for (size_t i = x_idx - shape_1; i < x_idx; i++) {
-      m_px[m_num_order] = signal[i];
-      for (size_t j = 0; j < m_num_order + 1; j++) {
-        m_py[m_num_order] += b_coeffs[j] * m_px[m_num_order - j];
-      }
-      for (size_t j = 1; j < m_den_order + 1; j++) {
-        m_py[m_num_order] -= a_coeffs[j] * m_py[m_num_order - j];
-      }
-      if (clamp) {
-        if (m_py[m_num_order] > static_cast<T>(1))
-          out_vect[i] = static_cast<T>(1);
-        else if (m_py[m_num_order] < static_cast<T>(-1))
-          out_vect[i] = static_cast<T>(-1);
-        else
-          out_vect[i] = m_py[m_num_order];
-      } else {
-        out_vect[i] = m_py[m_num_order];
-      }
-      if (i + 1 == x_idx) {
-        continue;
-      }
-      for (size_t j = 0; j < m_num_order; j++) {
-        m_px[j] = m_px[j + 1];
-      }
-      for (size_t j = 0; j < m_num_order; j++) {
-        m_py[j] = m_py[j + 1];
-      }
-      m_py[m_num_order] = static_cast<T>(0);
-    }
-    if (x_idx % shape_1 == 0) {
-      ++channel_idx;
-    }
+  // pack batch, a batch of padded waveforms is filtered like more channels
+  TensorShape input_shape = input->shape();
+  std::shared_ptr<Tensor> out;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(input_shape, input->type(), &out));
+  auto n_time = static_cast<size_t>(input_shape[-1]);
+  if (n_time == 0 || input->Size() == 0) {
+    *output = out;
+    return Status::OK();
+  }
+  auto n_channel = static_cast<size_t>(input->Size()) / n_time;
+  const T *in_data = &(*input->begin<T>());
+  T *out_data = &(*out->begin<T>());
+  for (size_t c = 0; c < n_channel; c += kLFilterLanes) {
+    LFilterChannels(in_data + c * n_time, out_data + c * n_time, std::min(kLFilterLanes, n_channel - c), n_time,
+                    a_coeffs, b_coeffs, clamp);
   }
-  // unpack batch
-  Tensor::CreateFromVector(out_vect, input_shape, &out);
   *output = out;
-  delete[] m_px;
-  delete[] m_py;
   return Status::OK();
 }
 
@@ -554,46 +569,49 @@ Status CreateLinearFbanks(std::shared_ptr<Tensor> *output, int32_t n_freqs, floa
 /// \param norm: Enum, NormType::kSlaney or NormType::kNone. If norm is NormType::kSlaney, divide the triangle mel
 ///     weight by the width of the mel band.
 /// \param mel_type: Type of calculate mel type, value should be MelType::kHtk or MelType::kSlaney.
+/// \param fbanks: Cache of the filterbank, it is created if it is nullptr or of another type (Default: nullptr).
 /// \return Status code.
 template <typename T>
 Status MelScale(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int32_t n_mels,
-                int32_t sample_rate, T f_min, T f_max, int32_t n_stft, NormType norm, MelType mel_type) {
+                int32_t sample_rate, T f_min, T f_max, int32_t n_stft, NormType norm, MelType mel_type,
+                std::shared_ptr<Tensor> *fbanks = nullptr) {
   // pack
   TensorShape input_shape = input->shape();
   TensorShape input_reshape({input->Size() / input_shape[-1] / input_shape[-2], input_shape[-2], input_shape[-1]});
   RETURN_IF_NOT_OK(input->Reshape(input_reshape));
   // gen freq bin mat
-  std::shared_ptr<Tensor> freq_bin_mat;
-  RETURN_IF_NOT_OK(CreateFbanks<T>(&freq_bin_mat, n_stft, f_min, f_max, n_mels, sample_rate, norm, mel_type));
+  std::shared_ptr<Tensor> freq_bin_mat = fbanks != nullptr ? *fbanks : nullptr;
+  if (freq_bin_mat == nullptr || freq_bin_mat->type() != input->type()) {
+    RETURN_IF_NOT_OK(CreateFbanks<T>(&freq_bin_mat, n_stft, f_min, f_max, n_mels, sample_rate, norm, mel_type));
+    if (fbanks != nullptr) {
+      *fbanks = freq_bin_mat;
+    }
+  }
   auto data_ptr = &*freq_bin_mat->begin<T>();
   Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> matrix_fb(data_ptr, n_mels, n_stft);
 
-  // input vector
-  std::vector<T> in_vect(input->Size());
-  size_t ind = 0;
-  for (auto itr = input->begin<T>(); itr != input->end<T>(); itr++, ind++) {
-    in_vect[ind] = (*itr);
-  }
   int rows = input_reshape[1];
   int cols = input_reshape[2];
-
-  std::vector<T> mel_specgram;
-
-  for (int c = 0; c < input_reshape[0]; c++) {
-    std::vector<T> mat_c = std::vector<T>(in_vect.begin() + rows * cols * c, in_vect.begin() + rows * cols * (c + 1));
-    Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(mat_c.data(), cols, rows);
-    Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> mat_res = (matrix_c * matrix_fb.transpose());
-    std::vector<T> vec_c(mat_res.data(), mat_res.data() + mat_res.size());
-    mel_specgram.insert(mel_specgram.end(), vec_c.begin(), vec_c.end());
-  }
-
-  // unpack
   std::vector<int64_t> out_shape_vec = input_shape.AsVector();
   out_shape_vec[input_shape.Size() - 1] = cols;
   out_shape_vec[input_shape.Size() - TWO] = n_mels;
-  TensorShape output_shape(out_shape_vec);
   std::shared_ptr<Tensor> out;
-  RETURN_IF_NOT_OK(Tensor::CreateFromVector(mel_specgram, output_shape, &out));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(out_shape_vec), input->type(), &out));
+  if (out->Size() == 0) {
+    *output = out;
+    return Status::OK();
+  }
+
+  // multiply each channel in place, without copying it out of the tensor
+  const T *in_ptr = &*input->begin<T>();
+  T *out_ptr = &*out->begin<T>();
+  for (int c = 0; c < input_reshape[0]; c++) {
+    Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> matrix_c(
+      in_ptr + static_cast<ptrdiff_t>(rows) * cols * c, cols, rows);
+    Eigen::Map<Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>> mat_res(
+      out_ptr + static_cast<ptrdiff_t>(n_mels) * cols * c, cols, n_mels);
+    mat_res.noalias() = matrix_c * matrix_fb.transpose();
+  }
   *output = out;
   return Status::OK();
 }
@@ -610,10 +628,19 @@ Status MelScale(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *o
 /// \param[in] center Whether to pad waveform on both sides.
 /// \param[in] pad_mode Controls the padding method used when center is true.
 /// \param[in] onesided Controls whether to return half of results to avoid redundancy.
+/// \param[in] fft_window Window created by CreateSpectrogramWindow, it is created on each call if nullptr.
 /// \return Status code.
 Status Spectrogram(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int pad, WindowType window,
                    int n_fft, int hop_length, int win_length, float power, bool normalized, bool center,
-                   BorderType pad_mode, bool onesided);
+                   BorderType pad_mode, bool onesided, const std::shared_ptr<Tensor> &fft_window = nullptr);
+
+/// \brief Create the window of spectrogram which is padded to n_fft.
+/// \param[out] output Window tensor of shape <n_fft>.
+/// \param[in] window Window function.
+/// \param[in] n_fft Size of FFT.
+/// \param[in] win_length Window size.
+/// \return Status code.
+Status CreateSpectrogramWindow(std::shared_ptr<Tensor> *output, WindowType window, int n_fft, int win_length);
 
 /// \brief Transform audio signal into spectrogram.
 /// \param[in] input Tensor of shape <..., time>.
@@ -38,10 +38,12 @@ Status MelScaleOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr
   std::shared_ptr<Tensor> input_tensor;
   if (input->type() != DataType::DE_FLOAT64) {
     RETURN_IF_NOT_OK(TypeCast(input, &input_tensor, DataType(DataType::DE_FLOAT32)));
-    return MelScale<float>(input_tensor, output, n_mels_, sample_rate_, f_min_, f_max_, n_stft_, norm_, mel_type_);
+    return MelScale<float>(input_tensor, output, n_mels_, sample_rate_, f_min_, f_max_, n_stft_, norm_, mel_type_,
+                           &fbanks_);
   } else {
     input_tensor = input;
-    return MelScale<double>(input_tensor, output, n_mels_, sample_rate_, f_min_, f_max_, n_stft_, norm_, mel_type_);
+    return MelScale<double>(input_tensor, output, n_mels_, sample_rate_, f_min_, f_max_, n_stft_, norm_, mel_type_,
+                            &fbanks_);
   }
 }
 
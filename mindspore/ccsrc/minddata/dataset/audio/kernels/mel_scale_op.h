@@ -57,6 +57,7 @@ class MelScaleOp : public TensorOp {
   int32_t n_stft_;
   NormType norm_;
   MelType mel_type_;
+  std::shared_ptr<Tensor> fbanks_;  // filterbank which is created on the first call
 };
 }  // namespace dataset
 }  // namespace mindspore
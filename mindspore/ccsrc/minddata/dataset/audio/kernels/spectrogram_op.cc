@@ -22,8 +22,11 @@ namespace mindspore {
 namespace dataset {
 Status SpectrogramOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
+  if (window_table_ == nullptr) {
+    RETURN_IF_NOT_OK(CreateSpectrogramWindow(&window_table_, window_, n_fft_, win_length_));
+  }
   return Spectrogram(input, output, pad_, window_, n_fft_, hop_length_, win_length_, power_, normalized_, center_,
-                     pad_mode_, onesided_);
+                     pad_mode_, onesided_, window_table_);
 }
 
 Status SpectrogramOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
@@ -60,6 +60,7 @@ class SpectrogramOp : public TensorOp {
   bool center_;
   BorderType pad_mode_;
   bool onesided_;
+  std::shared_ptr<Tensor> window_table_;  // padded window which is created on the first call
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -283,6 +283,78 @@ class ConfigManager {
   // @return - Flag to indicate whether the dataset is dynamic-shape
   bool dynamic_shape() const { return dynamic_shape_; }
 
+  // setter function
+  // @param enable - To enable mmap read mode of MindRecord files
+  void set_enable_mindrecord_mmap(bool enable) { enable_mindrecord_mmap_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether MindRecord files are read through mmap
+  bool enable_mindrecord_mmap() const { return enable_mindrecord_mmap_; }
+
+  // setter function
+  // @param enable - To use lock free queues between the main thread, the workers and the collector of parallel ops
+  void set_enable_lock_free_queue(bool enable) { enable_lock_free_queue_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether parallel ops use lock free worker queues
+  bool enable_lock_free_queue() const { return enable_lock_free_queue_; }
+
+  // setter function
+  // @param enable - To decode JPEG images at a reduced DCT scale when they are cropped or resized next
+  void set_enable_jpeg_scaled_decode(bool enable) { enable_jpeg_scaled_decode_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether fused decode ops may decode JPEG images at a reduced DCT scale
+  bool enable_jpeg_scaled_decode() const { return enable_jpeg_scaled_decode_; }
+
+  // setter function
+  // @param enable - To let AutoTune solve workers and queue sizes from a cost model of the ops
+  void set_enable_autotune_cost_model(bool enable) { enable_autotune_cost_model_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether AutoTune uses the cost model instead of the step heuristics
+  bool enable_autotune_cost_model() const { return enable_autotune_cost_model_; }
+
+  // setter function
+  // @param enable - To let random samplers shuffle with a seekable permutation of the row indices
+  void set_enable_seekable_shuffle(bool enable) { enable_seekable_shuffle_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether random samplers can start from any epoch and row without replaying the data
+  bool enable_seekable_shuffle() const { return enable_seekable_shuffle_; }
+
+  // setter function
+  // @param enable - To let the profiler trace the latency of every row in every op
+  void set_enable_row_tracing(bool enable) { enable_row_tracing_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether the profiler keeps per op latency histograms of the rows
+  bool enable_row_tracing() const { return enable_row_tracing_; }
+
+  // setter function
+  // @param enable - To let a batch over a CSV source carry the scalar columns as row blocks
+  void set_enable_row_block(bool enable) { enable_row_block_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether RowBlockPass may change the order of the rows read by several workers
+  bool enable_row_block() const { return enable_row_block_; }
+
+  // setter function
+  // @param enable - To let the workers of a CSV source read the ranges of a large file in parallel
+  void set_enable_csv_split(bool enable) { enable_csv_split_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether a CSV file larger than CSV_SPLIT_SIZE is split across the workers
+  bool enable_csv_split() const { return enable_csv_split_; }
+
+  // setter function
+  // @param dir - The directory to keep the metadata of source ops in, or an empty string to disable the snapshots
+  void set_source_snapshot_dir(const std::string &dir) { source_snapshot_dir_ = dir; }
+
+  // getter function
+  // @return - The directory where source ops keep their scanned file lists and parsed annotations between launches
+  std::string source_snapshot_dir() const { return source_snapshot_dir_; }
+
  private:
   // Private helper function that takes a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
@@ -317,6 +389,15 @@ class ConfigManager {
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
+  bool enable_mindrecord_mmap_{false};      // Read MindRecord blob data from mapped files instead of file streams
+  bool enable_lock_free_queue_{false};      // Use single-producer single-consumer lock free worker queues
+  bool enable_jpeg_scaled_decode_{false};   // Decode JPEG at a reduced DCT scale in fused decode ops
+  bool enable_autotune_cost_model_{false};  // AutoTune solves the configuration from a cost model of the ops
+  bool enable_seekable_shuffle_{false};     // Random samplers shuffle with a seekable permutation of the row indices
+  bool enable_row_tracing_{false};          // Profiler stamps the rows and keeps per op latency histograms
+  bool enable_row_block_{false};            // CSV rows are carried as row blocks into a batch by RowBlockPass
+  bool enable_csv_split_{false};            // Large CSV files are split into ranges read by different workers
+  std::string source_snapshot_dir_;         // Directory of the metadata snapshots of source ops, empty if disabled
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -114,6 +114,24 @@ Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, Tenso
   return Status::OK();
 }
 
+Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, const std::shared_ptr<MemoryPool> &pool,
+                           TensorPtr *out) {
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Failed to create empty tensor, tensor shape is unknown.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(), "Failed to create empty tensor, data type should be numeric.");
+  RETURN_UNEXPECTED_IF_NULL(pool);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, type);
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Failed to create empty tensor, allocate memory failed.");
+  (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+  int64_t byte_size = (*out)->SizeInBytes();
+  // Don't allocate if we have a tensor with no elements.
+  if (byte_size != 0) {
+    RETURN_IF_NOT_OK((*out)->AllocateBuffer(byte_size));
+  }
+  return Status::OK();
+}
+
 Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src, TensorPtr *out) {
   RETURN_IF_NOT_OK(CreateEmpty(shape, type, out));
   if (src != nullptr && out != nullptr) {
@@ -54,6 +54,7 @@ namespace dataset {
 class Tensor;
 template <typename T>
 class Allocator;
+class MemoryPool;
 
 using CharAllocPtr = std::unique_ptr<Allocator<unsigned char>>;
 using TensorAllocPtr = std::shared_ptr<Allocator<Tensor>>;  // An allocator shared_ptr for Tensors
@@ -88,6 +89,16 @@ class Tensor {
   /// \return Status code
   static Status CreateEmpty(const TensorShape &shape, const DataType &type, TensorPtr *out);
 
+  /// Create a numeric tensor with type and shape whose buffer is allocated from the given memory pool instead of the
+  /// global one, and is returned to it when the tensor is destroyed. Items of the tensor would be uninitialized.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor, must be numeric
+  /// \param[in] pool memory pool of the tensor buffer
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateEmpty(const TensorShape &shape, const DataType &type, const std::shared_ptr<MemoryPool> &pool,
+                            TensorPtr *out);
+
   /// Create a numeric tensor from a pointer in memory. Length of the source data is determined from the shape and type.
   /// Data will be copied into the new created tensor.
   /// \param[in] shape shape of the output tensor
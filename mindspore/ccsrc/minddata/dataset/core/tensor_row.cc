@@ -33,7 +33,12 @@ TensorRow::TensorRow(row_id_type id, const std::initializer_list<value_type> &ls
     : id_(id), path_({}), row_(lst), tensor_row_flag_(kFlagNone) {}
 
 TensorRow::TensorRow(const TensorRow &tr)
-    : id_(tr.id_), path_(tr.path_), row_(tr.row_), tensor_row_flag_(tr.tensor_row_flag_) {}
+    : id_(tr.id_),
+      path_(tr.path_),
+      row_(tr.row_),
+      tensor_row_flag_(tr.tensor_row_flag_),
+      timestamp_(tr.timestamp_),
+      block_size_(tr.block_size_) {}
 
 TensorRow::TensorRow(TensorRow::TensorRowFlags flag) : id_(kDefaultRowId), path_({}), tensor_row_flag_(flag) {}
 
@@ -45,6 +50,8 @@ TensorRow &TensorRow::operator=(const TensorRow &tr) {
   id_ = tr.id_;
   path_ = tr.path_;
   tensor_row_flag_ = tr.tensor_row_flag_;
+  timestamp_ = tr.timestamp_;
+  block_size_ = tr.block_size_;
   return *this;
 }
 
@@ -65,6 +72,8 @@ TensorRow::TensorRow(TensorRow &&tr) noexcept {
   path_ = std::move(tr.path_);
   row_ = std::move(tr.row_);
   tensor_row_flag_ = tr.tensor_row_flag_;
+  timestamp_ = tr.timestamp_;
+  block_size_ = tr.block_size_;
 }
 
 TensorRow &TensorRow::operator=(TensorRow &&tr) noexcept {
@@ -76,6 +85,8 @@ TensorRow &TensorRow::operator=(TensorRow &&tr) noexcept {
   tr.id_ = kDefaultRowId;
   path_ = std::move(tr.path_);
   tensor_row_flag_ = tr.tensor_row_flag_;
+  timestamp_ = tr.timestamp_;
+  block_size_ = tr.block_size_;
   return *this;
 }
 
@@ -85,6 +96,27 @@ TensorRow &TensorRow::operator=(std::initializer_list<TensorRow::value_type> &&l
   return *this;
 }
 
+Status TensorRow::SliceBlock(int64_t begin, int64_t end, TensorRow *out) const {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(begin >= 0 && begin < end && end <= block_size_,
+                               "[Internal ERROR] Invalid range of row block, block size: " +
+                                 std::to_string(block_size_) + ", begin: " + std::to_string(begin) +
+                                 ", end: " + std::to_string(end));
+  TensorRow block;
+  block.setId(id_);
+  block.reserve(row_.size());
+  for (const auto &tensor : row_) {
+    std::shared_ptr<Tensor> column;
+    RETURN_IF_NOT_OK(tensor->Slice(&column, {SliceOption(Slice(begin, end))}));
+    block.push_back(std::move(column));
+  }
+  block.setPath(path_);
+  block.setTimestamp(timestamp_);
+  block.setBlockSize(end - begin);
+  *out = std::move(block);
+  return Status::OK();
+}
+
 Status TensorRow::ValidateTensorRow(const TensorRow &input, const DataType &data_type) {
   if (data_type == DataType::DE_UNKNOWN) {
     RETURN_STATUS_UNEXPECTED("ConvertFromTensorRow: Data type was not recognized.");
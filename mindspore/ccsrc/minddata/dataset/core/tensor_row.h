@@ -167,6 +167,24 @@ class TensorRow {
 
   void setPath(const std::vector<std::string> &path) { path_ = path; }
 
+  // Time in us when the row entered the op which holds it, only set when row tracing is enabled, 0 if unknown
+  uint64_t getTimestamp() const { return timestamp_; }
+
+  void setTimestamp(uint64_t timestamp) { timestamp_ = timestamp; }
+
+  // Number of rows held by a row block, 0 for a plain row. Each tensor of a row block is a 1-D tensor which holds the
+  // values of a scalar column of consecutive rows, so a table of scalars does not need a tensor per value.
+  int64_t getBlockSize() const { return block_size_; }
+
+  void setBlockSize(int64_t block_size) { block_size_ = block_size; }
+
+  // Copy some consecutive rows of a row block into a new row block
+  // @param begin - index of the first row to copy
+  // @param end - index after the last row to copy
+  // @param out - Returned row block
+  // @return Status The status code returned
+  Status SliceBlock(int64_t begin, int64_t end, TensorRow *out) const;
+
   const vector_type &getRow() const { return row_; }
 
   dsize_t SizeInBytes() const {
@@ -246,6 +264,10 @@ class TensorRow {
 
   TensorRowFlags tensor_row_flag_;
 
+  uint64_t timestamp_{0};
+
+  int64_t block_size_{0};
+
  private:
   /// Validate data type of TensorRow for conversions.
   /// \param[in] input TensorRow
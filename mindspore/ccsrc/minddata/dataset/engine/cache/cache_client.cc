@@ -146,6 +146,12 @@ Status CacheClient::GetRows(const std::vector<row_id_type> &row_id, TensorTable
   return rc;
 }
 
+Status CacheClient::PrefetchRows(const std::vector<row_id_type> &row_id) const {
+  auto rq = std::make_shared<PrefetchRowsRequest>(this, row_id);
+  // This is only a hint to the server. We won't wait for the result.
+  return PushRequest(rq);
+}
+
 Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
   UniqueLock lck(&mux_);
   // To create a cache, we identify ourself at the client by:
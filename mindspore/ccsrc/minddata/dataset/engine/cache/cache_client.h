@@ -52,6 +52,7 @@ class CacheClient {
   friend class CreateCacheRequest;
   friend class CacheRowRequest;
   friend class BatchFetchRequest;
+  friend class PrefetchRowsRequest;
   friend class BatchCacheRowsRequest;
 
   /// \brief A builder to help creating a CacheClient object
@@ -163,6 +164,12 @@ class CacheClient {
   /// \return return code
   Status GetRows(const std::vector<row_id_type> &row_id, TensorTable *out) const;
 
+  /// \brief Tell the server which rows are going to be fetched next, so it can read the spilled ones back into memory.
+  /// It doesn't wait for the server.
+  /// \param row_id A vector of row id's in the order they are going to be fetched
+  /// \return return code
+  Status PrefetchRows(const std::vector<row_id_type> &row_id) const;
+
   /// \brief Create a cache.
   /// \param tree_crc  A crc that was generated during tree prepare phase
   /// \param generate_id Let the cache service generate row id
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <functional>
 #include "utils/ms_utils.h"
 #include "minddata/dataset/engine/cache/cache_pool.h"
 #include "minddata/dataset/engine/cache/cache_server.h"
@@ -21,8 +22,17 @@
 
 namespace mindspore {
 namespace dataset {
-CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root)
-    : mp_(std::move(mp)), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), tree_(nullptr) {
+CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root, uint64_t staging_area_sz)
+    : mp_(std::move(mp)),
+      root_(root),
+      subfolder_(Services::GetUniqueID()),
+      sm_(nullptr),
+      tree_(nullptr),
+      staging_area_sz_(staging_area_sz),
+      staged_bytes_(0),
+      prefetched_bytes_(0),
+      num_dirty_(0),
+      staging_seq_(0) {
   // Initialize soft memory cap to the current available memory on the machine.
   soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
   temp_mem_usage_ = 0;
@@ -39,6 +49,12 @@ Status CachePool::DoServiceStart() {
     sm_ = std::make_shared<StorageManager>(spill, cs.GetNumWorkers());
     RETURN_IF_NOT_OK(sm_->ServiceStart());
     MS_LOG(INFO) << "CachePool will use disk folder: " << spill.ToString();
+    // Spawn a few tasks to write and read the spilled buffers in the background.
+    spill_q_ = std::make_unique<Queue<SpillRequest>>(kSpillQueCapacity);
+    RETURN_IF_NOT_OK(spill_q_->Register(&vg_));
+    for (auto i = 0; i < kNumSpillTasks; ++i) {
+      RETURN_IF_NOT_OK(vg_.CreateAsyncTask("Cache spill worker", std::bind(&CachePool::SpillWorker, this)));
+    }
   }
   return Status::OK();
 }
@@ -46,9 +62,17 @@ Status CachePool::DoServiceStart() {
 Status CachePool::DoServiceStop() {
   Status rc;
   Status rc2;
+  // Stop the spill tasks before the StorageManager. Buffers which are not written yet are dropped with the pool.
+  rc = vg_.ServiceStop();
+  if (rc.IsError()) {
+    rc2 = rc;
+  }
+  spill_q_.reset();
+  staged_.clear();
+  evictable_.clear();
   if (sm_ != nullptr) {
     rc = sm_->ServiceStop();
-    if (rc.IsError()) {
+    if (rc.IsError() && rc2.IsOk()) {
       rc2 = rc;
     }
   }
@@ -83,6 +107,7 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
   DataLocator bl;
   Status rc;
   size_t sz = 0;
+  bool staged = false;
   // We will consolidate all the slices into one piece.
   for (auto &v : buf) {
     sz += v.GetSize();
@@ -132,8 +157,8 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
   } else if (rc == StatusCode::kMDOutOfMemory) {
     // If no memory, write to disk.
     if (sm_ != nullptr) {
-      MS_LOG(DEBUG) << "Spill to disk directly ... " << bl.sz << " bytes.";
-      RETURN_IF_NOT_OK(sm_->Write(&bl.storage_key, buf));
+      MS_LOG(DEBUG) << "Spill to disk ... " << bl.sz << " bytes.";
+      RETURN_IF_NOT_OK(Spill(key, buf, &bl, &staged));
     } else {
       // If asked to spill to disk instead but there is no storage set up, simply return no memory
       // instead.
@@ -154,31 +179,297 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
     bl.ptr = nullptr;
     return rc;
   }
+  if (staged) {
+    if (rc.IsError()) {
+      Unstage(key);
+      return rc;
+    }
+    // Only queue the write after the key is in the tree, where the spill task will record the storage key.
+    SpillRequest spill_rq;
+    spill_rq.type = SpillRequest::Type::kWrite;
+    spill_rq.key = key;
+    RETURN_IF_NOT_OK(spill_q_->Add(std::move(spill_rq)));
+  }
   return rc;
 }
 
-Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *bytesRead) const {
+Status CachePool::Spill(CachePool::key_type key, const std::vector<ReadableSlice> &buf, DataLocator *bl,
+                        bool *staged) {
+  *staged = false;
+  auto row = std::make_shared<StagedRow>();
+  bool has_room = false;
+  {
+    std::unique_lock<std::mutex> lck(staging_mux_);
+    has_room = MakeRoom(bl->sz);
+    if (has_room) {
+      // Reserve the space before we copy without holding the lock.
+      staged_bytes_ += bl->sz;
+      ++num_dirty_;
+    }
+  }
+  if (has_room) {
+    try {
+      row->data.reserve(bl->sz);
+      for (auto &v : buf) {
+        row->data.append(static_cast<const char *>(v.GetPointer()), v.GetSize());
+      }
+      row->dirty = true;
+    } catch (const std::bad_alloc &e) {
+      row = nullptr;
+    }
+    std::unique_lock<std::mutex> lck(staging_mux_);
+    if (row != nullptr && staged_.emplace(key, row).second) {
+      row->seq = staging_seq_++;
+      *staged = true;
+      return Status::OK();
+    }
+    staged_bytes_ -= bl->sz;
+    --num_dirty_;
+  }
+  // The staging area is full of buffers which are not written yet. Slow down and write to disk directly.
+  return sm_->Write(&bl->storage_key, buf);
+}
+
+void CachePool::Unstage(CachePool::key_type key) {
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  auto it = staged_.find(key);
+  if (it == staged_.end()) {
+    return;
+  }
+  auto &row = it->second;
+  if (row->dirty) {
+    --num_dirty_;
+  } else if (row->prefetched) {
+    prefetched_bytes_ -= row->data.size();
+  } else {
+    (void)evictable_.erase(std::make_tuple(row->hits, row->seq, key));
+  }
+  staged_bytes_ -= row->data.size();
+  (void)staged_.erase(it);
+  flush_cv_.notify_all();
+}
+
+std::shared_ptr<CachePool::StagedRow> CachePool::Hit(CachePool::key_type key) {
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  auto it = staged_.find(key);
+  if (it == staged_.end()) {
+    return nullptr;
+  }
+  auto row = it->second;
+  if (row->dirty) {
+    ++row->hits;
+  } else {
+    if (row->prefetched) {
+      // The buffer has been read ahead for this read. From now on it competes with the others to stay.
+      row->prefetched = false;
+      prefetched_bytes_ -= row->data.size();
+    } else {
+      (void)evictable_.erase(std::make_tuple(row->hits, row->seq, key));
+    }
+    ++row->hits;
+    (void)evictable_.emplace(row->hits, row->seq, key);
+  }
+  return row;
+}
+
+bool CachePool::MakeRoom(size_t sz) {
+  while (staged_bytes_ + sz > staging_area_sz_ && !evictable_.empty()) {
+    auto victim = std::get<2>(*evictable_.begin());
+    (void)evictable_.erase(evictable_.begin());
+    auto it = staged_.find(victim);
+    staged_bytes_ -= it->second->data.size();
+    (void)staged_.erase(it);
+  }
+  return staged_bytes_ + sz <= staging_area_sz_;
+}
+
+Status CachePool::SpillWorker() {
+  TaskManager::FindMe()->Post();
+  while (true) {
+    SpillRequest rq;
+    RETURN_IF_NOT_OK(spill_q_->PopFront(&rq));
+    if (rq.type == SpillRequest::Type::kWrite) {
+      RETURN_IF_NOT_OK(WriteStagedRow(rq.key));
+    } else {
+      RETURN_IF_NOT_OK(ReadAhead(rq.key));
+    }
+  }
+}
+
+Status CachePool::WriteStagedRow(CachePool::key_type key) {
+  std::shared_ptr<StagedRow> row;
+  {
+    std::unique_lock<std::mutex> lck(staging_mux_);
+    auto it = staged_.find(key);
+    CHECK_FAIL_RETURN_UNEXPECTED(it != staged_.end(), "Spilled key " + std::to_string(key) + " is not staged.");
+    row = it->second;
+  }
+  DataLocator bl;
+  bl.sz = row->data.size();
+  Status rc = sm_->Write(&bl.storage_key, {ReadableSlice(row->data.data(), row->data.size())});
+  if (rc.IsOk()) {
+    // Publish the storage key before the buffer can be evicted from the staging area.
+    (void)tree_->DoUpdate(key, bl);
+  } else {
+    // Keep the buffer in the staging area for good so it can still be read.
+    MS_LOG(ERROR) << "Failed to spill key " << key << " to disk. " << rc.ToString();
+  }
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  if (rc.IsOk()) {
+    row->dirty = false;
+    (void)evictable_.emplace(row->hits, row->seq, key);
+  }
+  --num_dirty_;
+  flush_cv_.notify_all();
+  return Status::OK();
+}
+
+Status CachePool::ReadAhead(CachePool::key_type key) {
+  size_t sz = 0;
+  StorageManager::key_type storage_key = 0;
+  bool found = false;
+  {
+    auto r = tree_->Search(key);
+    if (r.second) {
+      found = true;
+      sz = r.first->sz;
+      storage_key = r.first->storage_key;
+    }
+  }
+  auto row = std::make_shared<StagedRow>();
+  Status rc = found ? Status::OK() : STATUS_ERROR(StatusCode::kMDUnexpectedError, "Key not found.");
+  try {
+    if (rc.IsOk()) {
+      row->data.resize(sz);
+      WritableSlice dest(row->data.data(), sz);
+      size_t bytes_read = 0;
+      rc = sm_->Read(storage_key, &dest, &bytes_read);
+      if (rc.IsOk() && bytes_read != sz) {
+        rc = STATUS_ERROR(StatusCode::kMDUnexpectedError, "Length mismatch.");
+      }
+    }
+  } catch (const std::bad_alloc &e) {
+    rc = STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
+  }
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  (void)prefetching_.erase(key);
+  // A failed read ahead is not an error. The buffer will be read from disk again when it is asked for.
+  if (rc.IsError()) {
+    MS_LOG(DEBUG) << "Failed to read key " << key << " ahead. " << rc.ToString();
+    return Status::OK();
+  }
+  // Prefetched buffers can't be evicted before they are read, so they may take up only half of the staging area.
+  if (prefetched_bytes_ + sz <= staging_area_sz_ / 2 && staged_.count(key) == 0 && MakeRoom(sz)) {
+    row->prefetched = true;
+    row->seq = staging_seq_++;
+    (void)staged_.emplace(key, row);
+    staged_bytes_ += sz;
+    prefetched_bytes_ += sz;
+  }
+  return Status::OK();
+}
+
+Status CachePool::Prefetch(const std::vector<key_type> &keys) {
+  if (sm_ == nullptr) {
+    return Status::OK();
+  }
+  for (auto key : keys) {
+    size_t sz = 0;
+    {
+      auto r = tree_->Search(key);
+      // Nothing to do if the buffer is in memory or not cached at all.
+      if (!r.second || r.first->ptr != nullptr) {
+        continue;
+      }
+      sz = r.first->sz;
+    }
+    {
+      std::unique_lock<std::mutex> lck(staging_mux_);
+      if (prefetched_bytes_ + sz > staging_area_sz_ / 2) {
+        // Too far ahead of the reader. Drop the rest.
+        break;
+      }
+      if (staged_.count(key) > 0 || !prefetching_.insert(key).second) {
+        continue;
+      }
+    }
+    SpillRequest spill_rq;
+    spill_rq.type = SpillRequest::Type::kRead;
+    spill_rq.key = key;
+    // It is only a hint. Don't hold up the caller behind the spill writes, drop the rest when the queue is full.
+    if (!spill_q_->TryAdd(std::move(spill_rq))) {
+      std::unique_lock<std::mutex> lck(staging_mux_);
+      (void)prefetching_.erase(key);
+      break;
+    }
+  }
+  return Status::OK();
+}
+
+Status CachePool::Flush() {
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  flush_cv_.wait(lck, [this]() { return num_dirty_ == 0; });
+  return Status::OK();
+}
+
+bool CachePool::IsStaged(CachePool::key_type key) {
+  std::unique_lock<std::mutex> lck(staging_mux_);
+  return staged_.count(key) > 0;
+}
+
+void CachePool::SetLocking(bool on_off) {
+  if (!on_off) {
+    // The spill tasks update the tree when a buffer is written. Let them finish before we give up the locks.
+    Status rc = Flush();
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << rc.ToString();
+    }
+  }
+  tree_->SetLocking(on_off);
+}
+
+Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *bytesRead) {
   RETURN_UNEXPECTED_IF_NULL(dest);
-  auto r = tree_->Search(key);
-  if (r.second) {
+  size_t sz = 0;
+  {
+    auto r = tree_->Search(key);
+    if (!r.second) {
+      RETURN_STATUS_UNEXPECTED("Key not found");
+    }
     auto &it = r.first;
+    sz = it->sz;
     if (it->ptr != nullptr) {
       ReadableSlice src(it->ptr, it->sz);
       RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
-    } else if (sm_ != nullptr) {
+      if (bytesRead != nullptr) {
+        *bytesRead = sz;
+      }
+      return Status::OK();
+    }
+  }
+  if (sm_ != nullptr) {
+    auto row = Hit(key);
+    if (row != nullptr) {
+      ReadableSlice src(row->data.data(), row->data.size());
+      RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
+    } else {
+      // Look up the storage key again. The buffer may have been written and evicted after the first look up.
+      StorageManager::key_type storage_key = 0;
+      {
+        auto r = tree_->Search(key);
+        storage_key = r.first->storage_key;
+      }
       size_t expectedLength = 0;
-      RETURN_IF_NOT_OK(sm_->Read(it->storage_key, dest, &expectedLength));
-      if (expectedLength != it->sz) {
-        MS_LOG(ERROR) << "Unexpected length. Read " << expectedLength << ". Expected " << it->sz << "."
+      RETURN_IF_NOT_OK(sm_->Read(storage_key, dest, &expectedLength));
+      if (expectedLength != sz) {
+        MS_LOG(ERROR) << "Unexpected length. Read " << expectedLength << ". Expected " << sz << "."
                       << " Internal key: " << key << "\n";
         RETURN_STATUS_UNEXPECTED("Length mismatch. See log file for details.");
       }
     }
-    if (bytesRead != nullptr) {
-      *bytesRead = it->sz;
-    }
-  } else {
-    RETURN_STATUS_UNEXPECTED("Key not found");
+  }
+  if (bytesRead != nullptr) {
+    *bytesRead = sz;
   }
   return Status::OK();
 }
@@ -16,25 +16,34 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_CACHE_POOL_H_
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include "minddata/dataset/engine/cache/cache_common.h"
 #include "minddata/dataset/engine/cache/cache_numa.h"
 #include "minddata/dataset/engine/cache/storage_manager.h"
 #include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/queue.h"
 #include "minddata/dataset/util/service.h"
 #include "minddata/dataset/util/slice.h"
 #include "minddata/dataset/util/auto_index.h"
 #include "minddata/dataset/util/btree.h"
+#include "minddata/dataset/util/task_manager.h"
 
 namespace mindspore {
 namespace dataset {
 /// \brief A CachePool provides service for backup/restore a buffer. A buffer can be represented in a form of vector of
 /// ReadableSlice where all memory blocks will be copied to one contiguous block which can be in memory or spilled to
 /// disk (if a disk directory is provided). User must provide a key to insert the buffer.
+/// Buffers spilled to disk are first kept in a small staging area in memory and written by background tasks, so the
+/// caller doesn't wait for the disk. The staging area also holds spilled buffers read back ahead of time by Prefetch.
 /// \see ReadableSlice
 class CachePool : public Service {
  public:
@@ -98,10 +107,14 @@ class CachePool : public Service {
     std::vector<key_type> gap;
   };
 
+  static constexpr uint64_t kDefaultStagingAreaSize = 268435456;
+
   /// \brief Constructor
   /// \param alloc Allocator to allocate memory from
   /// \param root Optional disk folder to spill
-  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "");
+  /// \param staging_area_sz Optional size of the staging area in memory for the spilled buffers
+  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "",
+                     uint64_t staging_area_sz = kDefaultStagingAreaSize);
 
   CachePool(const CachePool &) = delete;
   CachePool(CachePool &&) = delete;
@@ -127,7 +140,21 @@ class CachePool : public Service {
   /// \param[out] dest The cached buffer will be copied to this destination represented by a WritableSlice
   /// \param[out] bytesRead Optional. Number of bytes read.
   /// \return Error code
-  Status Read(key_type key, WritableSlice *dest, size_t *bytesRead = nullptr) const;
+  Status Read(key_type key, WritableSlice *dest, size_t *bytesRead = nullptr);
+
+  /// \brief Read spilled buffers back from disk into the staging area ahead of time. It doesn't wait for the reads.
+  /// \param[in] keys Keys in the order they are going to be read
+  /// \return Error code
+  Status Prefetch(const std::vector<key_type> &keys);
+
+  /// \brief Wait until all the spilled buffers in the staging area are written to disk
+  /// \return Error code
+  Status Flush();
+
+  /// \brief Check whether a spilled buffer is kept in the staging area
+  /// \param[in] key A previous key returned from Insert
+  /// \return True if the buffer can be read without going to disk
+  bool IsStaged(key_type key);
 
   /// \brief Serialize a DataLocator
   Status GetDataLocator(key_type, const std::shared_ptr<flatbuffers::FlatBufferBuilder> &,
@@ -141,9 +168,47 @@ class CachePool : public Service {
 
   /// \brief Toggle locking
   /// \note Once locking is off. It is user's responsibility to ensure concurrency
-  void SetLocking(bool on_off) { tree_->SetLocking(on_off); }
+  void SetLocking(bool on_off);
 
  private:
+  // A spilled buffer which is also kept in the staging area, either because it is not written to disk yet, or
+  // because it is read back from disk by Prefetch.
+  struct StagedRow {
+    std::string data;
+    bool dirty = false;       // not written to disk yet, can't be evicted
+    bool prefetched = false;  // read back from disk but not read by the user yet, can't be evicted
+    int64_t hits = 0;         // number of reads
+    int64_t seq = 0;          // when the buffer was staged
+  };
+
+  // A job for the spill tasks, either writing a staged buffer to disk or reading a spilled buffer back.
+  struct SpillRequest {
+    enum class Type : uint8_t { kWrite, kRead };
+    Type type = Type::kWrite;
+    key_type key = 0;
+  };
+
+  // Eviction order of clean buffers: the least read first, then the least recently staged.
+  using evict_key = std::tuple<int64_t, int64_t, key_type>;
+
+  /// \brief Copy a buffer into the staging area and queue it for writing. If the staging area is full of buffers
+  /// which are not written yet, the buffer is written to disk directly.
+  Status Spill(key_type key, const std::vector<ReadableSlice> &buf, DataLocator *bl, bool *staged);
+
+  /// \brief Remove a buffer from the staging area
+  void Unstage(key_type key);
+
+  /// \brief Look up a buffer in the staging area and count the read
+  std::shared_ptr<StagedRow> Hit(key_type key);
+
+  /// \brief Evict clean buffers until sz more bytes fit into the staging area. Must hold staging_mux_.
+  bool MakeRoom(size_t sz);
+
+  /// \brief Main loop of the spill tasks
+  Status SpillWorker();
+  Status WriteStagedRow(key_type key);
+  Status ReadAhead(key_type key);
+
   std::shared_ptr<NumaMemoryPool> mp_;
   Path root_;
   const std::string subfolder_;
@@ -154,6 +219,21 @@ class CachePool : public Service {
                                           // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
   uint64_t min_avail_mem_;                // lower bound of the available memory
   const int kMemoryCapAdjustInterval = 104857600;
+  const uint64_t staging_area_sz_;
+  const int32_t kNumSpillTasks = 4;
+  const int32_t kSpillQueCapacity = 1024;
+
+  std::mutex staging_mux_;
+  std::condition_variable flush_cv_;
+  std::unordered_map<key_type, std::shared_ptr<StagedRow>> staged_;
+  std::set<evict_key> evictable_;
+  std::unordered_set<key_type> prefetching_;
+  uint64_t staged_bytes_;      // bytes of all the buffers in the staging area
+  uint64_t prefetched_bytes_;  // bytes of the prefetched buffers which are not read yet
+  int64_t num_dirty_;
+  int64_t staging_seq_;
+  std::unique_ptr<Queue<SpillRequest>> spill_q_;
+  TaskGroup vg_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -87,6 +87,7 @@ class BaseRequest {
     kBatchCacheRows = 19,
     kInternalCacheRow = 20,
     kGetCacheState = 21,
+    kPrefetchRows = 22,
     // Add new request before it.
     kRequestUnknown = 32767
   };
@@ -136,7 +137,7 @@ class BaseRequest {
   bool IsRowRequest() const {
     return type_ == RequestType::kBatchCacheRows || type_ == RequestType::kBatchFetchRows ||
            type_ == RequestType::kInternalCacheRow || type_ == RequestType::kInternalFetchRow ||
-           type_ == RequestType::kCacheRow;
+           type_ == RequestType::kCacheRow || type_ == RequestType::kPrefetchRows;
   }
 
   /// \brief Return if the request is of admin request type
@@ -240,6 +241,14 @@ class BatchFetchRequest : public BaseRequest {
   std::vector<row_id_type> row_id_;
 };
 
+/// \brief Request to read spilled rows back into memory before they are fetched. There is no result to wait for.
+class PrefetchRowsRequest : public BaseRequest {
+ public:
+  friend class CacheServer;
+  PrefetchRowsRequest(const CacheClient *cc, const std::vector<row_id_type> &row_id);
+  ~PrefetchRowsRequest() override = default;
+};
+
 /// \brief Request to create a cache for the current connection
 class CreateCacheRequest : public BaseRequest {
  public:
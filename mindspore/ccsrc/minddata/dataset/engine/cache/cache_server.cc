@@ -558,6 +558,26 @@ Status CacheServer::BatchFetchRows(CacheRequest *rq, CacheReply *reply) {
   return Status::OK();
 }
 
+Status CacheServer::PrefetchRows(CacheRequest *rq) {
+  auto connection_id = rq->connection_id();
+  // Hold the shared lock to prevent the cache from being dropped.
+  SharedLock lck(&rwLock_);
+  CacheService *cs = GetService(connection_id);
+  if (cs == nullptr) {
+    std::string errMsg = "Cache id " + std::to_string(connection_id) + " not found";
+    RETURN_STATUS_UNEXPECTED(errMsg);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(!rq->buf_data().empty(), "Missing row id");
+  auto p = flatbuffers::GetRoot<TensorRowIds>(rq->buf_data(0).data());
+  std::vector<row_id_type> row_id;
+  auto sz = p->row_id()->size();
+  row_id.reserve(sz);
+  for (uint32_t i = 0; i < sz; ++i) {
+    row_id.push_back(p->row_id()->Get(i));
+  }
+  return cs->Prefetch(row_id);
+}
+
 Status CacheServer::GetStat(CacheRequest *rq, CacheReply *reply) {
   auto connection_id = rq->connection_id();
   // Hold the shared lock to prevent the cache from being dropped.
@@ -833,6 +853,10 @@ Status CacheServer::ProcessRowRequest(CacheServerRequest *cache_req, bool *inter
       cache_req->rc_ = InternalFetchRow(&rq);
       break;
     }
+    case BaseRequest::RequestType::kPrefetchRows: {
+      cache_req->rc_ = PrefetchRows(&rq);
+      break;
+    }
     default:
       std::string errMsg("Internal error, request type is not row request: ");
       errMsg += std::to_string(static_cast<uint16_t>(cache_req->type_));
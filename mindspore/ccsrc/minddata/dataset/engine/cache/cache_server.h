@@ -477,6 +477,11 @@ class CacheServer : public Service {
   Status BatchFetch(const std::shared_ptr<flatbuffers::FlatBufferBuilder> &fbb, WritableSlice *out);
   Status BatchCacheRows(CacheRequest *rq);
 
+  /// \brief Handle kPrefetchRows request
+  /// \param rq Request
+  /// \return Status object
+  Status PrefetchRows(CacheRequest *rq);
+
   Status InternalFetchRow(CacheRequest *rq);
   Status InternalCacheRow(CacheRequest *rq, CacheReply *reply);
 };
@@ -254,6 +254,15 @@ Status CacheService::PreBatchFetch(connection_id_type connection_id, const std::
   return Status::OK();
 }
 
+Status CacheService::Prefetch(const std::vector<row_id_type> &v) {
+  SharedLock rw(&rw_lock_);
+  if (HasBuildPhase() && st_ != CacheServiceState::kFetchPhase) {
+    // Rows can't be fetched until the build phase is over. Simply ignore the hint.
+    return Status::OK();
+  }
+  return cp_->Prefetch(v);
+}
+
 Status CacheService::InternalFetchRow(const FetchRowMsg *p) {
   RETURN_UNEXPECTED_IF_NULL(p);
   SharedLock rw(&rw_lock_);
@@ -75,6 +75,11 @@ class CacheService : public Service {
   Status PreBatchFetch(connection_id_type connection_id, const std::vector<row_id_type> &v,
                        const std::shared_ptr<flatbuffers::FlatBufferBuilder> &);
 
+  /// \brief Read the spilled rows among the given row id back into memory before they are fetched.
+  /// \param v A vector of row id in the order they are going to be fetched
+  /// \return Status object
+  Status Prefetch(const std::vector<row_id_type> &v);
+
   /// \brief Getter function
   /// \return Spilling path
   Path GetSpillPath() const;
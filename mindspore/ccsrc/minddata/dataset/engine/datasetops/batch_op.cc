@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/engine/datasetops/batch_op.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "utils/ms_utils.h"
@@ -23,6 +24,7 @@
 #endif
 
 #include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/util/recycling_pool.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -68,6 +70,7 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
       pad_info_(pad_map),
       batch_num_(0),
       batch_cnt_(0),
+      batch_buffer_pool_(std::make_shared<RecyclingPool>()),
       python_mp_(nullptr) {
   // Adjust connector queue size.  After batch each row is batch_size times larger
   worker_connector_size_ = std::max(1, worker_connector_size_ / start_batch_size_);
@@ -89,6 +92,7 @@ Status BatchOp::operator()() {
 
   TensorRow new_row;
   std::unique_ptr<TensorQTable> table = std::make_unique<TensorQTable>();
+  int64_t table_rows = 0;  // a row block in the table counts as all of its rows
   child_iterator_ = std::make_unique<ChildIterator>(this, 0, 0);
   RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
   int32_t cur_batch_size = 0;
@@ -105,16 +109,34 @@ Status BatchOp::operator()() {
         total_step++;
         RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
       }
+      // a row block is cut at the end of the batch, and the rest of it starts the next batch
+      int64_t num_rows = 1;
+      TensorRow rest_rows;
+      if (new_row.getBlockSize() > 0) {
+        num_rows = std::min<int64_t>(new_row.getBlockSize(), cur_batch_size - table_rows);
+        if (num_rows < new_row.getBlockSize()) {
+          TensorRow head_rows;
+          RETURN_IF_NOT_OK(new_row.SliceBlock(num_rows, new_row.getBlockSize(), &rest_rows));
+          RETURN_IF_NOT_OK(new_row.SliceBlock(0, num_rows, &head_rows));
+          new_row = std::move(head_rows);
+        }
+      }
       table->emplace_back(new_row);
+      table_rows += num_rows;
       // if # of rows is enough to make 1 batch, send it to worker_queue
-      if (table->size() == static_cast<size_t>(cur_batch_size)) {
+      if (table_rows == cur_batch_size) {
         RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->EmplaceBack(
           std::make_pair(std::move(table), CBatchInfo(epoch_num, batch_num++, cnt + 1 - epoch_num))));
         cnt++;
         table = std::make_unique<TensorQTable>();
+        table_rows = 0;
         RETURN_IF_NOT_OK(GetBatchSize(&cur_batch_size, CBatchInfo(epoch_num, batch_num, cnt - epoch_num)));
       }
-      RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+      if (rest_rows.empty()) {
+        RETURN_IF_NOT_OK(child_iterator_->FetchNextTensorRow(&new_row));
+      } else {
+        new_row = std::move(rest_rows);
+      }
     }
     // Reminder logic, execute only when there is a remainder (table is non empty) and don't drop
     if (drop_ == false && table->empty() == false) {
@@ -123,6 +145,7 @@ Status BatchOp::operator()() {
       cnt++;
     }
     table = std::make_unique<TensorQTable>();  // this drops when drop == true
+    table_rows = 0;
     // end of the current epoch, batch_num should start from 0 again
     batch_num = 0;
     epoch_num++;
@@ -165,7 +188,7 @@ void BatchOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *dest, dsize_t batch_size,
-                          bool concat_batch) {
+                          bool concat_batch, const std::shared_ptr<MemoryPool> &pool) {
   RETURN_UNEXPECTED_IF_NULL(src);
   RETURN_UNEXPECTED_IF_NULL(dest);
   if ((*src)->size() != batch_size) {
@@ -188,7 +211,7 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
   auto num_columns = (*src)->front().size();
   for (size_t i = 0; i < num_columns; i++) {
     std::shared_ptr<Tensor> new_tensor;
-    RETURN_IF_NOT_OK(ConvertRowsToTensor(src, &new_tensor, batch_size, i));
+    RETURN_IF_NOT_OK(ConvertRowsToTensor(src, &new_tensor, batch_size, i, pool));
     dest->emplace_back(new_tensor);
   }
 
@@ -196,7 +219,7 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
 }
 
 Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, std::shared_ptr<Tensor> *dst,
-                                    dsize_t batch_size, size_t col) {
+                                    dsize_t batch_size, size_t col, const std::shared_ptr<MemoryPool> &pool) {
   RETURN_UNEXPECTED_IF_NULL(src);
   RETURN_UNEXPECTED_IF_NULL(dst);
   std::shared_ptr<Tensor> first_tensor = (*src)->at(0).at(col);  // first row, column i
@@ -206,7 +229,11 @@ Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, st
 
   std::shared_ptr<Tensor> new_tensor;
   if (first_type.IsNumeric()) {  // numeric tensor
-    RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+    if (pool != nullptr) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, pool, &new_tensor));
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+    }
     dsize_t j = 0;
     for (auto row : **src) {
       std::shared_ptr<Tensor> old_tensor = row.at(col);  // row j, column i
@@ -239,6 +266,64 @@ Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, st
   return Status::OK();
 }
 
+Status BatchOp::ConcatBlocks(const std::unique_ptr<TensorQTable> *src, TensorRow *dest,
+                             const std::shared_ptr<MemoryPool> &pool) {
+  RETURN_UNEXPECTED_IF_NULL(src);
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  CHECK_FAIL_RETURN_UNEXPECTED(!(*src)->empty(), "[Internal ERROR] Source table of row blocks is empty.");
+  if ((*src)->size() == 1) {
+    // the columns of a single block are the columns of the batch already
+    *dest = std::move((*src)->front());
+    (*src)->pop_front();
+    dest->setBlockSize(0);
+    return Status::OK();
+  }
+  dsize_t batch_size = 0;
+  for (const auto &block : **src) {
+    batch_size += block.getBlockSize();
+  }
+  const TensorRow &first_block = (*src)->front();
+  TensorRow batched_row;
+  for (size_t col = 0; col < first_block.size(); col++) {
+    DataType first_type = first_block.at(col)->type();
+    TensorShape new_shape({batch_size});
+    std::shared_ptr<Tensor> new_tensor;
+    if (first_type.IsNumeric()) {
+      if (pool != nullptr) {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, pool, &new_tensor));
+      } else {
+        RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+      }
+      dsize_t offset = 0;
+      for (const auto &block : **src) {
+        std::shared_ptr<Tensor> old_tensor = block.at(col);
+        CHECK_FAIL_RETURN_UNEXPECTED(old_tensor->type() == first_type && old_tensor->Rank() == 1,
+                                     "[Internal ERROR] Inconsistent row blocks in column " + std::to_string(col) +
+                                       ", expected 1-D tensors of type " + first_type.ToString() +
+                                       ", got type: " + old_tensor->type().ToString() +
+                                       ", rank: " + std::to_string(old_tensor->Rank()));
+        if (old_tensor->Size() > 0) {
+          RETURN_IF_NOT_OK(new_tensor->InsertTensor({offset}, old_tensor, true));
+        }
+        offset += old_tensor->Size();
+      }
+    } else {  // handle string column differently
+      std::vector<std::string> strings;
+      strings.reserve(batch_size);
+      for (const auto &block : **src) {
+        std::shared_ptr<Tensor> old_tensor = block.at(col);
+        for (auto itr = old_tensor->begin<std::string_view>(); itr != old_tensor->end<std::string_view>(); ++itr) {
+          strings.emplace_back(*itr);
+        }
+      }
+      RETURN_IF_NOT_OK(Tensor::CreateFromVector(strings, new_shape, first_type, &new_tensor));
+    }
+    batched_row.emplace_back(std::move(new_tensor));
+  }
+  *dest = std::move(batched_row);
+  return Status::OK();
+}
+
 Status BatchOp::WorkerEntry(int32_t workerId) {
   TaskManager::FindMe()->Post();
   std::pair<std::unique_ptr<TensorQTable>, CBatchInfo> table_pair;
@@ -263,6 +348,18 @@ Status BatchOp::WorkerEntry(int32_t workerId) {
 Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchInfo> table_pair, TensorRow *new_row) {
   RETURN_UNEXPECTED_IF_NULL(table_pair.first);
   bool concat_batch = false;
+  // a batch enters the op with its first row, for row tracing
+  uint64_t timestamp = table_pair.first->empty() ? 0 : table_pair.first->front().getTimestamp();
+  if (!table_pair.first->empty() && table_pair.first->front().getBlockSize() > 0) {
+    // RowBlockPass only lets row blocks into a batch without padding or per batch map
+    CHECK_FAIL_RETURN_UNEXPECTED(!pad_, "[Internal ERROR] Row blocks can not be padded in batch.");
+#ifdef ENABLE_PYTHON
+    CHECK_FAIL_RETURN_UNEXPECTED(!batch_map_func_, "[Internal ERROR] Row blocks can not be mapped in batch.");
+#endif
+    RETURN_IF_NOT_OK(ConcatBlocks(&table_pair.first, new_row, batch_buffer_pool_));
+    new_row->setTimestamp(timestamp);
+    return Status::OK();
+  }
 #ifdef ENABLE_PYTHON
   if (batch_map_func_) {
     RETURN_IF_NOT_OK(MapColumns(&table_pair, &concat_batch));
@@ -271,7 +368,9 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
-  RETURN_IF_NOT_OK(BatchRows(&table_pair.first, new_row, table_pair.first->size(), concat_batch));
+  RETURN_IF_NOT_OK(
+    BatchRows(&table_pair.first, new_row, table_pair.first->size(), concat_batch, batch_buffer_pool_));
+  new_row->setTimestamp(timestamp);
   return Status::OK();
 }
 
@@ -318,8 +417,8 @@ Status BatchOp::MapColumns(std::pair<std::unique_ptr<TensorQTable>, CBatchInfo>
       size_t col_id = column_name_id_map_[itr.first];
       if (*concat_batch) {
         std::shared_ptr<Tensor> new_tensor;
-        RETURN_IF_NOT_OK(
-          ConvertRowsToTensor(&in_q_table, &new_tensor, in_q_table->size(), static_cast<size_t>(itr.second)));
+        RETURN_IF_NOT_OK(ConvertRowsToTensor(&in_q_table, &new_tensor, in_q_table->size(),
+                                             static_cast<size_t>(itr.second), batch_buffer_pool_));
         (*out_q_table)[0][col_id] = std::move(new_tensor);
       } else {
         for (size_t i = 0; i < num_rows; i++) {
@@ -686,7 +785,7 @@ Status BatchOp::GetNextRowPullMode(TensorRow *const row) {
     RETURN_IF_NOT_OK(PadColumns(&table, pad_info_, column_name_id_map_));
   }  // do padding if needed
   if (!table->empty()) {
-    RETURN_IF_NOT_OK(BatchRows(&table, row, table->size()));
+    RETURN_IF_NOT_OK(BatchRows(&table, row, table->size(), false, batch_buffer_pool_));
     batch_cnt_++;
     batch_num_++;
   }
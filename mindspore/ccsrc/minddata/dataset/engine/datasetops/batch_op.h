@@ -31,6 +31,7 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
+#include "minddata/dataset/util/memory_pool.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
@@ -198,18 +199,28 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   // @param const std::unique_ptr<TensorQTable> *dest - dest_table to hold batched rows
   // @param int32_t size - batch_size
   // @param const std::unordered_map<std::string, int32_t>& column_name_id_map - column names to index mapping
+  // @param const std::shared_ptr<MemoryPool> &pool - memory pool of the batched numeric tensors, global pool if null
   // @return Status The status code returned
   static Status BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *dest, dsize_t batch_size,
-                          bool concat_batch = false);
+                          bool concat_batch = false, const std::shared_ptr<MemoryPool> &pool = nullptr);
 
   // convert the rows to tensor
   // @param const std::unique_ptr<TensorQTable> *src - table that has the rows for batching
   // @param const std::unique_ptr<TensorQTable> *dst - dest_table to hold batched rows
   // @param int32_t size - batch_size
   // @param int32_t size - col
+  // @param const std::shared_ptr<MemoryPool> &pool - memory pool of the batched numeric tensor, global pool if null
   // @return Status The status code returned
   static Status ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, std::shared_ptr<Tensor> *dst,
-                                    dsize_t batch_size, size_t col);
+                                    dsize_t batch_size, size_t col, const std::shared_ptr<MemoryPool> &pool = nullptr);
+
+  // batch the row blocks in src table by concatenating their columns
+  // @param const std::unique_ptr<TensorQTable> *src - table that has the row blocks for batching
+  // @param TensorRow *dest - the batched row
+  // @param const std::shared_ptr<MemoryPool> &pool - memory pool of the batched numeric tensors, global pool if null
+  // @return Status The status code returned
+  static Status ConcatBlocks(const std::unique_ptr<TensorQTable> *src, TensorRow *dest,
+                             const std::shared_ptr<MemoryPool> &pool = nullptr);
 
   // @param table
   // @param const PadInfo &pad_info pad info
@@ -300,6 +311,7 @@ class BatchOp : public ParallelOp<std::pair<std::unique_ptr<TensorQTable>, CBatc
   std::unordered_map<std::string, int32_t> child_map_;  // col_name_id_map of the child node
   int64_t batch_num_;
   int64_t batch_cnt_;
+  std::shared_ptr<MemoryPool> batch_buffer_pool_;       // recycles the buffers of batches released downstream
 #ifdef ENABLE_PYTHON
   py::function batch_size_func_;  // Function pointer of batch size function
   py::function batch_map_func_;   // Function pointer of per batch map function
@@ -78,6 +78,14 @@ Status CacheBase::FetchSamplesToWorkers() {
     RETURN_IF_NOT_OK(qList[worker_id]->Add(std::move(blk)));
     return Status::OK();
   };
+  // Tell the server which rows are coming before the prefetchers can ask for them, so it can start reading the
+  // spilled ones back from disk. The hint is not waited for.
+  auto hint_server = [this](const std::vector<row_id_type> &keys) -> Status {
+    if (cache_client_->isSpill()) {
+      RETURN_IF_NOT_OK(cache_client_->PrefetchRows(keys));
+    }
+    return Status::OK();
+  };
   // Instead of sending sampler id to WorkerEntry, we send them to the Prefetcher which will redirect them
   // to the WorkerEntry.
   do {
@@ -101,6 +109,7 @@ Status CacheBase::FetchSamplesToWorkers() {
         prefetch_keys.push_back(*itr);
         // Batch enough rows for performance reason.
         if (row_cnt_ % prefetch_size_ == 0) {
+          RETURN_IF_NOT_OK(hint_server(prefetch_keys));
           RETURN_IF_NOT_OK(send_to_que(prefetch_queues_, prefetch_cnt++ % num_prefetchers_, prefetch_keys));
           // Now we tell the WorkerEntry to wait for them to come back.
           for (auto row_id : prefetch_keys) {
@@ -115,6 +124,7 @@ Status CacheBase::FetchSamplesToWorkers() {
     }
     // Deal with any partial keys left.
     if (!prefetch_keys.empty()) {
+      RETURN_IF_NOT_OK(hint_server(prefetch_keys));
       RETURN_IF_NOT_OK(send_to_que(prefetch_queues_, prefetch_cnt++ % num_prefetchers_, prefetch_keys));
       for (auto row_id : prefetch_keys) {
         keys.push_back(row_id);
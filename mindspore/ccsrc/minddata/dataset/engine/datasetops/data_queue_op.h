@@ -75,6 +75,14 @@ class DataQueueOp : public PipelineOp {
 
   void StopWaiting() { ascend_keep_waiting_ = false; }
 
+  /// \brief Getter function
+  /// \return type of the device this op sends data to
+  DeviceType device_type() const { return device_type_; }
+
+  /// \brief Getter function
+  /// \return id of the device this op sends data to
+  int32_t device_id() const { return device_id_; }
+
   Status ClearDevice();
 
   Status GetDataInfo(DATA_INFO *data_info);
@@ -27,6 +27,9 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 
 #include "minddata/dataset/engine/operator_connector.h"
+#ifndef ENABLE_SECURITY
+#include "minddata/dataset/engine/perf/row_tracing.h"
+#endif
 #include "minddata/dataset/util/log_adapter.h"
 #ifndef ENABLE_ANDROID
 #include "utils/system/crc32c.h"
@@ -216,6 +219,7 @@ void DatasetOp::CreateConnector() {
   MS_LOG(DEBUG) << "Creating connector in tree operator: " << operator_id_ << ".";
   if (oc_queue_size_ > 0) {
     out_connector_ = std::make_unique<OperatorConnector>(oc_queue_size_);
+    out_connector_->SetRowTimestamp(row_tracing_ != nullptr);
   } else {
     // Some op's may choose not to have an output connector
     MS_LOG(DEBUG) << "Bypassed connector creation for tree operator: " << operator_id_ << ".";
@@ -259,11 +263,26 @@ Status DatasetOp::GetNextRowPullMode(TensorRow *const row) {
   return child_[0]->GetNextRowPullMode(row);
 }
 
+void DatasetOp::SetRowTracing(std::shared_ptr<RowTracing> row_tracing) {
+  row_tracing_ = std::move(row_tracing);
+  if (out_connector_ != nullptr) {
+    out_connector_->SetRowTimestamp(row_tracing_ != nullptr);
+  }
+}
+
 // Gets the next row from the given child
 Status DatasetOp::GetNextRow(TensorRow *row) {
   RETURN_UNEXPECTED_IF_NULL(row);
   // pop is a blocked call and will throw an interruption if the whole group shuts down.
   RETURN_IF_NOT_OK(out_connector_->PopFront(row));
+#ifndef ENABLE_SECURITY
+  if (row_tracing_ != nullptr && row->Flags() == TensorRow::kFlagNone) {
+    // the row leaves this op and enters the parent
+    uint64_t now = ProfilingTime::GetCurMicroSecond();
+    row_tracing_->Record(operator_id_, row->getTimestamp(), now);
+    row->setTimestamp(now);
+  }
+#endif
   return Status::OK();
 }
 
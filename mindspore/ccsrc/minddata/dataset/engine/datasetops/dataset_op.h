@@ -63,6 +63,8 @@ class NodePass;
 
 class SamplerRT;
 
+class RowTracing;
+
 // \brief The base class DatasetOp is the main tree node.  It is an abstract class, so
 // the actual implementation of the operators will be derived from here.
 class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
@@ -245,6 +247,10 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
 
   OperatorConnector *OutputConnector() const { return out_connector_.get(); }
 
+  // \brief Setter function, rows which leave the op are recorded in the row tracing from then on
+  // \param[in] row_tracing The row tracing node of the profiler
+  void SetRowTracing(std::shared_ptr<RowTracing> row_tracing);
+
   // \brief Getter function
   // \return connector size of current op
   int32_t ConnectorSize() const {
@@ -387,6 +393,7 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   int32_t op_current_repeats_;                                   // Current number of repeats the operator has handled
   int32_t op_current_epochs_;                                    // Current number of epochs the operator has handled
   std::unique_ptr<OperatorConnector> out_connector_;             // Output Connector
+  std::shared_ptr<RowTracing> row_tracing_;                      // Records the latency of the rows, may be null
   std::unordered_map<std::string, int32_t> column_name_id_map_;  // Mapping between col index and col name
   std::mutex column_name_map_mutex_;                             // For protecting shared access to the column map
   CallbackManager callback_manager_;                             // Manages callbacks associated with a DatasetOp
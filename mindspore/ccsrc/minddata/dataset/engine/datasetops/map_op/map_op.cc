@@ -209,6 +209,11 @@ Status MapOp::WorkerEntry(int32_t worker_id) {
       RETURN_IF_NOT_OK(worker_out_queues_[worker_id]->EmplaceBack(std::move(in_row)));
     } else {
       CHECK_FAIL_RETURN_UNEXPECTED(in_row.size() != 0, "[Internal ERROR] MapOp got an empty TensorRow.");
+      // RowBlockPass only lets row blocks into a map of elementwise operations, which apply to a column at once
+      CHECK_FAIL_RETURN_UNEXPECTED(in_row.getBlockSize() == 0 ||
+                                     std::all_of(tfuncs_[worker_id].begin(), tfuncs_[worker_id].end(),
+                                                 [](const auto &op) { return op->Elementwise(); }),
+                                   "[Internal ERROR] MapOp got a row block for operations which are not elementwise.");
       TensorRow out_row;
       // Perform the compute function of TensorOp(s) and store the result in new_tensor_table.
       RETURN_IF_NOT_OK(WorkerCompute(in_row, &out_row, job_list));
@@ -283,6 +288,9 @@ Status MapOp::WorkerCompute(const TensorRow &in_row, TensorRow *out_row,
     }
     *out_row = std::move(result_table[0]);
   }
+  // the row is still the one which entered the op, for row tracing
+  out_row->setTimestamp(in_row.getTimestamp());
+  out_row->setBlockSize(in_row.getBlockSize());
 
   return Status::OK();
 }
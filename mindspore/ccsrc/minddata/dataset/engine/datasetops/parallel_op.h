@@ -22,6 +22,8 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/execution_tree.h"
@@ -47,7 +49,8 @@ class ParallelOp : public DatasetOp {
         epoch_sync_flag_(false),
         num_workers_(num_workers),
         next_worker_id_(0),
-        worker_connector_size_(op_connector_size) {
+        worker_connector_size_(op_connector_size),
+        lock_free_worker_queues_(GlobalContext::config_manager()->enable_lock_free_queue()) {
     // reduce excessive memory usage with high parallelism
     constexpr int32_t worker_limit = 4;
     if (num_workers_ > worker_limit) {
@@ -146,8 +149,10 @@ class ParallelOp : public DatasetOp {
   /// \return Status The status code returned
   virtual Status RegisterAndLaunchThreads() {
     RETURN_UNEXPECTED_IF_NULL(tree_);
-    worker_in_queues_.Init(num_workers_, worker_connector_size_);
-    worker_out_queues_.Init(num_workers_, worker_connector_size_);
+    // Every worker queue has a single producer and a single consumer: the main thread feeds worker_in_queues_ and
+    // only the Collector drains worker_out_queues_, so both lists can use the lock free mode.
+    worker_in_queues_.Init(num_workers_, worker_connector_size_, lock_free_worker_queues_);
+    worker_out_queues_.Init(num_workers_, worker_connector_size_, lock_free_worker_queues_);
 
     // Registers QueueList and individual Queues for interrupt services
     RETURN_IF_NOT_OK(worker_in_queues_.Register(tree_->AllTasks()));
@@ -230,6 +235,9 @@ class ParallelOp : public DatasetOp {
 
   /// The size of input/output worker queeus
   int32_t worker_connector_size_;
+  /// Whether the worker queues are single-producer single-consumer lock free queues. Derived ops which feed or drain
+  /// the worker queues from more than one thread must reset it before RegisterAndLaunchThreads
+  bool lock_free_worker_queues_;
   /// queues to hold the input rows to workers
   QueueList<T> worker_in_queues_;
   /// queues to hold the output from workers
@@ -66,6 +66,7 @@ TensorRow ProjectOp::Project(const TensorRow &row) {
   // Now if columns changed after map, we don't know which column we should keep,
   // so temporarily we don't support print file_path after ProjectOp.
   new_row.setPath({});
+  new_row.setBlockSize(row.getBlockSize());
   return new_row;
 }
 
@@ -323,6 +323,11 @@ Status CocoOp::SearchNodeInJson(const nlohmann::json &input_tree, std::string no
 }
 
 Status CocoOp::PrepareData() {
+  SourceSnapshot snapshot(Name(), nlohmann::json::array({annotation_path_, static_cast<int32_t>(task_type_)}).dump());
+  if (LoadSnapshot(snapshot)) {
+    num_rows_ = image_ids_.size();
+    return Status::OK();
+  }
   nlohmann::json js;
   try {
     auto realpath = FileUtils::GetRealPath(annotation_path_.c_str());
@@ -404,9 +409,51 @@ Status CocoOp::PrepareData() {
     "Invalid data, 'CocoDataset' API can't read the data file (interface mismatch or no data found). "
     "Check file in directory: " +
       image_folder_path_ + ".");
+  if (snapshot.Enabled()) {
+    SaveSnapshot(snapshot);
+  }
   return Status::OK();
 }
 
+bool CocoOp::LoadSnapshot(const SourceSnapshot &snapshot) {
+  nlohmann::json index;
+  if (!snapshot.Load(&index)) {
+    return false;
+  }
+  try {
+    image_ids_ = index.at("image_ids").get<std::vector<std::string>>();
+    label_index_ = index.at("label_index").get<std::vector<std::pair<std::string, std::vector<int32_t>>>>();
+    coordinate_map_ = index.at("coordinate_map").get<std::map<std::string, CoordinateRow>>();
+    simple_item_map_ = index.at("simple_item_map").get<std::map<std::string, std::vector<uint32_t>>>();
+    captions_map_ = index.at("captions_map").get<std::map<std::string, std::vector<std::string>>>();
+  } catch (const std::exception &err) {
+    MS_LOG(WARNING) << "Ignore the broken snapshot of CocoDataset annotation file: " << annotation_path_ << ", "
+                    << err.what();
+    image_ids_.clear();
+    label_index_.clear();
+    coordinate_map_.clear();
+    simple_item_map_.clear();
+    captions_map_.clear();
+    return false;
+  }
+  return !image_ids_.empty();
+}
+
+void CocoOp::SaveSnapshot(const SourceSnapshot &snapshot) const {
+  // only the tables read by LoadTensorRow and GetClassIndexing are kept, the rest is only used while parsing
+  nlohmann::json index;
+  index["image_ids"] = image_ids_;
+  index["label_index"] = label_index_;
+  index["coordinate_map"] = coordinate_map_;
+  index["simple_item_map"] = simple_item_map_;
+  index["captions_map"] = captions_map_;
+  Status rc = snapshot.Save({annotation_path_}, index);
+  if (rc.IsError()) {
+    MS_LOG(WARNING) << "Failed to save the snapshot of CocoDataset annotation file: " << annotation_path_ << ", "
+                    << rc.GetErrDescription();
+  }
+}
+
 Status CocoOp::ImageColumnLoad(const nlohmann::json &image_tree, std::vector<std::string> *image_vec) {
   if (image_tree.empty()) {
     RETURN_STATUS_UNEXPECTED("Invalid annotation, the 'image' node is missing in annotation file: " + annotation_path_ +
@@ -29,6 +29,7 @@
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+#include "minddata/dataset/engine/datasetops/source/source_snapshot.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/kernels/image/image_utils.h"
 #else
@@ -253,6 +254,15 @@ class CocoOp : public MappableLeafOp {
   /// \return Status The status code returned.
   Status PrepareData() override;
 
+  /// \brief Restore the parsed annotations from the snapshot saved by a previous launch.
+  /// \param[in] snapshot Snapshot of the annotation file and the task type.
+  /// \return bool True if the snapshot is loaded.
+  bool LoadSnapshot(const SourceSnapshot &snapshot);
+
+  /// \brief Save the parsed annotations, so that the next launch does not parse the annotation file.
+  /// \param[in] snapshot Snapshot of the annotation file and the task type.
+  void SaveSnapshot(const SourceSnapshot &snapshot) const;
+
   /// \param[in] image_tree Image tree of json.
   /// \param[out] image_vec Image id list of json.
   /// \return Status The status code returned.
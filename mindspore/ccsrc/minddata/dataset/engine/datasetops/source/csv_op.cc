@@ -16,9 +16,15 @@
 #include "minddata/dataset/engine/datasetops/source/csv_op.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <stdexcept>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 #include "utils/file_utils.h"
 #include "minddata/dataset/core/config_manager.h"
@@ -28,15 +34,80 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+constexpr int kSimdWidth = 16;
+
+// Find the first occurrence of any of the 4 characters in [begin, end), or end if there is none.
+// It compares 16 chars at a time with SSE2 on x86 and NEON on aarch64, both are always available on these platforms.
+const char *FindFirstOf(const char *begin, const char *end, char c0, char c1, char c2, char c3) {
+  const char *p = begin;
+#if defined(__SSE2__)
+  const __m128i v0 = _mm_set1_epi8(c0);
+  const __m128i v1 = _mm_set1_epi8(c1);
+  const __m128i v2 = _mm_set1_epi8(c2);
+  const __m128i v3 = _mm_set1_epi8(c3);
+  for (; end - p >= kSimdWidth; p += kSimdWidth) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, v0), _mm_cmpeq_epi8(chunk, v1)),
+                              _mm_or_si128(_mm_cmpeq_epi8(chunk, v2), _mm_cmpeq_epi8(chunk, v3)));
+    int mask = _mm_movemask_epi8(eq);
+    if (mask != 0) {
+      return p + __builtin_ctz(static_cast<unsigned int>(mask));
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  const uint8x16_t v0 = vdupq_n_u8(static_cast<uint8_t>(c0));
+  const uint8x16_t v1 = vdupq_n_u8(static_cast<uint8_t>(c1));
+  const uint8x16_t v2 = vdupq_n_u8(static_cast<uint8_t>(c2));
+  const uint8x16_t v3 = vdupq_n_u8(static_cast<uint8_t>(c3));
+  for (; end - p >= kSimdWidth; p += kSimdWidth) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t *>(p));
+    uint8x16_t eq = vorrq_u8(vorrq_u8(vceqq_u8(chunk, v0), vceqq_u8(chunk, v1)),
+                             vorrq_u8(vceqq_u8(chunk, v2), vceqq_u8(chunk, v3)));
+    if (vmaxvq_u8(eq) != 0) {
+      break;
+    }
+  }
+#endif
+  for (; p < end; ++p) {
+    if (*p == c0 || *p == c1 || *p == c2 || *p == c3) {
+      return p;
+    }
+  }
+  return end;
+}
+
+// Find the next quote in [begin, end), or end if there is none.
+const char *FindQuote(const char *begin, const char *end) {
+  const void *quote = memchr(begin, '"', static_cast<size_t>(end - begin));
+  return quote == nullptr ? end : static_cast<const char *>(quote);
+}
+}  // namespace
+
+int32_t CsvOp::CountFileSplits(const std::vector<std::string> &files, int64_t split_size) {
+  int64_t num_splits = 0;
+  for (const auto &file : files) {
+    num_splits++;
+    auto realpath = FileUtils::GetRealPath(file.c_str());
+    if (realpath.has_value()) {
+      std::ifstream ifs(realpath.value(), std::ios::binary | std::ios::ate);
+      if (ifs.is_open()) {
+        num_splits += static_cast<int64_t>(ifs.tellg()) / split_size;
+      }
+    }
+  }
+  return static_cast<int32_t>(std::min<int64_t>(num_splits, std::numeric_limits<int32_t>::max()));
+}
 
 CsvOp::CsvOp(const std::vector<std::string> &csv_files_list, char field_delim,
              const std::vector<std::shared_ptr<BaseRecord>> &column_default,
              const std::vector<std::string> &column_name, int32_t num_workers, int64_t num_samples,
              int32_t worker_connector_size, int32_t op_connector_size, bool shuffle_files, int32_t num_devices,
-             int32_t device_id)
-    : NonMappableLeafOp(std::min(num_workers, static_cast<int32_t>(csv_files_list.size())), worker_connector_size,
+             int32_t device_id, int64_t split_size)
+    : NonMappableLeafOp(std::min(num_workers, CountFileSplits(csv_files_list, split_size)), worker_connector_size,
                         num_samples, op_connector_size, shuffle_files, num_devices, device_id),
       csv_files_list_(std::move(csv_files_list)),
+      split_size_(split_size),
       field_delim_(field_delim),
       column_default_list_(column_default),
       column_name_list_(column_name) {}
@@ -64,8 +135,21 @@ CsvOp::CsvParser::CsvParser(int32_t worker_id, JaggedConnector *connector, char
       total_rows_(0),
       start_offset_(0),
       end_offset_(std::numeric_limits<int64_t>::max()),
+      split_size_(std::numeric_limits<int64_t>::max()),
+      last_split_offset_(0),
       err_message_("unknown"),
-      file_path_(std::move(file_path)) {}
+      file_path_(std::move(file_path)),
+      block_size_(0),
+      block_rows_(0) {}
+
+void CsvOp::CsvParser::SetBlockSize(int64_t block_size) {
+  block_size_ = block_size;
+  block_rows_ = 0;
+  size_t num_columns = block_size > 0 ? column_default_.size() : 0;
+  int_columns_.assign(num_columns, {});
+  float_columns_.assign(num_columns, {});
+  string_columns_.assign(num_columns, {});
+}
 
 void CsvOp::CsvParser::Reset() {
   cur_state_ = START_OF_FILE;
@@ -89,15 +173,46 @@ CsvOp::CsvParser::Message CsvOp::CsvParser::GetMessage(int c) {
 
 int CsvOp::CsvParser::ProcessMessage(int c) {
   Message m = GetMessage(c);
-  StateDiagram::iterator it = sd.find({cur_state_, m});
-  if (it == sd.end()) {
+  const StateActionPair &action = sd_table_[cur_state_ * kNumMessages + m];
+  if (!action.second) {
     return -1;
   }
-  int ret = it->second.second(*this, c);
-  cur_state_ = it->second.first;
+  int ret = action.second(*this, c);
+  cur_state_ = action.first;
   return ret;
 }
 
+int CsvOp::CsvParser::ProcessBuffer(const char *buf, size_t len) {
+  const char *end = buf + len;
+  const char *p = buf;
+  while (p < end) {
+    // ordinary chars in a field only go to the string buffer, so they are copied at once
+    const char *next = p;
+    if (cur_state_ == State::UNQUOTE) {
+      next = FindFirstOf(p, end, csv_field_delim_, '"', '\r', '\n');
+    } else if (cur_state_ == State::QUOTE) {
+      next = FindQuote(p, end);
+    }
+    if (next > p) {
+      size_t num = static_cast<size_t>(next - p);
+      if (pos_ + num > str_buf_.size()) {
+        str_buf_.resize(std::max(str_buf_.size() * 2, pos_ + num));
+      }
+      (void)std::copy(p, next, str_buf_.begin() + pos_);
+      pos_ += num;
+      p = next;
+      continue;
+    }
+    // chars are passed as they are returned by ifstream::get(), so they never equal eof
+    int ret = ProcessMessage(static_cast<unsigned char>(*p));
+    if (ret != 0) {
+      return ret;
+    }
+    ++p;
+  }
+  return 0;
+}
+
 int CsvOp::CsvParser::PutChar(int c) {
   if (pos_ >= str_buf_.size()) {
     str_buf_.resize(str_buf_.size() * 2);
@@ -108,6 +223,12 @@ int CsvOp::CsvParser::PutChar(int c) {
 }
 
 int CsvOp::CsvParser::PutRecord(int c) {
+  // the fields of rows out of range are dropped by PutRow anyway, so don't convert them
+  if (total_rows_ < start_offset_ || total_rows_ >= end_offset_) {
+    pos_ = 0;
+    cur_col_++;
+    return 0;
+  }
   std::string s = std::string(str_buf_.begin(), str_buf_.begin() + pos_);
   std::shared_ptr<Tensor> t;
   if (cur_col_ >= column_default_.size()) {
@@ -118,6 +239,23 @@ int CsvOp::CsvParser::PutRecord(int c) {
     err_message_ = ss.str();
     return -1;
   }
+  if (block_size_ > 0) {
+    // the values are kept by column until the row block is full
+    switch (column_default_[cur_col_]->type) {
+      case CsvOp::INT:
+        int_columns_[cur_col_].push_back(std::stoi(s));
+        break;
+      case CsvOp::FLOAT:
+        float_columns_[cur_col_].push_back(std::stof(s));
+        break;
+      default:
+        string_columns_[cur_col_].push_back(std::move(s));
+        break;
+    }
+    pos_ = 0;
+    cur_col_++;
+    return 0;
+  }
   Status rc;
   switch (column_default_[cur_col_]->type) {
     case CsvOp::INT:
@@ -185,7 +323,48 @@ int CsvOp::CsvParser::PutRow(int c) {
   total_rows_++;
   cur_col_ = 0;
 
-  Status s = rows_connector_->Add(worker_id_, std::move(cur_row_));
+  if (block_size_ > 0) {
+    block_rows_++;
+    return block_rows_ < block_size_ ? 0 : PutBlock();
+  }
+  return SendRow(std::move(cur_row_));
+}
+
+int CsvOp::CsvParser::PutBlock() {
+  if (block_rows_ == 0) {
+    return 0;
+  }
+  TensorRow block(column_default_.size(), nullptr);
+  for (size_t i = 0; i < column_default_.size(); i++) {
+    Status rc;
+    switch (column_default_[i]->type) {
+      case CsvOp::INT:
+        rc = Tensor::CreateFromVector(int_columns_[i], &block[i]);
+        int_columns_[i].clear();
+        break;
+      case CsvOp::FLOAT:
+        rc = Tensor::CreateFromVector(float_columns_[i], &block[i]);
+        float_columns_[i].clear();
+        break;
+      default:
+        rc = Tensor::CreateFromVector(string_columns_[i], TensorShape({block_rows_}), &block[i]);
+        string_columns_[i].clear();
+        break;
+    }
+    if (rc.IsError()) {
+      err_message_ = rc.ToString();
+      return -1;
+    }
+  }
+  std::vector<std::string> file_path(column_default_.size(), file_path_);
+  block.setPath(file_path);
+  block.setBlockSize(block_rows_);
+  block_rows_ = 0;
+  return SendRow(std::move(block));
+}
+
+int CsvOp::CsvParser::SendRow(TensorRow &&row) {
+  Status s = rows_connector_->Add(worker_id_, std::move(row));
   if (s.IsError()) {
     err_message_ = s.ToString();
     // if error type is interrupted, return error code -2
@@ -199,6 +378,16 @@ int CsvOp::CsvParser::PutRow(int c) {
   return 0;
 }
 
+void CsvOp::CsvParser::NewRow() {
+  if (block_size_ > 0) {
+    return;
+  }
+  TensorRow row(column_default_.size(), nullptr);
+  std::vector<std::string> file_path(column_default_.size(), file_path_);
+  row.setPath(file_path);
+  cur_row_ = std::move(row);
+}
+
 int CsvOp::CsvParser::AddRow(int c) {
   total_rows_++;
   return 0;
@@ -234,18 +423,58 @@ int CsvOp::CsvParser::CountRows(int c) {
   } else {
     m = Message::MS_NORMAL;
   }
-  StateDiagram::iterator it = sdl.find({cur_state_, m});
-  if (it == sdl.end()) {
+  const StateActionPair &action = sdl_table_[cur_state_ * kNumMessages + m];
+  if (!action.second) {
     return -1;
   }
-  cur_state_ = it->second.first;
-  return it->second.second(*this, c);
+  cur_state_ = action.first;
+  return action.second(*this, c);
+}
+
+int CsvOp::CsvParser::CountRowsInBuffer(const char *buf, size_t len, int64_t offset) {
+  const char *end = buf + len;
+  const char *p = buf;
+  while (p < end) {
+    // only quotes and line ends change the state while counting, skip everything else
+    if (cur_state_ == State::QUOTE) {
+      p = FindQuote(p, end);
+    } else if (cur_state_ == State::UNQUOTE) {
+      p = FindFirstOf(p, end, '"', '\r', '\n', '\n');
+    }
+    if (p == end) {
+      break;
+    }
+    int64_t rows = total_rows_;
+    int ret = CountRows(static_cast<unsigned char>(*p));
+    if (ret != 0) {
+      return ret;
+    }
+    ++p;
+    // a row ended at this char, the next row starts at a clean state
+    int64_t next_offset = offset + (p - buf);
+    if (total_rows_ > rows && next_offset - last_split_offset_ >= split_size_) {
+      split_points_.emplace_back(total_rows_, next_offset);
+      last_split_offset_ = next_offset;
+    }
+  }
+  return 0;
+}
+
+CsvOp::CsvParser::StateTable CsvOp::CsvParser::BuildStateTable(const StateDiagram &diagram) {
+  constexpr int kNumStates = static_cast<int>(State::EXCEPTION) + 1;
+  StateTable table(kNumStates * kNumMessages);
+  for (const auto &item : diagram) {
+    table[item.first.first * kNumMessages + item.first.second] = item.second;
+  }
+  return table;
 }
 
 Status CsvOp::CsvParser::InitCsvParser() {
   str_buf_.resize(CSV_BUFFER_SIZE);
   InitSDL();
   InitSD();
+  sdl_table_ = BuildStateTable(sdl);
+  sd_table_ = BuildStateTable(sd);
   return Status::OK();
 }
 
@@ -325,10 +554,7 @@ void CsvOp::CsvParser::InitSD() {
         {{State::START_OF_FILE, Message::MS_NORMAL},
          {State::UNQUOTE,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
-            row.setPath(file_path);
-            this->cur_row_ = std::move(row);
+            this->NewRow();
             this->str_buf_[0] = c;
             this->pos_ = 1;
             return 0;
@@ -336,19 +562,13 @@ void CsvOp::CsvParser::InitSD() {
         {{State::START_OF_FILE, Message::MS_DELIM},
          {State::DELIM,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
-            row.setPath(file_path);
-            this->cur_row_ = std::move(row);
+            this->NewRow();
             return this->PutRecord(c);
           }}},
         {{State::START_OF_FILE, Message::MS_QUOTE},
          {State::QUOTE,
           [this](CsvParser &, char c) -> int {
-            TensorRow row(column_default_.size(), nullptr);
-            std::vector<std::string> file_path(column_default_.size(), file_path_);
-            row.setPath(file_path);
-            this->cur_row_ = std::move(row);
+            this->NewRow();
             this->pos_ = 0;
             return 0;
           }}},
@@ -431,10 +651,7 @@ void CsvOp::CsvParser::InitSD() {
          {State::UNQUOTE,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
-              row.setPath(file_path);
-              this->cur_row_ = std::move(row);
+              this->NewRow();
             }
             this->str_buf_[0] = c;
             this->pos_ = 1;
@@ -444,10 +661,7 @@ void CsvOp::CsvParser::InitSD() {
          {State::DELIM,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
-              row.setPath(file_path);
-              this->cur_row_ = std::move(row);
+              this->NewRow();
             }
             return this->PutRecord(c);
           }}},
@@ -455,10 +669,7 @@ void CsvOp::CsvParser::InitSD() {
          {State::QUOTE,
           [this](CsvParser &, char c) -> int {
             if (this->total_rows_ > this->start_offset_ && this->total_rows_ <= this->end_offset_) {
-              TensorRow row(column_default_.size(), nullptr);
-              std::vector<std::string> file_path(column_default_.size(), file_path_);
-              row.setPath(file_path);
-              this->cur_row_ = std::move(row);
+              this->NewRow();
             }
             return 0;
           }}},
@@ -471,6 +682,7 @@ Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t en
   RETURN_IF_NOT_OK(csv_parser.InitCsvParser());
   csv_parser.SetStartOffset(start_offset);
   csv_parser.SetEndOffset(end_offset);
+  csv_parser.SetBlockSize(block_size_);
 
   auto realpath = FileUtils::GetRealPath(file.c_str());
   if (!realpath.has_value()) {
@@ -479,32 +691,62 @@ Status CsvOp::LoadFile(const std::string &file, int64_t start_offset, int64_t en
   }
 
   std::ifstream ifs;
-  ifs.open(realpath.value(), std::ifstream::in);
+  ifs.open(realpath.value(), std::ifstream::in | std::ifstream::binary);
   if (!ifs.is_open()) {
     RETURN_STATUS_UNEXPECTED("Invalid file, failed to open " + file + ", the file is damaged or permission denied.");
   }
-  if (column_name_list_.empty()) {
+  // start from the last split point before the range if there is one, otherwise from the beginning of the file
+  int64_t split_rows = 0;
+  int64_t split_offset = 0;
+  auto split_points = filename_split_points_.find(file);
+  if (split_points != filename_split_points_.end()) {
+    for (const auto &split_point : split_points->second) {
+      if (split_point.first > start_offset) {
+        break;
+      }
+      split_rows = split_point.first;
+      split_offset = split_point.second;
+    }
+  }
+  if (split_offset > 0) {
+    (void)ifs.seekg(split_offset);
+    csv_parser.SetTotalRows(split_rows);
+  } else if (column_name_list_.empty()) {
     std::string tmp;
     getline(ifs, tmp);
   }
   csv_parser.Reset();
+  auto check_error = [&file, &csv_parser](int err) -> Status {
+    if (err != 0) {
+      // if error code is -2, the returned error is interrupted
+      if (err == -2) {
+        return Status(kMDInterrupted);
+      }
+      RETURN_STATUS_UNEXPECTED("Invalid file, failed to parse csv file: " + file + " at line " +
+                               std::to_string(csv_parser.GetTotalRows() + 1) +
+                               ". Error message: " + csv_parser.GetErrorMessage());
+    }
+    return Status::OK();
+  };
   try {
-    while (ifs.good()) {
-      // when ifstream reaches the end of file, the function get() return std::char_traits<char>::eof()
-      // which is a 32-bit -1, it's not equal to the 8-bit -1 on Euler OS. So instead of char, we use
-      // int to receive its return value.
-      int chr = ifs.get();
-      int err = csv_parser.ProcessMessage(chr);
-      if (err != 0) {
-        // if error code is -2, the returned error is interrupted
-        if (err == -2) {
-          return Status(kMDInterrupted);
-        }
-        RETURN_STATUS_UNEXPECTED("Invalid file, failed to parse csv file: " + file + " at line " +
-                                 std::to_string(csv_parser.GetTotalRows() + 1) +
-                                 ". Error message: " + csv_parser.GetErrorMessage());
+    std::vector<char> buf(CSV_READ_SIZE);
+    while (csv_parser.GetTotalRows() < end_offset) {
+      (void)ifs.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+      auto len = static_cast<size_t>(ifs.gcount());
+      int err = csv_parser.ProcessBuffer(buf.data(), len);
+      if (err == 0 && len < buf.size()) {
+        // when ifstream reaches the end of file, the function get() return std::char_traits<char>::eof()
+        // which is a 32-bit -1, it's not equal to the 8-bit -1 on Euler OS. So instead of char, we use
+        // int to pass it.
+        err = csv_parser.ProcessMessage(std::char_traits<char>::eof());
+      }
+      RETURN_IF_NOT_OK(check_error(err));
+      if (len < buf.size()) {
+        break;
       }
     }
+    // the last rows of the range may not fill a row block
+    RETURN_IF_NOT_OK(check_error(csv_parser.PutBlock()));
   } catch (std::invalid_argument &ia) {
     std::string err_row = std::to_string(csv_parser.GetTotalRows() + 1);
     RETURN_STATUS_UNEXPECTED("Invalid csv, csv file: " + file + " parse failed at line " + err_row +
@@ -566,6 +808,23 @@ Status CsvOp::FillIOBlockQueue(const std::vector<int64_t> &i_keys) {
     }
     for (auto file_info : file_index) {
       if (NeedPushFileToBlockQueue(file_info.first, &start_offset, &end_offset, pre_count)) {
+        // a large file is cut at its split points, so its ranges are read by different workers
+        auto split_points = filename_split_points_.find(file_info.first);
+        if (split_points != filename_split_points_.end()) {
+          for (const auto &split_point : split_points->second) {
+            if (split_point.first <= start_offset) {
+              continue;
+            }
+            if (split_point.first >= end_offset) {
+              break;
+            }
+            auto ioBlock = std::make_unique<FilenameBlock>(file_info.second, start_offset, split_point.first,
+                                                           IOBlock::kDeIoBlockNone);
+            RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
+            queue_index = (queue_index + 1) % num_workers_;
+            start_offset = split_point.first;
+          }
+        }
         auto ioBlock =
           std::make_unique<FilenameBlock>(file_info.second, start_offset, end_offset, IOBlock::kDeIoBlockNone);
         RETURN_IF_NOT_OK(PushIoBlockQueue(queue_index, std::move(ioBlock)));
@@ -624,7 +883,7 @@ int64_t CsvOp::CountTotalRows(const std::string &file) {
   }
 
   std::ifstream ifs;
-  ifs.open(realpath.value(), std::ifstream::in);
+  ifs.open(realpath.value(), std::ifstream::in | std::ifstream::binary);
   if (!ifs.is_open()) {
     return 0;
   }
@@ -632,13 +891,22 @@ int64_t CsvOp::CountTotalRows(const std::string &file) {
     std::string tmp;
     getline(ifs, tmp);
   }
+  int64_t offset = static_cast<int64_t>(ifs.tellg());
   csv_parser.Reset();
-  while (ifs.good()) {
-    int chr = ifs.get();
-    if (csv_parser.CountRows(chr) != 0) {
+  csv_parser.SetSplitSize(split_size_);
+  std::vector<char> buf(CSV_READ_SIZE);
+  while (offset >= 0 && ifs.good()) {
+    (void)ifs.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+    auto len = static_cast<size_t>(ifs.gcount());
+    if (csv_parser.CountRowsInBuffer(buf.data(), len, offset) != 0) {
       break;
     }
+    offset += static_cast<int64_t>(len);
+    if (len < buf.size()) {
+      (void)csv_parser.CountRows(std::char_traits<char>::eof());
+    }
   }
+  filename_split_points_[file] = csv_parser.GetSplitPoints();
 
   return csv_parser.GetTotalRows();
 }
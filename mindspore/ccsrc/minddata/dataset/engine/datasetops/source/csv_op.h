@@ -33,6 +33,11 @@ namespace mindspore {
 namespace dataset {
 
 const size_t CSV_BUFFER_SIZE = 4096;
+// Size of each block read from a csv file.
+const size_t CSV_READ_SIZE = 1024 * 1024;
+// A large csv file is split into ranges of about this size, which are read by different workers, when the
+// enable_csv_split config is set.
+const int64_t CSV_SPLIT_SIZE = 16 * 1024 * 1024;
 using StringIndex = AutoIndexObj<std::string>;
 class JaggedConnector;
 
@@ -76,16 +81,49 @@ class CsvOp : public NonMappableLeafOp {
 
     void SetEndOffset(int64_t end_offset) { end_offset_ = end_offset; }
 
+    /// Set the number of rows before the position the parser starts from, used when it starts from a split point.
+    void SetTotalRows(int64_t total_rows) { total_rows_ = total_rows; }
+
+    /// Set the size of the ranges between the split points recorded while counting rows.
+    void SetSplitSize(int64_t split_size) { split_size_ = split_size; }
+
+    /// Set the number of rows of the row blocks to send, 0 to send plain rows.
+    void SetBlockSize(int64_t block_size);
+
+    /// Send the rows kept in the column buffers as a row block, it is called when block_size rows are parsed and
+    /// when the parsing stops.
+    /// @return int - 0 on success, otherwise the error code of PutRow.
+    int PutBlock();
+
     int ProcessMessage(int c);
 
+    /// Parse a block of the file. Runs of ordinary characters in a field are found by a vectorised scan and copied
+    /// at once, only delimiters, quotes and line ends go through the state diagram.
+    /// @param buf - the block.
+    /// @param len - the length of the block.
+    /// @return int - 0 on success, otherwise the error code of ProcessMessage.
+    int ProcessBuffer(const char *buf, size_t len);
+
     int CountRows(int c);
 
+    /// Count the rows in a block of the file, and record a split point at the first row boundary after every
+    /// split_size bytes.
+    /// @param buf - the block.
+    /// @param len - the length of the block.
+    /// @param offset - the offset of the block in the file.
+    /// @return int - 0 on success, otherwise the error code of CountRows.
+    int CountRowsInBuffer(const char *buf, size_t len, int64_t offset);
+
     Status InitCsvParser();
 
     int64_t GetTotalRows() { return total_rows_; }
 
     std::string GetErrorMessage() { return err_message_; }
 
+    /// Get the split points recorded by CountRowsInBuffer.
+    /// @return the (number of rows before, offset in file) pairs of the split points.
+    const std::vector<std::pair<int64_t, int64_t>> &GetSplitPoints() const { return split_points_; }
+
    private:
     enum State : uint8_t {
       START_OF_FILE = 0,
@@ -109,6 +147,10 @@ class CsvOp : public NonMappableLeafOp {
     typedef std::pair<State, Message> StateMessagePair;
     typedef std::pair<State, std::function<int(CsvParser &, int)>> StateActionPair;
     typedef std::map<StateMessagePair, StateActionPair> StateDiagram;
+    // The state diagram flattened into an array indexed by state and message, to avoid a map lookup for each char.
+    typedef std::vector<StateActionPair> StateTable;
+
+    static constexpr int kNumMessages = static_cast<int>(Message::MS_END_OF_FILE) + 1;
 
     Message GetMessage(int c);
 
@@ -124,12 +166,20 @@ class CsvOp : public NonMappableLeafOp {
 
     int AddRow(int c);
 
+    // Start a new row, in block mode the fields go to the column buffers instead.
+    void NewRow();
+
+    // Send a row or a row block to the connector.
+    int SendRow(TensorRow &&row);
+
     int CatchException(int c);
 
     void InitSDL();
 
     void InitSD();
 
+    static StateTable BuildStateTable(const StateDiagram &diagram);
+
     int32_t worker_id_;
     JaggedConnector *rows_connector_;
     const char csv_field_delim_;
@@ -142,10 +192,21 @@ class CsvOp : public NonMappableLeafOp {
     int64_t end_offset_;
     StateDiagram sd;
     StateDiagram sdl;
+    StateTable sd_table_;
+    StateTable sdl_table_;
+    int64_t split_size_;
+    int64_t last_split_offset_;
+    std::vector<std::pair<int64_t, int64_t>> split_points_;
     std::vector<char> str_buf_;
     TensorRow cur_row_;
     std::string err_message_;
     std::string file_path_;
+    int64_t block_size_;
+    int64_t block_rows_;
+    // the values of the rows of the current row block, only the buffer of the type of each column is used
+    std::vector<std::vector<int32_t>> int_columns_;
+    std::vector<std::vector<float>> float_columns_;
+    std::vector<std::vector<std::string>> string_columns_;
   };
 
   /// Constructor of CsvOp
@@ -154,7 +215,7 @@ class CsvOp : public NonMappableLeafOp {
   CsvOp(const std::vector<std::string> &csv_files_list, char field_delim,
         const std::vector<std::shared_ptr<BaseRecord>> &column_default, const std::vector<std::string> &column_name,
         int32_t num_workers, int64_t num_samples, int32_t worker_connector_size, int32_t op_connector_size,
-        bool shuffle_files, int32_t num_devices, int32_t device_id);
+        bool shuffle_files, int32_t num_devices, int32_t device_id, int64_t split_size = CSV_SPLIT_SIZE);
 
   /// Default destructor
   ~CsvOp() = default;
@@ -183,6 +244,10 @@ class CsvOp : public NonMappableLeafOp {
   /// @return Name of the current Op
   std::string Name() const override { return "CSVOp"; }
 
+  /// Send row blocks of block_size rows instead of plain rows, set by RowBlockPass when the rows are only batched.
+  /// @param block_size - the number of rows of a row block, 0 to send plain rows.
+  void SetRowBlockSize(int64_t block_size) { block_size_ = block_size; }
+
   // DatasetName name getter
   // \return DatasetName of the current Op
   virtual std::string DatasetName(bool upper = false) const { return upper ? "CSV" : "csv"; }
@@ -235,11 +300,21 @@ class CsvOp : public NonMappableLeafOp {
   // @return bool - whether column name identical in all CSV files
   bool ColumnNameValidate();
 
+  // Get the number of ranges which the files are split into, i.e. the number of workers which can read them.
+  // @param files - the csv files.
+  // @param split_size - the number of bytes after which a file is split.
+  // @return int32_t - the number of ranges.
+  static int32_t CountFileSplits(const std::vector<std::string> &files, int64_t split_size);
+
   std::vector<std::string> csv_files_list_;
+  // (number of rows before, offset in file) of the points where a large file is split for different workers
+  std::map<std::string, std::vector<std::pair<int64_t, int64_t>>> filename_split_points_;
+  int64_t split_size_;
   char field_delim_;
   std::vector<std::shared_ptr<CsvOp::BaseRecord>> column_default_list_;
   std::vector<std::string> column_name_list_;
   bool check_flag_ = false;
+  int64_t block_size_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -68,6 +68,12 @@ ImageFolderOp::ImageFolderOp(int32_t num_wkrs, std::string file_dir, int32_t que
 // Then consolidate 2 level shuffles together into 1 giant vector
 // calculate numRows then return
 Status ImageFolderOp::PrepareData() {
+  if (snapshot_loaded_) {
+    num_rows_ = image_label_pairs_.size();
+    folder_name_queue_->Reset();
+    image_name_queue_->Reset();
+    return Status::OK();
+  }
   std::vector<FolderImagesPair> v;
   int64_t cnt = 0;
   while (cnt != num_workers_) {  // count number of end signals
@@ -81,14 +87,23 @@ Status ImageFolderOp::PrepareData() {
   }
   std::sort(v.begin(), v.end(),
             [](const FolderImagesPair &lhs, const FolderImagesPair &rhs) { return lhs->first < rhs->first; });
+  const bool save_snapshot = !GlobalContext::config_manager()->source_snapshot_dir().empty();
+  nlohmann::json folders = nlohmann::json::array();
   // following loop puts the 2 level of shuffles together into 1 vector
   for (size_t ind = 0; ind < v.size(); ++ind) {
+    nlohmann::json images = nlohmann::json::array();
     while (v[ind]->second.empty() == false) {
       MS_ASSERT(!(v[ind]->first.empty()));  // make sure that v[ind]->first.substr(1) is not out of bound
       v[ind]->second.front()->second = class_index_.empty() ? ind : class_index_[v[ind]->first.substr(1)];
+      if (save_snapshot) {
+        images.push_back(v[ind]->second.front()->first);
+      }
       image_label_pairs_.push_back(v[ind]->second.front());
       v[ind]->second.pop();
     }
+    if (save_snapshot) {
+      folders.push_back(nlohmann::json::array({v[ind]->first, std::move(images)}));
+    }
   }
   image_label_pairs_.shrink_to_fit();
   num_rows_ = image_label_pairs_.size();
@@ -97,12 +112,63 @@ Status ImageFolderOp::PrepareData() {
                              "Dataset API can't read the data file (interface mismatch or no data found). Check " +
                              DatasetName() + " file path: " + folder_path_);
   }
+  if (save_snapshot) {
+    SaveSnapshot(folders);
+  }
   // free memory of two queues used for pre-scan
   folder_name_queue_->Reset();
   image_name_queue_->Reset();
   return Status::OK();
 }
 
+std::string ImageFolderOp::FolderSnapshotKey(const std::string &path, const std::set<std::string> &exts,
+                                             const std::map<std::string, int32_t> &class_index) {
+  return nlohmann::json::array({path, exts, class_index}).dump();
+}
+
+bool ImageFolderOp::LoadSnapshot() {
+  nlohmann::json folders;
+  if (!SourceSnapshot(Name(), SnapshotKey()).Load(&folders)) {
+    return false;
+  }
+  try {
+    // the labels are assigned in the same way as PrepareData
+    for (size_t ind = 0; ind < folders.size(); ++ind) {
+      const std::string folder_name = folders[ind].at(0).get<std::string>();
+      int32_t label = class_index_.empty() ? static_cast<int32_t>(ind) : class_index_[folder_name.substr(1)];
+      for (const auto &image : folders[ind].at(1)) {
+        image_label_pairs_.push_back(
+          std::make_shared<std::pair<std::string, int32_t>>(image.get<std::string>(), label));
+      }
+    }
+  } catch (const std::exception &err) {
+    MS_LOG(WARNING) << "Ignore the broken snapshot of " << DatasetName() << ": " << err.what();
+    image_label_pairs_.clear();
+    return false;
+  }
+  snapshot_loaded_ = !image_label_pairs_.empty();
+  return snapshot_loaded_;
+}
+
+void ImageFolderOp::SaveSnapshot(const nlohmann::json &folders) const {
+  // The snapshot is outdated when any walked folder changes. The parents of nested folders are watched too, as
+  // adding or removing a subfolder only changes its parent.
+  std::set<std::string> inputs = {folder_path_};
+  for (const auto &folder : folders) {
+    std::string folder_name = folder[0].get<std::string>();
+    while (!folder_name.empty()) {
+      (void)inputs.insert(folder_path_ + folder_name);
+      size_t pos = folder_name.find_last_of("/\\");
+      folder_name = pos == std::string::npos ? "" : folder_name.substr(0, pos);
+    }
+  }
+  Status rc =
+    SourceSnapshot(Name(), SnapshotKey()).Save(std::vector<std::string>(inputs.begin(), inputs.end()), folders);
+  if (rc.IsError()) {
+    MS_LOG(WARNING) << "Failed to save the snapshot of " << DatasetName() << ", " << rc.GetErrDescription();
+  }
+}
+
 // Load 1 TensorRow (image,label) using 1 ImageLabelPair. 1 function call produces 1 TensorTow
 Status ImageFolderOp::LoadTensorRow(row_id_type row_id, TensorRow *trow) {
   ImageLabelPair pair_ptr = image_label_pairs_[row_id];
@@ -247,6 +313,8 @@ Status ImageFolderOp::RegisterAndLaunchThreads() {
   RETURN_IF_NOT_OK(ParallelOp::RegisterAndLaunchThreads());
   RETURN_IF_NOT_OK(folder_name_queue_->Register(tree_->AllTasks()));
   RETURN_IF_NOT_OK(image_name_queue_->Register(tree_->AllTasks()));
+  // No need to walk the folders if the file list is restored from the snapshot of a previous launch
+  RETURN_OK_IF_TRUE(LoadSnapshot());
 
   // The following code launch 3 threads group
   // 1) A thread that walks all folders and push the folder names to a util:Queue folder_name_queue_.
@@ -300,6 +368,17 @@ Status ImageFolderOp::CountRowsAndClasses(const std::string &path, const std::se
   }
   // return here if only num_class is needed
   RETURN_OK_IF_TRUE(num_rows == nullptr);
+  // the file list saved by a previous launch of the op gives the number of rows without walking the folders
+  nlohmann::json folders;
+  if (SourceSnapshot("ImageFolderOp", FolderSnapshotKey(path, exts, class_index)).Load(&folders)) {
+    for (const auto &folder : folders) {
+      if (folder.is_array() && folder.size() > 1) {
+        row_cnt += static_cast<int64_t>(folder[1].size());
+      }
+    }
+    (*num_rows) = row_cnt;
+    return Status::OK();
+  }
   while (folder_paths.empty() == false) {
     Path subdir(folder_paths.front());
     dir_itr = Path::DirIterator::OpenDirectory(&subdir);
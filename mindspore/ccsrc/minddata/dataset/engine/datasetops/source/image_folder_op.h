@@ -31,6 +31,7 @@
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/mappable_leaf_op.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+#include "minddata/dataset/engine/datasetops/source/source_snapshot.h"
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/kernels/image/image_utils.h"
 #else
@@ -151,6 +152,22 @@ class ImageFolderOp : public MappableLeafOp {
   /// @return - Status
   Status ComputeColMap() override;
 
+  /// The arguments which decide the file list of the op, the snapshot of the file list is saved under this key.
+  /// @return - The key of the snapshot
+  virtual std::string SnapshotKey() const { return FolderSnapshotKey(folder_path_, extensions_, class_index_); }
+
+  /// Restore image_label_pairs_ from the snapshot saved by a previous launch, so that the folders are not walked.
+  /// @return - True if the snapshot is loaded
+  bool LoadSnapshot();
+
+  /// Save the file list of the walked folders to the snapshot directory.
+  /// @param folders - [folder name, [image names]] of all folders in the order of their labels
+  void SaveSnapshot(const nlohmann::json &folders) const;
+
+  /// Build the snapshot key of an image folder from its directory, extensions and class indexing.
+  static std::string FolderSnapshotKey(const std::string &path, const std::set<std::string> &exts,
+                                       const std::map<std::string, int32_t> &class_index);
+
   std::string folder_path_;  // directory of image folder
   bool recursive_;
   bool decode_;
@@ -162,6 +179,7 @@ class ImageFolderOp : public MappableLeafOp {
   std::vector<ImageLabelPair> image_label_pairs_;
   std::unique_ptr<Queue<std::string>> folder_name_queue_;
   std::unique_ptr<Queue<FolderImagesPair>> image_name_queue_;
+  bool snapshot_loaded_{false};  // image_label_pairs_ is restored from the snapshot, the folders are not walked
 #ifdef ENABLE_PYTHON
   py::function decrypt_;
 #endif
@@ -164,5 +164,9 @@ Status LSUNOp::GetNumClasses(int64_t *num_classes) {
   num_classes_ = *num_classes;
   return Status::OK();
 }
+
+std::string LSUNOp::SnapshotKey() const {
+  return nlohmann::json::array({ImageFolderOp::SnapshotKey(), usage_, classes_}).dump();
+}
 }  // namespace dataset
 }  // namespace mindspore
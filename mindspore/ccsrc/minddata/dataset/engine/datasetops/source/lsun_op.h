@@ -96,6 +96,10 @@ class LSUNOp : public ImageFolderOp {
   /// \return Status of the function
   Status RecursiveWalkFolder(Path *dir) override;
 
+  /// \brief Base-class override for SnapshotKey, the usage and the classes decide the file list too
+  /// \return The key of the snapshot
+  std::string SnapshotKey() const override;
+
   /// \brief Function to save the path list to folder_paths
   /// \param[in] std::string & dir dir to lsun dataset.
   /// \param[in] std::string usage Dataset splits of LSUN, can be `train`, `valid`, `test` or `all`.
@@ -66,33 +66,41 @@ Status MappableLeafOp::operator()() {
 
   int64_t ep_step = 0, total_step = 0;
   RETURN_IF_NOT_OK(callback_manager_.Begin(CallbackParam(0, ep_step, total_step)));
+  // Pull the ids one by one if the sampler supports it, so that no Tensor of the ids of a whole shard is built
+  const bool index_stream = sampler_->IsIndexStream();
   TensorRow sample_row;
-  RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
+  if (!index_stream) {
+    RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
+  }
   while (true) {  // each iteration is 1 epoch, breaks when IsLastIteration() is true
     if (op_current_repeats_ % GetOpNumRepeatsPerEpoch() == 0) {
       ep_step = 0;
       RETURN_IF_NOT_OK(callback_manager_.EpochBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
     }
-    while (sample_row.eoe() == false) {
-      std::shared_ptr<Tensor> sample_ids = sample_row[0];
-      for (auto itr = sample_ids->begin<int64_t>(); itr != sample_ids->end<int64_t>(); ++itr) {
-        if ((*itr) >= num_rows_) {
-          MS_LOG(WARNING) << "Skipping sample with ID: " << *itr << " since it is out of bound: " << num_rows_;
-          continue;  // index out of bound, skipping
+    if (index_stream) {
+      int64_t sample_id = 0;
+      bool eoe = false;
+      RETURN_IF_NOT_OK(sampler_->GetNextId(&sample_id, &eoe));
+      while (!eoe) {
+        RETURN_IF_NOT_OK(SendSampleId(sample_id, &ep_step, &total_step));
+        RETURN_IF_NOT_OK(sampler_->GetNextId(&sample_id, &eoe));
+      }
+    } else {
+      while (sample_row.eoe() == false) {
+        std::shared_ptr<Tensor> sample_ids = sample_row[0];
+        for (auto itr = sample_ids->begin<int64_t>(); itr != sample_ids->end<int64_t>(); ++itr) {
+          RETURN_IF_NOT_OK(SendSampleId(*itr, &ep_step, &total_step));
         }
-        ep_step++;
-        total_step++;
-        RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, ep_step, total_step)));
-        RETURN_IF_NOT_OK(
-          worker_in_queues_[NextWorkerID()]->Add(std::make_unique<IOBlock>(*itr, IOBlock::kDeIoBlockNone)));
+        RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
       }
-      RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
     }
     RETURN_IF_NOT_OK(worker_in_queues_[NextWorkerID()]->Add(std::make_unique<IOBlock>(IOBlock::kDeIoBlockFlagEoe)));
     if (!IsLastIteration()) {
       // If not the last repeat, self-reset and go to loop again.
       RETURN_IF_NOT_OK(Reset());
-      RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
+      if (!index_stream) {
+        RETURN_IF_NOT_OK(sampler_->GetNextSample(&sample_row));
+      }
     } else {
       break;
     }
@@ -105,6 +113,19 @@ Status MappableLeafOp::operator()() {
   return Status::OK();
 }
 
+Status MappableLeafOp::SendSampleId(int64_t sample_id, int64_t *ep_step, int64_t *total_step) {
+  if (sample_id >= num_rows_) {
+    MS_LOG(WARNING) << "Skipping sample with ID: " << sample_id << " since it is out of bound: " << num_rows_;
+    return Status::OK();  // index out of bound, skipping
+  }
+  (*ep_step)++;
+  (*total_step)++;
+  RETURN_IF_NOT_OK(callback_manager_.StepBegin(CallbackParam(op_current_epochs_ + 1, *ep_step, *total_step)));
+  RETURN_IF_NOT_OK(
+    worker_in_queues_[NextWorkerID()]->Add(std::make_unique<IOBlock>(sample_id, IOBlock::kDeIoBlockNone)));
+  return Status::OK();
+}
+
 // Reset Sampler and wakeup Master thread (functor)
 Status MappableLeafOp::Reset() {
   MS_LOG(DEBUG) << Name() << " performing a self-reset.";
@@ -99,6 +99,13 @@ class MappableLeafOp : public ParallelOp<std::unique_ptr<IOBlock>, TensorRow>, p
   /// \return Status The status code returned
   virtual Status LoadTensorRow(row_id_type row_id, TensorRow *row) = 0;
 
+  /// Send a sample id to the next worker, ids out of bound are skipped
+  /// \param int64_t sample_id - id of the row to load
+  /// \param int64_t *ep_step - step in the current epoch, for callbacks
+  /// \param int64_t *total_step - step since the beginning, for callbacks
+  /// \return Status The status code returned
+  Status SendSampleId(int64_t sample_id, int64_t *ep_step, int64_t *total_step);
+
   /// Reset function to be called after every epoch to reset the source op after
   /// \return Status The status code returned
   Status Reset() override;
@@ -78,9 +78,16 @@ Status NonMappableLeafOp::operator()() {
       if (fetched_row.eoe()) {
         workers_done++;
       } else if (total_rows_ == 0 || rows_read < total_rows_) {
-        // we need to push a row
+        // we need to push a row, a row block counts as all of its rows and is cut at the number of rows to read
+        int64_t num_rows = fetched_row.getBlockSize() > 0 ? fetched_row.getBlockSize() : 1;
+        if (total_rows_ > 0 && rows_read + num_rows > total_rows_) {
+          num_rows = total_rows_ - rows_read;
+          TensorRow block;
+          RETURN_IF_NOT_OK(fetched_row.SliceBlock(0, num_rows, &block));
+          fetched_row = std::move(block);
+        }
         RETURN_IF_NOT_OK(out_connector_->Add(std::move(fetched_row)));
-        rows_read++;
+        rows_read += num_rows;
       } else {
         // IOBlockQueue thread needs to:
         // -stop pushing stuff to IOBlockQueue
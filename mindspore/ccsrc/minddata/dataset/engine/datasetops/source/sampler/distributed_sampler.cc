@@ -31,6 +31,7 @@ DistributedSamplerRT::DistributedSamplerRT(int64_t num_shards, int64_t shard_id,
       device_id_(shard_id),
       num_devices_(num_shards),
       shuffle_(shuffle),
+      seekable_(shuffle && GlobalContext::config_manager()->enable_seekable_shuffle()),
       even_dist_(even_dist),
       offset_(offset),
       non_empty_(true) {
@@ -77,7 +78,10 @@ Status DistributedSamplerRT::InitSampler() {
     samples_per_tensor_ = (num_rows_ + num_devices_ - 1) / num_devices_;  // equals to ceil(num_rows/num_devices)
   }
   samples_per_tensor_ = num_samples_ < samples_per_tensor_ ? num_samples_ : samples_per_tensor_;
-  if (shuffle_) {
+  if (seekable_) {
+    // seed_ has been moved to the next epoch above
+    permutation_ = IndexPermutation(num_rows_, seed_ - 1);
+  } else if (shuffle_) {
     shuffle_vec_.reserve(num_rows_);
     for (int64_t i = 0; i < num_rows_; i++) {
       shuffle_vec_.push_back(i);
@@ -134,7 +138,9 @@ Status DistributedSamplerRT::GetNextSample(TensorRow *out) {
       }
       int64_t sampled_id = middle_value % num_rows_;
 
-      if (shuffle_) {
+      if (seekable_) {
+        sampled_id = permutation_[sampled_id];
+      } else if (shuffle_) {
         sampled_id = shuffle_vec_[static_cast<size_t>(sampled_id)];
       }
 
@@ -157,11 +163,38 @@ Status DistributedSamplerRT::GetNextSample(TensorRow *out) {
   return Status::OK();
 }
 
+Status DistributedSamplerRT::GetNextId(int64_t *id, bool *eoe) {
+  RETURN_UNEXPECTED_IF_NULL(id);
+  RETURN_UNEXPECTED_IF_NULL(eoe);
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    cnt_ <= samples_per_tensor_,
+    "[Internal ERROR] Sampler index must be less than or equal to num_samples(total rows in dataset), but got:" +
+      std::to_string(cnt_) + ", samples_per_tensor(num_samples): " + std::to_string(samples_per_tensor_));
+  *eoe = cnt_ == samples_per_tensor_;
+  if (*eoe) {
+    return Status::OK();
+  }
+  // The shards before the offset start one round later, the same as moving back one place in GetNextSample
+  int64_t round = device_id_ < offset_ ? cnt_ + 1 : cnt_;
+  int64_t sampled_id = (num_devices_ * round + device_id_ - offset_) % num_rows_;
+  if (seekable_) {
+    sampled_id = permutation_[sampled_id];
+  } else if (shuffle_) {
+    sampled_id = shuffle_vec_[static_cast<size_t>(sampled_id)];
+  }
+  *id = sampled_id;
+  cnt_++;
+  return Status::OK();
+}
+
 Status DistributedSamplerRT::ResetSampler() {
   CHECK_FAIL_RETURN_UNEXPECTED(cnt_ == samples_per_tensor_, "[Internal ERROR] Reset() Sampler called early or late.");
   cnt_ = 0;
 
-  if (shuffle_ == true) {
+  if (seekable_) {
+    permutation_ = IndexPermutation(num_rows_, seed_);
+    seed_++;
+  } else if (shuffle_ == true) {
     rnd_.seed(seed_);
     seed_++;
     std::shuffle(shuffle_vec_.begin(), shuffle_vec_.end(), rnd_);
@@ -210,6 +243,9 @@ void DistributedSamplerRT::SamplerPrint(std::ostream &out, bool show_all) const
     SamplerRT::SamplerPrint(out, show_all);
     out << "\nseed: " << seed_ << "\ndevice_id: " << device_id_ << "\nnum_devices: " << num_devices_
         << "\nshuffle: " << shuffle_;
+    if (seekable_) {
+      out << "\nSeekable: " << seekable_;
+    }
   }
 }
 
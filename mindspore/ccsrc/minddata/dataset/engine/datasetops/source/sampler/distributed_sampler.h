@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+#include "minddata/dataset/util/index_permutation.h"
 
 namespace mindspore {
 namespace dataset {
@@ -52,6 +53,16 @@ class DistributedSamplerRT : public SamplerRT {
   /// \return Status code
   Status GetNextSample(TensorRow *out) override;
 
+  /// \brief The ids are pulled one by one with GetNextId, unless they are drawn from a child sampler or the shard is
+  ///     empty and padded with a dummy id for ConcatDataset
+  bool IsIndexStream() const override { return !HasChildSampler() && samples_per_tensor_ > 0; }
+
+  /// \brief Get the next sample id of the shard without a Tensor
+  /// \param[out] id The next sample id
+  /// \param[out] eoe Set to true at the end of the epoch
+  /// \return Status code
+  Status GetNextId(int64_t *id, bool *eoe) override;
+
   /// Init sampler, called by base class or python
   Status InitSampler() override;
 
@@ -84,7 +95,9 @@ class DistributedSamplerRT : public SamplerRT {
   int64_t num_devices_;
   bool shuffle_;
   std::mt19937 rnd_;
-  std::vector<int64_t> shuffle_vec_;
+  std::vector<int64_t> shuffle_vec_;  // only used for shuffle if not seekable
+  bool seekable_;                     // shuffle with permutation_ instead of shuffle_vec_
+  IndexPermutation permutation_;      // only used for shuffle if seekable
   bool even_dist_;
   int64_t offset_;
   bool non_empty_;
@@ -39,7 +39,7 @@ Status MindRecordSamplerRT::GetNextSample(TensorRow *out) {
     RETURN_IF_NOT_OK(CreateSamplerTensor(&sampleIdsTensor, last_id - next_id_));
     auto id_ptr = sampleIdsTensor->begin<int64_t>();
     for (int64_t i = 0; i < (last_id - next_id_); i++) {
-      *(id_ptr + static_cast<ptrdiff_t>(i)) = (*sample_ids_)[i];
+      *(id_ptr + static_cast<ptrdiff_t>(i)) = (*sample_ids_)[static_cast<size_t>(next_id_ + i)];
     }
     next_id_ = last_id;
 
@@ -60,6 +60,9 @@ Status MindRecordSamplerRT::InitSampler() {
   // Usually, the num samples is given from the user interface. In our case, that data is in mindrecord.
   // Mindrecord already created the sample ids at this point, so the num samples is the size of the sampled id list.
   num_samples_ = sample_ids_->size();
+  CHECK_FAIL_RETURN_UNEXPECTED(next_id_ >= 0 && (next_id_ == 0 || next_id_ < num_samples_),
+                               "[Internal ERROR] Invalid start index of MindRecordSampler: " + std::to_string(next_id_) +
+                                 ", num_samples: " + std::to_string(num_samples_));
   return Status::OK();
 }
 
@@ -48,6 +48,11 @@ class MindRecordSamplerRT : public SamplerRT {
   // @return Status The status code returned
   Status ResetSampler() override;
 
+  /// \brief Let the first epoch start from a later row, e.g. when the pipeline is reset to a step and the shard reader
+  ///     is shuffled by a seekable RandomSampler
+  /// \param[in] index The number of samples to skip in the first epoch
+  void SetStartIndex(int64_t index) { next_id_ = index; }
+
   void SamplerPrint(std::ostream &out, bool show_all) const override;
 
   /// \brief Get the arguments of node
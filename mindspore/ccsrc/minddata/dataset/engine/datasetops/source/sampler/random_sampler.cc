@@ -29,6 +29,9 @@ RandomSamplerRT::RandomSamplerRT(bool replacement, int64_t num_samples, bool res
     : SamplerRT(num_samples, samples_per_tensor),
       seed_(GetSeed()),
       replacement_(replacement),
+      seekable_(!replacement && GlobalContext::config_manager()->enable_seekable_shuffle()),
+      start_epoch_(0),
+      start_index_(0),
       next_id_(0),
       dist(nullptr),
       reshuffle_each_epoch_(reshuffle_each_epoch) {}
@@ -55,6 +58,8 @@ Status RandomSamplerRT::GetNextSample(TensorRow *out) {
       int64_t sampled_id = 0;
       if (replacement_) {
         sampled_id = (*dist)(rnd_);
+      } else if (seekable_) {
+        sampled_id = permutation_[i + next_id_];
       } else {
         sampled_id = shuffled_ids_[static_cast<size_t>(i + next_id_)];
       }
@@ -71,6 +76,28 @@ Status RandomSamplerRT::GetNextSample(TensorRow *out) {
   return Status::OK();
 }
 
+Status RandomSamplerRT::GetNextId(int64_t *id, bool *eoe) {
+  RETURN_UNEXPECTED_IF_NULL(id);
+  RETURN_UNEXPECTED_IF_NULL(eoe);
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    next_id_ <= num_samples_,
+    "[Internal ERROR] Sampler index must be less than or equal to num_samples(total rows in dataset), but got" +
+      std::to_string(next_id_) + ", num_samplers:" + std::to_string(num_samples_));
+  *eoe = next_id_ == num_samples_;
+  if (*eoe) {
+    return Status::OK();
+  }
+  if (replacement_) {
+    *id = (*dist)(rnd_);
+  } else if (seekable_) {
+    *id = permutation_[next_id_];
+  } else {
+    *id = shuffled_ids_[static_cast<size_t>(next_id_)];
+  }
+  next_id_++;
+  return Status::OK();
+}
+
 Status RandomSamplerRT::InitSampler() {
   if (is_initialized) {
     return Status::OK();
@@ -85,9 +112,23 @@ Status RandomSamplerRT::InitSampler() {
     "[Internal ERROR] num_samples and num_rows must be greater than 0, but got num_samples: " +
       std::to_string(num_samples_) + ", num_rows: " + std::to_string(num_rows_));
   samples_per_tensor_ = samples_per_tensor_ > num_samples_ ? num_samples_ : samples_per_tensor_;
+
+  if (seekable_) {
+    CHECK_FAIL_RETURN_UNEXPECTED(start_epoch_ >= 0 && start_index_ >= 0 && start_index_ < num_samples_,
+                                 "[Internal ERROR] Invalid start position of RandomSampler, epoch: " +
+                                   std::to_string(start_epoch_) + ", index: " + std::to_string(start_index_) +
+                                   ", num_samples: " + std::to_string(num_samples_));
+    // The order of an epoch only depends on its seed, so it is not needed to shuffle the skipped epochs
+    if (reshuffle_each_epoch_) {
+      seed_ += static_cast<uint32_t>(start_epoch_);
+    }
+    next_id_ = start_index_;
+  }
   rnd_.seed(seed_);
 
-  if (!replacement_) {
+  if (seekable_) {
+    permutation_ = IndexPermutation(num_rows_, seed_);
+  } else if (!replacement_) {
     shuffled_ids_.reserve(num_rows_);
     for (int64_t i = 0; i < num_rows_; i++) {
       shuffled_ids_.push_back(i);
@@ -111,7 +152,10 @@ Status RandomSamplerRT::ResetSampler() {
 
   rnd_.seed(seed_);
 
-  if (!replacement_ && reshuffle_each_epoch_) {
+  if (seekable_) {
+    start_index_ = 0;
+    permutation_ = IndexPermutation(num_rows_, seed_);
+  } else if (!replacement_ && reshuffle_each_epoch_) {
     std::shuffle(shuffled_ids_.begin(), shuffled_ids_.end(), rnd_);
   }
 
@@ -122,12 +166,22 @@ Status RandomSamplerRT::ResetSampler() {
   return Status::OK();
 }
 
+int64_t RandomSamplerRT::CalculateNumSamples(const int64_t num_rows) {
+  if (seekable_ && start_index_ > 0) {
+    return -1;
+  }
+  return SamplerRT::CalculateNumSamples(num_rows);
+}
+
 void RandomSamplerRT::SamplerPrint(std::ostream &out, bool show_all) const {
   out << "\nSampler: RandomSampler";
   if (show_all) {
     // Call the super class for displaying any common detailed info
     SamplerRT::SamplerPrint(out, show_all);
     // Then add our own info if any
+    if (seekable_) {
+      out << "\nSeekable: " << seekable_ << "\nStart epoch: " << start_epoch_ << "\nStart index: " << start_index_;
+    }
   }
 }
 
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+#include "minddata/dataset/util/index_permutation.h"
 
 namespace mindspore {
 namespace dataset {
@@ -43,6 +44,15 @@ class RandomSamplerRT : public SamplerRT {
   // @return Status The status code returned
   Status GetNextSample(TensorRow *out) override;
 
+  // The ids are pulled one by one with GetNextId, unless they are drawn from a child sampler
+  bool IsIndexStream() const override { return !HasChildSampler(); }
+
+  // Op calls this to get the next sample id without a Tensor
+  // @param int64_t *id - the next sample id
+  // @param bool *eoe - set to true at the end of the epoch
+  // @return Status The status code returned
+  Status GetNextId(int64_t *id, bool *eoe) override;
+
   // meant to be called by base class or python
   Status InitSampler() override;
 
@@ -50,6 +60,22 @@ class RandomSamplerRT : public SamplerRT {
   // @return Status The status code returned
   Status ResetSampler() override;
 
+  /// \brief Let the first epoch start from a row of a later epoch, e.g. when the pipeline is reset to a step.
+  /// \note Only takes effect if the sampler is seekable, i.e. it draws without replacement and
+  ///     enable_seekable_shuffle is set, so that the order of any epoch can be computed from the seed.
+  /// \param[in] epoch The number of epochs to skip.
+  /// \param[in] index The number of samples to skip in the first epoch.
+  void SetStartPosition(int64_t epoch, int64_t index) {
+    start_epoch_ = epoch;
+    start_index_ = index;
+  }
+
+  /// \brief Gets the number of samples available
+  /// \note If the first epoch starts from a later row, it returns -1 like SkipFirstEpochSampler
+  /// \param[in] num_rows The total number of rows in the dataset
+  /// \return int64_t Calculated number of samples
+  int64_t CalculateNumSamples(const int64_t num_rows) override;
+
   void SamplerPrint(std::ostream &out, bool show_all) const override;
 
   /// \brief Get the arguments of node
@@ -61,6 +87,10 @@ class RandomSamplerRT : public SamplerRT {
   uint32_t seed_;
   bool replacement_;
   std::vector<int64_t> shuffled_ids_;  // only used for NO REPLACEMENT
+  bool seekable_;                      // shuffle with permutation_ instead of shuffled_ids_
+  IndexPermutation permutation_;       // only used for NO REPLACEMENT if seekable
+  int64_t start_epoch_;
+  int64_t start_index_;
   int64_t next_id_;
   std::mt19937 rnd_;
   std::unique_ptr<std::uniform_int_distribution<int64_t>> dist;
@@ -182,6 +182,10 @@ Status SamplerRT::AddChild(std::shared_ptr<SamplerRT> child) {
 
 bool SamplerRT::HasChildSampler() const { return !child_.empty(); }
 
+Status SamplerRT::GetNextId(int64_t *id, bool *eoe) {
+  RETURN_STATUS_UNEXPECTED("[Internal ERROR] GetNextId is not supported by this sampler, use GetNextSample instead.");
+}
+
 Status SamplerRT::GetAssociatedChildId(int64_t *out_associated_id, int64_t id) {
   RETURN_UNEXPECTED_IF_NULL(out_associated_id);
   if (child_ids_.empty()) {
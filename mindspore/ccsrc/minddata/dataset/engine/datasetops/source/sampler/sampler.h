@@ -85,6 +85,18 @@ class SamplerRT {
   // @return Status The status code returned
   virtual Status GetNextSample(TensorRow *out) = 0;
 
+  // Whether the ids of an epoch can be pulled one by one with GetNextId, so that the leaf op never needs a Tensor
+  // of sample ids. Samplers with a child sampler pull the ids of the child in Tensors, so they are not index streams.
+  // @return bool True if GetNextId is supported
+  virtual bool IsIndexStream() const { return false; }
+
+  // Get the next sample id of the epoch without packing it into a Tensor.
+  // @note GetNextId and GetNextSample share the position of the epoch, so the epoch ends at the same point.
+  // @param int64_t *id - the next sample id, not set at the end of the epoch
+  // @param bool *eoe - set to true at the end of the epoch
+  // @return Status The status code returned
+  virtual Status GetNextId(int64_t *id, bool *eoe);
+
 // This function only called by python layer. Not needed by Android.
 #ifdef ENABLE_PYTHON
   // return all ids in one epoch as a numpy array, then call reset
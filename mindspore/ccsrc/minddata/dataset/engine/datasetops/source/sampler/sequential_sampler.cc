@@ -65,6 +65,21 @@ Status SequentialSamplerRT::GetNextSample(TensorRow *out) {
   return Status::OK();
 }
 
+Status SequentialSamplerRT::GetNextId(int64_t *id, bool *eoe) {
+  RETURN_UNEXPECTED_IF_NULL(id);
+  RETURN_UNEXPECTED_IF_NULL(eoe);
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    id_count_ <= num_samples_,
+    "[Internal ERROR] Sampler index must be less than or equal to num_samples(total rows in dataset), but got:" +
+      std::to_string(id_count_) + ", num_samples_: " + std::to_string(num_samples_));
+  *eoe = id_count_ == num_samples_;
+  if (!*eoe) {
+    *id = current_id_++;
+    id_count_++;
+  }
+  return Status::OK();
+}
+
 Status SequentialSamplerRT::InitSampler() {
   if (is_initialized) {
     return Status::OK();
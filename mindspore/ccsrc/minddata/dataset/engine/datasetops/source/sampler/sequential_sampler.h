@@ -49,6 +49,15 @@ class SequentialSamplerRT : public SamplerRT {
   // @return Status The status code returned
   Status GetNextSample(TensorRow *out) override;
 
+  // The ids are pulled one by one with GetNextId, unless they are drawn from a child sampler
+  bool IsIndexStream() const override { return !HasChildSampler(); }
+
+  // Op calls this to get the next sample id without a Tensor
+  // @param int64_t *id - the next sample id
+  // @param bool *eoe - set to true at the end of the epoch
+  // @return Status The status code returned
+  Status GetNextId(int64_t *id, bool *eoe) override;
+
   /// \brief Recursively calls this function on its children to get the actual number of samples on a tree of samplers
   /// \note This is not a getter for num_samples_. For example, if num_samples_ is 0 or if it's smaller than num_rows,
   ///     then num_samples_ is not returned at all.
@@ -0,0 +1,140 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/datasetops/source/source_snapshot.h"
+
+#include <sys/stat.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/util/path.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int kSnapshotVersion = 1;
+constexpr char kSnapshotExtension[] = ".msgpack";
+
+// FNV-1a, so that the file name of a key does not change between builds like std::hash may
+uint64_t HashKey(const std::string &key) {
+  constexpr uint64_t kOffsetBasis = 14695981039346656037ULL;
+  constexpr uint64_t kPrime = 1099511628211ULL;
+  uint64_t hash = kOffsetBasis;
+  for (const unsigned char c : key) {
+    hash = (hash ^ c) * kPrime;
+  }
+  return hash;
+}
+
+// The size and the modification time of a path, or -1 if it does not exist
+nlohmann::json Fingerprint(const std::string &path) {
+  struct stat sb;
+  if (stat(path.c_str(), &sb) != 0) {
+    return nlohmann::json::array({path, -1, -1});
+  }
+  constexpr int64_t kNanoPerSecond = 1000000000;
+#if defined(__linux__)
+  int64_t mtime = static_cast<int64_t>(sb.st_mtim.tv_sec) * kNanoPerSecond + sb.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+  int64_t mtime = static_cast<int64_t>(sb.st_mtimespec.tv_sec) * kNanoPerSecond + sb.st_mtimespec.tv_nsec;
+#else
+  int64_t mtime = static_cast<int64_t>(sb.st_mtime) * kNanoPerSecond;
+#endif
+  return nlohmann::json::array({path, static_cast<int64_t>(sb.st_size), mtime});
+}
+}  // namespace
+
+SourceSnapshot::SourceSnapshot(const std::string &op_name, const std::string &key) : key_(op_name + ":" + key) {
+  std::string dir = GlobalContext::config_manager()->source_snapshot_dir();
+  if (!dir.empty()) {
+    std::stringstream ss;
+    ss << std::hex << HashKey(key_);
+    file_path_ = (Path(dir) / (op_name + "_" + ss.str() + kSnapshotExtension)).ToString();
+  }
+}
+
+bool SourceSnapshot::Load(nlohmann::json *data) const {
+  if (!Enabled() || data == nullptr) {
+    return false;
+  }
+  std::ifstream in(file_path_, std::ios::binary);
+  if (!in.is_open()) {
+    return false;
+  }
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  nlohmann::json js = nlohmann::json::from_msgpack(bytes, true, false);
+  if (js.is_discarded() || !js.is_object() || js.value("version", 0) != kSnapshotVersion ||
+      js.value("key", std::string()) != key_ || !js.contains("inputs") || !js.contains("data")) {
+    MS_LOG(WARNING) << "Ignore the broken source snapshot: " << file_path_ << ".";
+    return false;
+  }
+  for (const auto &input : js["inputs"]) {
+    if (!input.is_array() || input.empty() || !input[0].is_string() ||
+        Fingerprint(input[0].get<std::string>()) != input) {
+      MS_LOG(INFO) << "Source snapshot " << file_path_ << " is outdated, its inputs have been changed.";
+      return false;
+    }
+  }
+  *data = std::move(js["data"]);
+  MS_LOG(INFO) << "Source snapshot " << file_path_ << " is loaded.";
+  return true;
+}
+
+Status SourceSnapshot::Save(const std::vector<std::string> &inputs, const nlohmann::json &data) const {
+  RETURN_OK_IF_TRUE(!Enabled());
+  Path dir(Path(file_path_).ParentPath());
+  RETURN_IF_NOT_OK(dir.CreateDirectories());
+
+  nlohmann::json js;
+  js["version"] = kSnapshotVersion;
+  js["key"] = key_;
+  js["inputs"] = nlohmann::json::array();
+  for (const auto &input : inputs) {
+    js["inputs"].push_back(Fingerprint(input));
+  }
+  js["data"] = data;
+  std::vector<uint8_t> bytes = nlohmann::json::to_msgpack(js);
+
+  // Write to a temporary file first, so that pipelines of other ranks never read a partial snapshot
+  std::string tmp_path = file_path_ + "." + std::to_string(std::random_device()()) + ".tmp";
+  std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(out.is_open(), "Failed to create source snapshot: " + tmp_path + ".");
+  (void)out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+  out.close();
+  if (out.fail()) {
+    (void)std::remove(tmp_path.c_str());
+    RETURN_STATUS_UNEXPECTED("Failed to write source snapshot: " + tmp_path + ".");
+  }
+  if (std::rename(tmp_path.c_str(), file_path_.c_str()) != 0) {
+    // rename does not replace an existing file on Windows
+    (void)std::remove(file_path_.c_str());
+    if (std::rename(tmp_path.c_str(), file_path_.c_str()) != 0) {
+      (void)std::remove(tmp_path.c_str());
+      RETURN_STATUS_UNEXPECTED("Failed to save source snapshot: " + file_path_ + ".");
+    }
+  }
+  MS_LOG(INFO) << "Source snapshot " << file_path_ << " is saved.";
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SOURCE_SNAPSHOT_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SOURCE_SNAPSHOT_H_
+
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief Metadata of a source op kept in the directory set by set_source_snapshot_dir, e.g. the file list of a
+///     dataset directory or the parsed index of an annotation file, so that the next launch of the op with the same
+///     inputs skips scanning them.
+/// \note A snapshot records the size and the modification time of the files and directories it was built from, and
+///     it is only loaded if none of them has changed since. Directories change when files are added or removed.
+class SourceSnapshot {
+ public:
+  /// \brief Constructor.
+  /// \param[in] op_name Name of the op which owns the snapshot.
+  /// \param[in] key The arguments of the op which the metadata depends on, e.g. the dataset directory.
+  SourceSnapshot(const std::string &op_name, const std::string &key);
+
+  ~SourceSnapshot() = default;
+
+  /// \brief Whether a snapshot directory is set.
+  bool Enabled() const { return !file_path_.empty(); }
+
+  /// \brief Load the metadata if the snapshot exists, belongs to the same key and its inputs have not changed.
+  /// \note A broken or outdated snapshot is not an error, the op scans its inputs again and overwrites it.
+  /// \param[out] data The metadata passed to Save.
+  /// \return bool True if the metadata is loaded.
+  bool Load(nlohmann::json *data) const;
+
+  /// \brief Save the metadata together with the fingerprint of its inputs.
+  /// \param[in] inputs The files and directories the metadata is built from.
+  /// \param[in] data The metadata.
+  /// \return Status The status code returned.
+  Status Save(const std::vector<std::string> &inputs, const nlohmann::json &data) const;
+
+ private:
+  std::string key_;
+  std::string file_path_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SOURCE_SNAPSHOT_H_
@@ -36,9 +36,115 @@
 #include "minddata/dataset/util/wait_post.h"
 #include "proto/example.pb.h"
 #include "utils/file_utils.h"
+#include "utils/system/crc32c.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Field numbers and wire types of the protobuf encoding of dataengine::Example, see example.proto and feature.proto.
+constexpr uint32_t kExampleFeatures = 1;
+constexpr uint32_t kFeaturesFeature = 1;
+constexpr uint32_t kEntryKey = 1;
+constexpr uint32_t kEntryValue = 2;
+constexpr int32_t kBytesList = 1;
+constexpr int32_t kFloatList = 2;
+constexpr int32_t kInt64List = 3;
+constexpr uint32_t kListValue = 1;
+constexpr uint32_t kWireVarint = 0;
+constexpr uint32_t kWireFixed64 = 1;
+constexpr uint32_t kWireLengthDelimited = 2;
+constexpr uint32_t kWireFixed32 = 5;
+
+// A cursor over a protobuf message in wire format. All the read functions return false on malformed input.
+class WireReader {
+ public:
+  WireReader(const char *data, size_t size)
+      : pos_(reinterpret_cast<const uint8_t *>(data)), end_(reinterpret_cast<const uint8_t *>(data) + size) {}
+
+  bool Done() const { return pos_ >= end_; }
+
+  bool ReadVarint(uint64_t *value) {
+    uint64_t result = 0;
+    for (uint32_t shift = 0; shift < 64 && pos_ < end_; shift += 7) {
+      uint8_t byte = *pos_++;
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        *value = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadTag(uint32_t *field, uint32_t *wire_type) {
+    uint64_t tag = 0;
+    if (!ReadVarint(&tag)) {
+      return false;
+    }
+    *field = static_cast<uint32_t>(tag >> 3);
+    *wire_type = static_cast<uint32_t>(tag & 0x7);
+    return true;
+  }
+
+  bool ReadLengthDelimited(const char **data, size_t *size) {
+    uint64_t len = 0;
+    if (!ReadVarint(&len) || len > static_cast<uint64_t>(end_ - pos_)) {
+      return false;
+    }
+    *data = reinterpret_cast<const char *>(pos_);
+    *size = static_cast<size_t>(len);
+    pos_ += len;
+    return true;
+  }
+
+  bool ReadFixed32(const char **data) {
+    if (end_ - pos_ < static_cast<std::ptrdiff_t>(sizeof(uint32_t))) {
+      return false;
+    }
+    *data = reinterpret_cast<const char *>(pos_);
+    pos_ += sizeof(uint32_t);
+    return true;
+  }
+
+  bool Skip(uint32_t wire_type) {
+    uint64_t unused = 0;
+    const char *data = nullptr;
+    size_t size = 0;
+    switch (wire_type) {
+      case kWireVarint:
+        return ReadVarint(&unused);
+      case kWireFixed64:
+        if (end_ - pos_ < static_cast<std::ptrdiff_t>(sizeof(uint64_t))) {
+          return false;
+        }
+        pos_ += sizeof(uint64_t);
+        return true;
+      case kWireLengthDelimited:
+        return ReadLengthDelimited(&data, &size);
+      case kWireFixed32:
+        return ReadFixed32(&data);
+      default:
+        return false;
+    }
+  }
+
+ private:
+  const uint8_t *pos_;
+  const uint8_t *end_;
+};
+
+// Count the number of varints in a packed field.
+size_t CountVarints(const char *data, size_t size) {
+  size_t count = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if ((static_cast<uint8_t>(data[i]) & 0x80) == 0) {
+      ++count;
+    }
+  }
+  return count;
+}
+}  // namespace
+
 TFReaderOp::TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64_t total_num_rows,
                        std::vector<std::string> dataset_files_list, std::unique_ptr<DataSchema> data_schema,
                        int32_t op_connector_size, std::vector<std::string> columns_to_load, bool shuffle_files,
@@ -83,6 +189,18 @@ Status TFReaderOp::Init() {
     RETURN_IF_NOT_OK(CreateSchema(dataset_files_list_[0], columns_to_load_));
   }
 
+  // Look up the features of an Example by column name without building a string for each of them.
+  int32_t num_columns = data_schema_->NumColumns();
+  column_names_.clear();
+  column_names_.reserve(num_columns);
+  for (int32_t col = 0; col < num_columns; ++col) {
+    column_names_.push_back(data_schema_->Column(col).Name());
+  }
+  column_index_.clear();
+  for (int32_t col = 0; col < num_columns; ++col) {
+    column_index_[column_names_[col]] = col;
+  }
+
   if (total_rows_ == 0) {
     total_rows_ = data_schema_->NumRows();
   }
@@ -234,13 +352,15 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
   }
 
   std::ifstream reader;
-  reader.open(realpath.value());
+  reader.open(realpath.value(), std::ios::binary);
   if (!reader) {
     RETURN_STATUS_UNEXPECTED("Invalid file, " + filename + " open failed: permission denied!");
   }
 
   int64_t rows_read = 0;
   int64_t rows_total = 0;
+  // Reused by all the records of the file.
+  std::string serialized_example;
 
   while (reader.peek() != EOF) {
     if (!load_jagged_connector_) {
@@ -248,38 +368,39 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     }
     RETURN_IF_INTERRUPTED();
 
-    // read length
+    // read length and verify it against the crc header, so a corrupted length never gets to allocate memory
     int64_t record_length = 0;
+    uint32_t masked_crc = 0;
     (void)reader.read(reinterpret_cast<char *>(&record_length), static_cast<std::streamsize>(sizeof(int64_t)));
-
-    // ignore crc header
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
-
-    // read serialized Example
-    std::string serialized_example;
-    serialized_example.resize(record_length);
-    (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
-
-    int32_t num_columns = data_schema_->NumColumns();
-    TensorRow newRow(num_columns, nullptr);
+    (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+    if (!reader || masked_crc != system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<char *>(&record_length),
+                                                                    sizeof(int64_t))) {
+      RETURN_STATUS_UNEXPECTED("Invalid TFRecord file: " + filename + ", the length of record " +
+                               std::to_string(rows_total) + " is corrupted.");
+    }
 
     if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
-        MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
+      // read serialized Example and verify it against the crc footer
+      serialized_example.resize(record_length);
+      (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
+      (void)reader.read(reinterpret_cast<char *>(&masked_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+      if (!reader ||
+          masked_crc != system::Crc32c::GetMaskCrc32cValue(serialized_example.data(), serialized_example.size())) {
+        RETURN_STATUS_UNEXPECTED("Invalid TFRecord file: " + filename + ", the data of record " +
+                                 std::to_string(rows_total) + " is corrupted.");
       }
 
+      int32_t num_columns = data_schema_->NumColumns();
+      TensorRow newRow(num_columns, nullptr);
       std::vector<std::string> file_path(num_columns, filename);
       newRow.setPath(file_path);
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &newRow));
+      RETURN_IF_NOT_OK(LoadExample(serialized_example, &newRow));
       rows_read++;
       RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(newRow)));
+    } else {
+      // ignore the record and its crc footer
+      (void)reader.ignore(static_cast<std::streamsize>(record_length + sizeof(int32_t)));
     }
-
-    // ignore crc footer
-    (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
     rows_total++;
   }
 
@@ -287,69 +408,107 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
 }
 
 // Parses a single row and puts the data into a tensor table.
-Status TFReaderOp::LoadExample(const dataengine::Example *tf_file, TensorRow *out_row) {
+Status TFReaderOp::LoadExample(const std::string &serialized_example, TensorRow *out_row) {
+  const std::string err_msg = "Failed to parse tfrecord file, the Example is malformed.";
   int32_t num_columns = data_schema_->NumColumns();
+  std::vector<FeatureView> features(num_columns);
+
+  // Example { Features features = 1; } where Features { map<string, Feature> feature = 1; }
+  WireReader example(serialized_example.data(), serialized_example.size());
+  while (!example.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    CHECK_FAIL_RETURN_UNEXPECTED(example.ReadTag(&field, &wire_type), err_msg);
+    if (field != kExampleFeatures || wire_type != kWireLengthDelimited) {
+      CHECK_FAIL_RETURN_UNEXPECTED(example.Skip(wire_type), err_msg);
+      continue;
+    }
+    const char *features_data = nullptr;
+    size_t features_size = 0;
+    CHECK_FAIL_RETURN_UNEXPECTED(example.ReadLengthDelimited(&features_data, &features_size), err_msg);
+    WireReader feature_map(features_data, features_size);
+    while (!feature_map.Done()) {
+      CHECK_FAIL_RETURN_UNEXPECTED(feature_map.ReadTag(&field, &wire_type), err_msg);
+      if (field != kFeaturesFeature || wire_type != kWireLengthDelimited) {
+        CHECK_FAIL_RETURN_UNEXPECTED(feature_map.Skip(wire_type), err_msg);
+        continue;
+      }
+      const char *entry_data = nullptr;
+      size_t entry_size = 0;
+      CHECK_FAIL_RETURN_UNEXPECTED(feature_map.ReadLengthDelimited(&entry_data, &entry_size), err_msg);
+      // A map entry is { string key = 1; Feature value = 2; }
+      std::string_view key;
+      const char *value_data = nullptr;
+      size_t value_size = 0;
+      WireReader entry(entry_data, entry_size);
+      while (!entry.Done()) {
+        CHECK_FAIL_RETURN_UNEXPECTED(entry.ReadTag(&field, &wire_type), err_msg);
+        const char *data = nullptr;
+        size_t size = 0;
+        if (field == kEntryKey && wire_type == kWireLengthDelimited) {
+          CHECK_FAIL_RETURN_UNEXPECTED(entry.ReadLengthDelimited(&data, &size), err_msg);
+          key = std::string_view(data, size);
+        } else if (field == kEntryValue && wire_type == kWireLengthDelimited) {
+          CHECK_FAIL_RETURN_UNEXPECTED(entry.ReadLengthDelimited(&value_data, &value_size), err_msg);
+        } else {
+          CHECK_FAIL_RETURN_UNEXPECTED(entry.Skip(wire_type), err_msg);
+        }
+      }
+      auto iter_column = column_index_.find(key);
+      if (iter_column == column_index_.end()) {
+        continue;
+      }
+      // Feature { oneof kind { BytesList bytes_list = 1; FloatList float_list = 2; Int64List int64_list = 3; } }
+      FeatureView &feature = features[iter_column->second];
+      feature = FeatureView();
+      feature.found = true;
+      WireReader kind(value_data, value_size);
+      while (!kind.Done()) {
+        CHECK_FAIL_RETURN_UNEXPECTED(kind.ReadTag(&field, &wire_type), err_msg);
+        if (field >= kBytesList && field <= kInt64List && wire_type == kWireLengthDelimited) {
+          CHECK_FAIL_RETURN_UNEXPECTED(kind.ReadLengthDelimited(&feature.data, &feature.size), err_msg);
+          feature.kind = static_cast<int32_t>(field);
+        } else {
+          CHECK_FAIL_RETURN_UNEXPECTED(kind.Skip(wire_type), err_msg);
+        }
+      }
+    }
+  }
+
   for (int32_t col = 0; col < num_columns; ++col) {
-    const ColDescriptor current_col = data_schema_->Column(col);
-    const dataengine::Features &example_features = tf_file->features();
-    const google::protobuf::Map<std::string, dataengine::Feature> &feature_map = example_features.feature();
-    auto iter_column = feature_map.find(current_col.Name());
-    if (iter_column == feature_map.end()) {
+    const ColDescriptor &current_col = data_schema_->Column(col);
+    if (!features[col].found) {
       RETURN_STATUS_UNEXPECTED("Invalid columns_list, column name: " + current_col.Name() +
                                " does not exist in tfrecord file, check tfrecord files.");
     }
-    const dataengine::Feature &column_values_list = iter_column->second;
-    RETURN_IF_NOT_OK(LoadFeature(out_row, column_values_list, current_col, col));
+    RETURN_IF_NOT_OK(LoadFeature(out_row, features[col], current_col, col));
   }
 
   return Status::OK();
 }
 
 // Parses a single cell and puts the data into a tensor table.
-Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature &column_values_list,
-                               const ColDescriptor &current_col, int32_t col) {
-  const dataengine::Feature::KindCase column_list_type = column_values_list.kind_case();
-  std::unique_ptr<float[]> float_array;     // For staging data from protobuf deserialization
-  const unsigned char *data_ptr = nullptr;  // Generic pointer used for populating the Tensor
-
-  // This variable will point into the above staging variables.
+Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const FeatureView &feature, const ColDescriptor &current_col,
+                               int32_t col) {
   // Also used for creating shape attributes.
   int32_t num_elements = 0;
 
-  // we build a tensor first a read directly into it if we need to cast
+  // we build the tensor first and decode the list directly into it
   std::shared_ptr<Tensor> ts;
 
-  // Depending on the type of data from the tf_file, we want to extract 2 things:
-  // 1) A pointer to the data as a const unsigned char *
-  // 2) The number of elements of the data
-  // After those are determined, we can then build the tensor to represent this data.
-  switch (column_list_type) {
-    case dataengine::Feature::KindCase::kBytesList: {
-      RETURN_IF_NOT_OK(LoadBytesList(current_col, column_values_list, &num_elements, &ts));
-
+  switch (feature.kind) {
+    case kBytesList: {
+      RETURN_IF_NOT_OK(LoadBytesList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kFloatList: {
-      RETURN_IF_NOT_OK(LoadFloatList(current_col, column_values_list, &num_elements, &float_array));
-
-      data_ptr = reinterpret_cast<const unsigned char *>(float_array.get());
-
-      // only floatList needs to create the tensor here, other two lists read directly
-      // into the tensor
-      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
-      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(num_elements, &current_shape));
-      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(current_shape, current_col.Type(), data_ptr, &ts));
+    case kFloatList: {
+      RETURN_IF_NOT_OK(LoadFloatList(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::kInt64List: {
-      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, column_values_list, &num_elements, &ts));
+    case kInt64List: {
+      RETURN_IF_NOT_OK(LoadIntListSwitch(current_col, feature, &num_elements, &ts));
       break;
     }
-    case dataengine::Feature::KindCase::KIND_NOT_SET: {
-      std::string err_msg =
-        "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
-      RETURN_STATUS_UNEXPECTED(err_msg);
-    }
     default: {
       std::string err_msg =
         "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
@@ -362,8 +521,8 @@ Status TFReaderOp::LoadFeature(TensorRow *tensor_row, const dataengine::Feature
   return Status::OK();
 }
 
-Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                                 int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
+Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const FeatureView &feature, int32_t *num_elements,
+                                 std::shared_ptr<Tensor> *tensor) {
   // kBytesList can map to the following DE types ONLY!
   // DE_UINT8, DE_INT8
   // Must be single byte type for each element!
@@ -374,24 +533,36 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::BytesList &bytes_list = column_values_list.bytes_list();
+  // BytesList { repeated bytes value = 1; }
+  std::vector<std::string_view> bytes_list;
+  WireReader list(feature.data, feature.size);
+  while (!list.Done()) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    const char *data = nullptr;
+    size_t size = 0;
+    CHECK_FAIL_RETURN_UNEXPECTED(list.ReadTag(&field, &wire_type), "Failed to parse the bytes list.");
+    if (field == kListValue && wire_type == kWireLengthDelimited) {
+      CHECK_FAIL_RETURN_UNEXPECTED(list.ReadLengthDelimited(&data, &size), "Failed to parse the bytes list.");
+      bytes_list.emplace_back(data, size);
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(list.Skip(wire_type), "Failed to parse the bytes list.");
+    }
+  }
 
-  *num_elements = bytes_list.value_size();
+  *num_elements = static_cast<int32_t>(bytes_list.size());
 
   if (current_col.Type() == DataType::DE_STRING) {
     TensorShape shape = TensorShape::CreateScalar();
     RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &shape));
-    RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, shape, tensor));
+    std::vector<std::string> strings(bytes_list.begin(), bytes_list.end());
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(strings, shape, tensor));
     return Status::OK();
   }
 
   uint64_t max_size = 0;
-  for (uint32_t i = 0; i < bytes_list.value_size(); ++i) {
-#if defined(__APPLE__)
-    max_size = fmax(max_size, bytes_list.value(i).size());
-#else
-    max_size = std::max(max_size, bytes_list.value(i).size());
-#endif
+  for (const auto &element : bytes_list) {
+    max_size = std::max<uint64_t>(max_size, element.size());
   }
 
   int64_t pad_size = max_size;
@@ -422,16 +593,39 @@ Status TFReaderOp::LoadBytesList(const ColDescriptor &current_col, const dataeng
     }
   }
 
-  // know how many elements there are and the total bytes, create tensor here:
+  // know how many elements there are and the total bytes, create tensor here and copy each element padded with ' '
   TensorShape current_shape = TensorShape::CreateScalar();
   RETURN_IF_NOT_OK(current_col.MaterializeTensorShape((*num_elements) * pad_size, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateFromByteList(bytes_list, current_shape, current_col.Type(), pad_size, tensor));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  unsigned char *current_tensor_addr = (*tensor)->GetMutableBuffer();
+  int64_t tensor_bytes_remaining = (*num_elements) * pad_size;
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int64_t>((*tensor)->SizeInBytes()) >= tensor_bytes_remaining,
+                               "Data dimensions of '" + current_col.Name() + "' do not match the shape.");
+  for (const auto &element : bytes_list) {
+    CHECK_FAIL_RETURN_UNEXPECTED(static_cast<int64_t>(element.size()) <= pad_size,
+                                 "Data dimensions of '" + current_col.Name() + "' do not match the shape.");
+    if (!element.empty()) {
+      int ret_code = memcpy_s(current_tensor_addr, tensor_bytes_remaining, element.data(), element.size());
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "memcpy_s failed when reading bytesList element into Tensor");
+    }
+    current_tensor_addr += element.size();
+    tensor_bytes_remaining -= element.size();
+
+    // pad
+    int64_t chars_to_pad = pad_size - element.size();
+    if (chars_to_pad > 0) {
+      int ret_code = memset_s(current_tensor_addr, tensor_bytes_remaining, static_cast<int>(' '), chars_to_pad);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "memset_s failed when padding Tensor");
+    }
+    current_tensor_addr += chars_to_pad;
+    tensor_bytes_remaining -= chars_to_pad;
+  }
 
   return Status::OK();
 }
 
-Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                                 int32_t *num_elements, std::unique_ptr<float[]> *float_array) {
+Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const FeatureView &feature, int32_t *num_elements,
+                                 std::shared_ptr<Tensor> *tensor) {
   // KFloatList can only map to DE types:
   // DE_FLOAT32
   if (current_col.Type() != DataType::DE_FLOAT32) {
@@ -440,38 +634,75 @@ Status TFReaderOp::LoadFloatList(const ColDescriptor &current_col, const dataeng
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::FloatList &float_list = column_values_list.float_list();
-
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = float_list.value_size();
-  *float_array = std::make_unique<float[]>(*num_elements);
-  for (int i = 0; i < float_list.value_size(); ++i) {
-    (*float_array)[i] = float_list.value(i);
+  // FloatList { repeated float value = 1 [packed = true]; }, which may also be written unpacked.
+  // The first pass counts the values so the tensor can be created, the second pass copies them into it.
+  const std::string err_msg = "Failed to parse the float list of " + current_col.Name() + ".";
+  size_t count = 0;
+  size_t bytes_remaining = 0;
+  for (int pass = 0; pass < 2; ++pass) {
+    unsigned char *dest = pass == 0 ? nullptr : (*tensor)->GetMutableBuffer();
+    WireReader list(feature.data, feature.size);
+    while (!list.Done()) {
+      uint32_t field = 0;
+      uint32_t wire_type = 0;
+      const char *data = nullptr;
+      size_t size = 0;
+      CHECK_FAIL_RETURN_UNEXPECTED(list.ReadTag(&field, &wire_type), err_msg);
+      if (field == kListValue && wire_type == kWireLengthDelimited) {
+        CHECK_FAIL_RETURN_UNEXPECTED(list.ReadLengthDelimited(&data, &size), err_msg);
+        CHECK_FAIL_RETURN_UNEXPECTED(size % sizeof(float) == 0, err_msg);
+      } else if (field == kListValue && wire_type == kWireFixed32) {
+        CHECK_FAIL_RETURN_UNEXPECTED(list.ReadFixed32(&data), err_msg);
+        size = sizeof(float);
+      } else {
+        CHECK_FAIL_RETURN_UNEXPECTED(list.Skip(wire_type), err_msg);
+        continue;
+      }
+      if (pass == 0) {
+        count += size / sizeof(float);
+      } else if (size > 0 && bytes_remaining > 0) {
+        // Floats are little endian on the wire, the same as in the tensor.
+        size = std::min(size, bytes_remaining);
+        int ret_code = memcpy_s(dest, bytes_remaining, data, size);
+        CHECK_FAIL_RETURN_UNEXPECTED(ret_code == 0, "memcpy_s failed when reading floatList into Tensor");
+        dest += size;
+        bytes_remaining -= size;
+      }
+    }
+    if (pass == 0) {
+      *num_elements = static_cast<int32_t>(count);
+      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+      // The shape may take only the leading values of the list.
+      bytes_remaining = static_cast<size_t>((*tensor)->Size()) * sizeof(float);
+      CHECK_FAIL_RETURN_UNEXPECTED(bytes_remaining <= count * sizeof(float),
+                                   "Data dimensions of '" + current_col.Name() + "' do not match the shape.");
+    }
   }
 
   return Status::OK();
 }
 
 // Determines which template type to use and calls LoadIntList
-Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
+Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const FeatureView &feature,
                                      int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
   if (current_col.Type() == DataType::DE_UINT64) {
-    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT64) {
-    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int64_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT32) {
-    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT32) {
-    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int32_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT16) {
-    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT16) {
-    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int16_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_UINT8) {
-    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<uint8_t>(current_col, feature, num_elements, tensor));
   } else if (current_col.Type() == DataType::DE_INT8) {
-    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, column_values_list, num_elements, tensor));
+    RETURN_IF_NOT_OK(LoadIntList<int8_t>(current_col, feature, num_elements, tensor));
   } else {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
                           " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
@@ -482,33 +713,67 @@ Status TFReaderOp::LoadIntListSwitch(const ColDescriptor &current_col, const dat
   return Status::OK();
 }
 
-// Reads values from a bytes list and casts the value to type T, must be an integral type
+// Reads values from an int64 list and casts the value to type T, must be an integral type
 // compatible with int64_t
 template <typename T>
-Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
-                               int32_t *num_elements, std::shared_ptr<Tensor> *tensor) {
+Status TFReaderOp::LoadIntList(const ColDescriptor &current_col, const FeatureView &feature, int32_t *num_elements,
+                               std::shared_ptr<Tensor> *tensor) {
   if (!(current_col.Type().IsInt())) {
     std::string err_msg = "Invalid column type, the column type of " + current_col.Name() + " should be int, but got " +
                           current_col.Type().ToString();
     RETURN_STATUS_UNEXPECTED(err_msg);
   }
 
-  const dataengine::Int64List &int64_list = column_values_list.int64_list();
-
-  // Identify how many values we have and then create a local array of these
-  // to deserialize into
-  *num_elements = int64_list.value_size();
-
-  // know how many elements there are, create tensor here:
-  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
-  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
-  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
-
-  int64_t i = 0;
-  auto it = (*tensor)->begin<T>();
-  for (; it != (*tensor)->end<T>(); i++, ++it) {
-    T element = static_cast<T>(int64_list.value(i));
-    *it = element;
+  // Int64List { repeated int64 value = 1 [packed = true]; }, which may also be written unpacked.
+  // The first pass counts the values so the tensor can be created, the second pass decodes them into it.
+  const std::string err_msg = "Failed to parse the int64 list of " + current_col.Name() + ".";
+  size_t count = 0;
+  size_t remaining = 0;
+  for (int pass = 0; pass < 2 && (pass == 0 || remaining > 0); ++pass) {
+    T *dest = pass == 0 ? nullptr : reinterpret_cast<T *>((*tensor)->GetMutableBuffer());
+    WireReader list(feature.data, feature.size);
+    while (!list.Done()) {
+      uint32_t field = 0;
+      uint32_t wire_type = 0;
+      uint64_t value = 0;
+      CHECK_FAIL_RETURN_UNEXPECTED(list.ReadTag(&field, &wire_type), err_msg);
+      if (field == kListValue && wire_type == kWireLengthDelimited) {
+        const char *data = nullptr;
+        size_t size = 0;
+        CHECK_FAIL_RETURN_UNEXPECTED(list.ReadLengthDelimited(&data, &size), err_msg);
+        if (pass == 0) {
+          count += CountVarints(data, size);
+          continue;
+        }
+        WireReader packed(data, size);
+        while (!packed.Done() && remaining > 0) {
+          CHECK_FAIL_RETURN_UNEXPECTED(packed.ReadVarint(&value), err_msg);
+          *dest++ = static_cast<T>(static_cast<int64_t>(value));
+          --remaining;
+        }
+      } else if (field == kListValue && wire_type == kWireVarint) {
+        CHECK_FAIL_RETURN_UNEXPECTED(list.ReadVarint(&value), err_msg);
+        if (pass == 0) {
+          ++count;
+        } else if (remaining > 0) {
+          *dest++ = static_cast<T>(static_cast<int64_t>(value));
+          --remaining;
+        }
+      } else {
+        CHECK_FAIL_RETURN_UNEXPECTED(list.Skip(wire_type), err_msg);
+      }
+    }
+    if (pass == 0) {
+      *num_elements = static_cast<int32_t>(count);
+      // know how many elements there are, create tensor here:
+      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(*num_elements, &current_shape));
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+      // The shape may take only the leading values of the list.
+      remaining = static_cast<size_t>((*tensor)->Size());
+      CHECK_FAIL_RETURN_UNEXPECTED(remaining <= count,
+                                   "Data dimensions of '" + current_col.Name() + "' do not match the shape.");
+    }
   }
 
   return Status::OK();
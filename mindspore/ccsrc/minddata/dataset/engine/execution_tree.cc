@@ -157,8 +157,11 @@ Status ExecutionTree::Launch() {
   // if we do numa bind when get_dataset_size launch a tree, we'll get a
   // better performance than only we do numa bind at the time _To_Device
   // launch a tree. Our numa bind work is a process level bind, bind with
-  // both cpu and memory and we choose numa_node with a polling logic:
-  // numa_bind_id = rank_id_ % (numa_max_node() + 1)
+  // both cpu and memory, so the workers of all ops and their allocations
+  // stay on the numa node. We choose the numa node the device is attached
+  // to, where the device is the one the DataQueueOp feeds or the rank_id_
+  // if there is no DataQueueOp. If the device locality is unknown, we fall
+  // back to a polling logic: numa_bind_id = rank_id_ % (numa_max_node() + 1)
   // Now we only support GPU scenario and the single process scenario of Ascend,
   // now we remove the target_link of numa with _c_dataengine, and user can use
   // a config api to control whether to open numa feature.
@@ -169,8 +172,20 @@ Status ExecutionTree::Launch() {
         RETURN_STATUS_UNEXPECTED("Numa package (libnuma.so) not found.");
       }
     }
-    RETURN_IF_NOT_OK(NumaBind(handle_.get(), rank_id_));
-    MS_LOG(INFO) << "Numa bind memory and cpu successful.";
+    int32_t device_id = rank_id_;
+    auto *data_queue_op = dynamic_cast<DataQueueOp *>(root_.get());
+    if (data_queue_op != nullptr && data_queue_op->device_type() != DataQueueOp::DeviceType::CPU) {
+      device_id = data_queue_op->device_id();
+    }
+    int32_t numa_node = GetDeviceNumaNode(device_id);
+    if (numa_node >= 0) {
+      RETURN_IF_NOT_OK(NumaBindNode(handle_.get(), numa_node));
+      MS_LOG(INFO) << "Numa bind memory and cpu to numa node " << numa_node << " of device " << device_id
+                   << " successful.";
+    } else {
+      RETURN_IF_NOT_OK(NumaBind(handle_.get(), rank_id_));
+      MS_LOG(INFO) << "Numa bind memory and cpu successful.";
+    }
   }
 #endif
   int32_t thread_num = get_nprocs();
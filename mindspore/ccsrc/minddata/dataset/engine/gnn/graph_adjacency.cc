@@ -0,0 +1,255 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/gnn/graph_adjacency.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+
+Status GraphAdjacency::Init(const std::vector<NodeIdType> &node_ids) {
+  CHECK_FAIL_RETURN_UNEXPECTED(node_row_.empty(), "[Internal Error] Adjacency of graph can only be initialized once.");
+  CHECK_FAIL_RETURN_UNEXPECTED(node_ids.size() < static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                               "Invalid data, the number of nodes exceeds the limit of int32.");
+  node_row_.reserve(node_ids.size());
+  for (size_t i = 0; i < node_ids.size(); ++i) {
+    node_row_.emplace(node_ids[i], static_cast<int32_t>(i));
+  }
+  return Status::OK();
+}
+
+Status GraphAdjacency::GetRow(NodeIdType id, int32_t *row) const {
+  auto itr = node_row_.find(id);
+  if (itr == node_row_.end()) {
+    std::string err_msg = "Invalid node id:" + std::to_string(id);
+    RETURN_STATUS_UNEXPECTED(err_msg);
+  }
+  *row = itr->second;
+  return Status::OK();
+}
+
+Status GraphAdjacency::CountEdge(NodeIdType src, NodeType neighbor_type) {
+  int32_t row = 0;
+  RETURN_IF_NOT_OK(GetRow(src, &row));
+  NeighborTable &table = tables_[neighbor_type];
+  if (table.offsets.empty()) {
+    table.offsets.resize(node_row_.size() + 1, 0);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(table.fill_position.empty(),
+                               "[Internal Error] Edges of graph can't be counted after they are added.");
+  // count in offsets[row + 1], which becomes the end of the row after the prefix sum
+  table.offsets[row + 1]++;
+  return Status::OK();
+}
+
+Status GraphAdjacency::AddEdge(NodeIdType src, NodeIdType dst, NodeType neighbor_type, WeightType weight) {
+  int32_t row = 0;
+  RETURN_IF_NOT_OK(GetRow(src, &row));
+  auto itr = tables_.find(neighbor_type);
+  CHECK_FAIL_RETURN_UNEXPECTED(itr != tables_.end(), "[Internal Error] Edge from node " + std::to_string(src) +
+                                                       " to node " + std::to_string(dst) + " is not counted.");
+  NeighborTable &table = itr->second;
+  if (table.fill_position.empty()) {
+    std::partial_sum(table.offsets.begin(), table.offsets.end(), table.offsets.begin());
+    table.fill_position.assign(table.offsets.begin(), table.offsets.end() - 1);
+    table.neighbors.resize(table.offsets.back());
+    table.alias_prob.resize(table.offsets.back());
+    table.alias_index.resize(table.offsets.back());
+  }
+  int64_t pos = table.fill_position[row]++;
+  CHECK_FAIL_RETURN_UNEXPECTED(pos < table.offsets[row + 1], "[Internal Error] Edge from node " + std::to_string(src) +
+                                                               " to node " + std::to_string(dst) + " is not counted.");
+  table.neighbors[pos] = dst;
+  // keep the weight in the alias table until it is built
+  table.alias_prob[pos] = weight;
+  return Status::OK();
+}
+
+Status GraphAdjacency::Finalize() {
+  std::vector<int32_t> small;
+  std::vector<int32_t> large;
+  for (auto &item : tables_) {
+    NeighborTable &table = item.second;
+    for (size_t row = 0; row + 1 < table.offsets.size(); ++row) {
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        !table.fill_position.empty() && table.fill_position[row] == table.offsets[row + 1],
+        "[Internal Error] The number of added edges of graph is not equal to the number of counted edges.");
+      int64_t begin = table.offsets[row];
+      int64_t num = table.offsets[row + 1] - begin;
+      CHECK_FAIL_RETURN_UNEXPECTED(num <= std::numeric_limits<int32_t>::max(),
+                                   "Invalid data, the number of neighbors exceeds the limit of int32.");
+      BuildAliasTable(num, table.alias_prob.data() + begin, table.alias_index.data() + begin, &small, &large);
+    }
+    std::vector<int64_t>().swap(table.fill_position);
+  }
+  return Status::OK();
+}
+
+void GraphAdjacency::BuildAliasTable(int64_t num, float *prob, int32_t *alias, std::vector<int32_t> *small,
+                                     std::vector<int32_t> *large) {
+  // Vose's alias method: each slot keeps its own neighbor with probability prob, otherwise it is replaced by alias
+  double sum = 0.0;
+  for (int64_t i = 0; i < num; ++i) {
+    sum += std::max(prob[i], 0.0f);
+  }
+  if (!(sum > 0.0) || !std::isfinite(sum)) {
+    // all weights are zero, fall back to uniform sampling
+    std::fill(prob, prob + num, 1.0f);
+    std::iota(alias, alias + num, 0);
+    return;
+  }
+  small->clear();
+  large->clear();
+  for (int64_t i = 0; i < num; ++i) {
+    prob[i] = static_cast<float>(std::max(prob[i], 0.0f) * num / sum);
+    alias[i] = static_cast<int32_t>(i);
+    if (prob[i] < 1.0f) {
+      small->push_back(static_cast<int32_t>(i));
+    } else {
+      large->push_back(static_cast<int32_t>(i));
+    }
+  }
+  while (!small->empty() && !large->empty()) {
+    int32_t less = small->back();
+    small->pop_back();
+    int32_t more = large->back();
+    alias[less] = more;
+    prob[more] = (prob[more] + prob[less]) - 1.0f;
+    if (prob[more] < 1.0f) {
+      large->pop_back();
+      small->push_back(more);
+    }
+  }
+  // whatever is left is 1 up to rounding errors
+  for (auto i : *small) {
+    prob[i] = 1.0f;
+  }
+  for (auto i : *large) {
+    prob[i] = 1.0f;
+  }
+}
+
+Status GraphAdjacency::GetNeighbors(NodeIdType id, NodeType neighbor_type, const NodeIdType **neighbors,
+                                    int64_t *num_neighbors) const {
+  RETURN_UNEXPECTED_IF_NULL(neighbors);
+  RETURN_UNEXPECTED_IF_NULL(num_neighbors);
+  int32_t row = 0;
+  RETURN_IF_NOT_OK(GetRow(id, &row));
+  auto itr = tables_.find(neighbor_type);
+  if (itr == tables_.end()) {
+    *neighbors = nullptr;
+    *num_neighbors = 0;
+    return Status::OK();
+  }
+  const NeighborTable &table = itr->second;
+  *neighbors = table.neighbors.data() + table.offsets[row];
+  *num_neighbors = table.offsets[row + 1] - table.offsets[row];
+  return Status::OK();
+}
+
+Status GraphAdjacency::SampleNeighbors(const NodeIdType *nodes, size_t num_nodes, NodeType neighbor_type,
+                                       int32_t samples_num, SamplingStrategy strategy, std::mt19937 *rnd,
+                                       NodeIdType *out) const {
+  RETURN_UNEXPECTED_IF_NULL(nodes);
+  RETURN_UNEXPECTED_IF_NULL(rnd);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  if (strategy != SamplingStrategy::kRandom && strategy != SamplingStrategy::kEdgeWeight) {
+    RETURN_STATUS_UNEXPECTED("Invalid strategy");
+  }
+  auto itr = tables_.find(neighbor_type);
+  const NeighborTable *table = itr == tables_.end() ? nullptr : &itr->second;
+  std::vector<int64_t> scratch;
+  for (size_t i = 0; i < num_nodes; ++i) {
+    NodeIdType *node_out = out + i * samples_num;
+    int64_t begin = 0;
+    int64_t num = 0;
+    if (nodes[i] != kDefaultNodeId) {
+      int32_t row = 0;
+      RETURN_IF_NOT_OK(GetRow(nodes[i], &row));
+      if (table != nullptr) {
+        begin = table->offsets[row];
+        num = table->offsets[row + 1] - begin;
+      }
+    }
+    if (num == 0) {
+      // If there are no neighbors, they are filled with kDefaultNodeId
+      std::fill(node_out, node_out + samples_num, kDefaultNodeId);
+    } else if (strategy == SamplingStrategy::kRandom) {
+      SampleRandom(table->neighbors.data() + begin, num, samples_num, rnd, &scratch, node_out);
+    } else {
+      SampleWeighted(table->neighbors.data() + begin, table->alias_prob.data() + begin,
+                     table->alias_index.data() + begin, num, samples_num, rnd, node_out);
+    }
+  }
+  return Status::OK();
+}
+
+void GraphAdjacency::SampleRandom(const NodeIdType *neighbors, int64_t num_neighbors, int32_t samples_num,
+                                  std::mt19937 *rnd, std::vector<int64_t> *scratch, NodeIdType *out) {
+  // Each round samples every neighbor once in a random order, until less than a round is left.
+  int64_t filled = 0;
+  while (samples_num - filled >= num_neighbors) {
+    std::copy(neighbors, neighbors + num_neighbors, out + filled);
+    std::shuffle(out + filled, out + filled + num_neighbors, *rnd);
+    filled += num_neighbors;
+  }
+  int64_t remaining = samples_num - filled;
+  if (remaining == 0) {
+    return;
+  }
+  // The last round samples the remaining neighbors without replacement.
+  scratch->clear();
+  if (remaining * remaining < num_neighbors) {
+    // Floyd's algorithm, which does not touch all neighbors of a high degree node
+    for (int64_t j = num_neighbors - remaining; j < num_neighbors; ++j) {
+      int64_t picked = std::uniform_int_distribution<int64_t>(0, j)(*rnd);
+      if (std::find(scratch->begin(), scratch->end(), picked) != scratch->end()) {
+        picked = j;
+      }
+      scratch->push_back(picked);
+    }
+    std::shuffle(scratch->begin(), scratch->end(), *rnd);
+  } else {
+    // partial Fisher-Yates shuffle
+    scratch->resize(num_neighbors);
+    std::iota(scratch->begin(), scratch->end(), 0);
+    for (int64_t j = 0; j < remaining; ++j) {
+      int64_t picked = std::uniform_int_distribution<int64_t>(j, num_neighbors - 1)(*rnd);
+      std::swap((*scratch)[j], (*scratch)[picked]);
+    }
+  }
+  for (int64_t j = 0; j < remaining; ++j) {
+    out[filled + j] = neighbors[(*scratch)[j]];
+  }
+}
+
+void GraphAdjacency::SampleWeighted(const NodeIdType *neighbors, const float *prob, const int32_t *alias,
+                                    int64_t num_neighbors, int32_t samples_num, std::mt19937 *rnd, NodeIdType *out) {
+  std::uniform_int_distribution<int64_t> slot_dist(0, num_neighbors - 1);
+  std::uniform_real_distribution<float> prob_dist(0.0f, 1.0f);
+  for (int32_t i = 0; i < samples_num; ++i) {
+    int64_t slot = slot_dist(*rnd);
+    out[i] = prob_dist(*rnd) < prob[slot] ? neighbors[slot] : neighbors[alias[slot]];
+  }
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_ADJACENCY_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_ADJACENCY_H_
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/include/dataset/constants.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+
+// Adjacency of all nodes in compressed sparse row (CSR) format, one table per type of neighbor.
+// The neighbors of a node are stored contiguously in flat arrays together with an alias table of the edge weights,
+// so neighbors are read and sampled without touching any Node object, and a weighted sample costs O(1).
+// The table is built in two passes over the edges: CountEdge for all edges, then AddEdge for all edges in the same
+// order, followed by Finalize.
+class GraphAdjacency {
+ public:
+  GraphAdjacency() = default;
+
+  ~GraphAdjacency() = default;
+
+  // Assign a row of the tables to each node, must be called before any edge is counted
+  // @param std::vector<NodeIdType> &node_ids - ids of all nodes in the graph
+  // @return Status The status code returned
+  Status Init(const std::vector<NodeIdType> &node_ids);
+
+  // Count an edge in the first pass
+  // @param NodeIdType src - id of the source node
+  // @param NodeType neighbor_type - type of the destination node
+  // @return Status The status code returned
+  Status CountEdge(NodeIdType src, NodeType neighbor_type);
+
+  // Add an edge in the second pass, the neighbors of a node keep the order in which their edges are added
+  // @param NodeIdType src - id of the source node
+  // @param NodeIdType dst - id of the destination node
+  // @param NodeType neighbor_type - type of the destination node
+  // @param WeightType weight - weight of the edge
+  // @return Status The status code returned
+  Status AddEdge(NodeIdType src, NodeIdType dst, NodeType neighbor_type, WeightType weight);
+
+  // Build the alias tables once all edges are added
+  // @return Status The status code returned
+  Status Finalize();
+
+  // Get all neighbors of a node, the returned address is valid as long as the adjacency
+  // @param NodeIdType id - id of the node
+  // @param NodeType neighbor_type - type of neighbor
+  // @param const NodeIdType **neighbors - Returned address of the first neighbor
+  // @param int64_t *num_neighbors - Returned number of neighbors
+  // @return Status The status code returned
+  Status GetNeighbors(NodeIdType id, NodeType neighbor_type, const NodeIdType **neighbors,
+                      int64_t *num_neighbors) const;
+
+  // Sample neighbors for a batch of nodes. Nodes with kDefaultNodeId or without neighbors get kDefaultNodeId.
+  // @param const NodeIdType *nodes - ids of the nodes
+  // @param size_t num_nodes - number of nodes
+  // @param NodeType neighbor_type - type of neighbor
+  // @param int32_t samples_num - Number of neighbors to be sampled for each node
+  // @param SamplingStrategy strategy - Sampling strategy
+  // @param std::mt19937 *rnd - random generator
+  // @param NodeIdType *out - Returned neighbors, samples_num for each node
+  // @return Status The status code returned
+  Status SampleNeighbors(const NodeIdType *nodes, size_t num_nodes, NodeType neighbor_type, int32_t samples_num,
+                         SamplingStrategy strategy, std::mt19937 *rnd, NodeIdType *out) const;
+
+ private:
+  struct NeighborTable {
+    std::vector<int64_t> offsets;        // neighbors of the node in row i are in [offsets[i], offsets[i + 1])
+    std::vector<NodeIdType> neighbors;   // ids of the neighbors
+    std::vector<float> alias_prob;       // probability to keep the neighbor picked from the alias table
+    std::vector<int32_t> alias_index;    // the alternative of the neighbor, relative to the first neighbor of the row
+    std::vector<int64_t> fill_position;  // next position to add a neighbor of each row, only used while building
+  };
+
+  Status GetRow(NodeIdType id, int32_t *row) const;
+
+  static void BuildAliasTable(int64_t num, float *prob, int32_t *alias, std::vector<int32_t> *small,
+                              std::vector<int32_t> *large);
+
+  static void SampleRandom(const NodeIdType *neighbors, int64_t num_neighbors, int32_t samples_num,
+                           std::mt19937 *rnd, std::vector<int64_t> *scratch, NodeIdType *out);
+
+  static void SampleWeighted(const NodeIdType *neighbors, const float *prob, const int32_t *alias,
+                             int64_t num_neighbors, int32_t samples_num, std::mt19937 *rnd, NodeIdType *out);
+
+  std::unordered_map<NodeIdType, int32_t> node_row_;
+  std::unordered_map<NodeType, NeighborTable> tables_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_ADJACENCY_H_
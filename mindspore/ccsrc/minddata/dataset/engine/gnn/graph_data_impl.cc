@@ -176,16 +176,14 @@ Status GraphDataImpl::GetAllNeighbors(const std::vector<NodeIdType> &node_list,
   // Collect information of adjacent table
   neighbors.resize(node_list.size());
   for (size_t i = 0; i < node_list.size(); ++i) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[i], &node));
     if (format == OutputFormat::kNormal) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i]));
+      RETURN_IF_NOT_OK(GetNodeNeighbors(node_list[i], neighbor_type, &neighbors[i]));
       max_neighbor_num = max_neighbor_num > neighbors[i].size() ? max_neighbor_num : neighbors[i].size();
     } else if (format == OutputFormat::kCoo) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(GetNodeNeighbors(node_list[i], neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
     } else {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(GetNodeNeighbors(node_list[i], neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
       if (i < node_list.size() - 1) {
         offset_table[i + 1] = total_edge_num;
@@ -262,33 +260,41 @@ Status GraphDataImpl::GetSampledNeighbors(const std::vector<NodeIdType> &node_li
     RETURN_IF_NOT_OK(CheckNeighborType(type));
   }
   RETURN_UNEXPECTED_IF_NULL(out);
-  std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
-  for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
+  for (const auto &node_id : node_list) {
     std::shared_ptr<Node> input_node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &input_node));
-    neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
-    std::vector<NodeIdType> input_list = {node_list[node_idx]};
-    for (size_t i = 0; i < neighbor_nums.size(); ++i) {
-      std::vector<NodeIdType> neighbors;
-      neighbors.reserve(input_list.size() * neighbor_nums[i]);
-      for (const auto &node_id : input_list) {
-        if (node_id == kDefaultNodeId) {
-          for (int32_t j = 0; j < neighbor_nums[i]; ++j) {
-            neighbors.emplace_back(kDefaultNodeId);
-          }
-        } else {
-          std::shared_ptr<Node> node;
-          RETURN_IF_NOT_OK(GetNodeByNodeId(node_id, &node));
-          std::vector<NodeIdType> out;
-          RETURN_IF_NOT_OK(node->GetSampledNeighbors(neighbor_types[i], neighbor_nums[i], strategy, &out, &rnd_));
-          neighbors.insert(neighbors.end(), out.begin(), out.end());
-        }
-      }
-      neighbors_vec[node_idx].insert(neighbors_vec[node_idx].end(), neighbors.begin(), neighbors.end());
-      input_list = std::move(neighbors);
+    RETURN_IF_NOT_OK(GetNodeByNodeId(node_id, &input_node));
+  }
+
+  // Each row of the output is [node, neighbors of hop 1, neighbors of hop 2, ...]. Every hop is sampled for all
+  // nodes in one batch from the adjacency, the frontier of a hop keeps the neighbors of each node together.
+  size_t row_size = 1;
+  size_t hop_size = 1;
+  std::vector<size_t> hop_offsets;
+  for (const auto &num : neighbor_nums) {
+    hop_offsets.push_back(row_size);
+    hop_size *= num;
+    row_size += hop_size;
+  }
+  std::vector<NodeIdType> neighbors_vec(node_list.size() * row_size);
+  for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
+    neighbors_vec[node_idx * row_size] = node_list[node_idx];
+  }
+  std::vector<NodeIdType> input_list = node_list;
+  std::vector<NodeIdType> neighbors;
+  hop_size = 1;
+  for (size_t i = 0; i < neighbor_nums.size(); ++i) {
+    neighbors.resize(input_list.size() * neighbor_nums[i]);
+    RETURN_IF_NOT_OK(adjacency_.SampleNeighbors(input_list.data(), input_list.size(), neighbor_types[i],
+                                                neighbor_nums[i], strategy, &rnd_, neighbors.data()));
+    hop_size *= neighbor_nums[i];
+    for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
+      std::copy(neighbors.begin() + node_idx * hop_size, neighbors.begin() + (node_idx + 1) * hop_size,
+                neighbors_vec.begin() + node_idx * row_size + hop_offsets[i]);
     }
+    std::swap(input_list, neighbors);
   }
-  RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(neighbors_vec, DataType(DataType::DE_INT32), out));
+  RETURN_IF_NOT_OK(Tensor::CreateFromVector(
+    neighbors_vec, TensorShape({static_cast<dsize_t>(node_list.size()), static_cast<dsize_t>(row_size)}), out));
   return Status::OK();
 }
 
@@ -330,15 +336,13 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
   std::vector<std::vector<NodeIdType>> neg_neighbors_vec;
   neg_neighbors_vec.resize(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &node));
     std::vector<NodeIdType> neighbors;
-    RETURN_IF_NOT_OK(node->GetAllNeighbors(neg_neighbor_type, &neighbors));
+    RETURN_IF_NOT_OK(GetNodeNeighbors(node_list[node_idx], neg_neighbor_type, &neighbors));
     std::unordered_set<NodeIdType> exclude_nodes;
     (void)std::transform(neighbors.begin(), neighbors.end(),
                          std::insert_iterator<std::unordered_set<NodeIdType>>(exclude_nodes, exclude_nodes.begin()),
                          [](const NodeIdType node) { return node; });
-    neg_neighbors_vec[node_idx].emplace_back(node->id());
+    neg_neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
     if (all_nodes.size() > exclude_nodes.size()) {
       while (neg_neighbors_vec[node_idx].size() < samples_num + 1) {
         RETURN_IF_NOT_OK(NegativeSample(all_nodes, shuffled_id, &start_index, exclude_nodes, samples_num + 1,
@@ -349,7 +353,7 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
         }
       }
     } else {
-      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node->id()
+      MS_LOG(DEBUG) << "There are no negative neighbors. node_id:" << node_list[node_idx]
                     << " neg_neighbor_type:" << neg_neighbor_type;
       // If there are no negative neighbors, they are filled with kDefaultNodeId
       for (int32_t i = 0; i < samples_num; ++i) {
@@ -685,6 +689,21 @@ Status GraphDataImpl::GetNodeByNodeId(NodeIdType id, std::shared_ptr<Node> *node
   return Status::OK();
 }
 
+Status GraphDataImpl::GetNodeNeighbors(NodeIdType id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                       bool exclude_itself) {
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  const NodeIdType *neighbors = nullptr;
+  int64_t num_neighbors = 0;
+  RETURN_IF_NOT_OK(adjacency_.GetNeighbors(id, neighbor_type, &neighbors, &num_neighbors));
+  out_neighbors->clear();
+  out_neighbors->reserve(num_neighbors + 1);
+  if (!exclude_itself) {
+    out_neighbors->push_back(id);
+  }
+  out_neighbors->insert(out_neighbors->end(), neighbors, neighbors + num_neighbors);
+  return Status::OK();
+}
+
 Status GraphDataImpl::GetEdgeByEdgeId(EdgeIdType id, std::shared_ptr<Edge> *edge) {
   RETURN_UNEXPECTED_IF_NULL(edge);
   auto itr = edge_id_map_.find(id);
@@ -749,12 +768,10 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
   while (walk.size() - 1 < meta_path_.size()) {
     // current nodE
     auto cur_node_id = walk.back();
-    std::shared_ptr<Node> cur_node;
-    RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(cur_node_id, &cur_node));
 
     // current neighbors
     std::vector<NodeIdType> cur_neighbors;
-    RETURN_IF_NOT_OK(cur_node->GetAllNeighbors(meta_path_[walk.size() - 1], &cur_neighbors, true));
+    RETURN_IF_NOT_OK(graph_->GetNodeNeighbors(cur_node_id, meta_path_[walk.size() - 1], &cur_neighbors, true));
     std::sort(cur_neighbors.begin(), cur_neighbors.end());
 
     // break if no neighbors
@@ -798,10 +815,8 @@ Status GraphDataImpl::RandomWalkBase::GetNodeProbability(const NodeIdType &node_
                                                          std::shared_ptr<StochasticIndex> *node_probability) {
   RETURN_UNEXPECTED_IF_NULL(node_probability);
   // Generate alias nodes
-  std::shared_ptr<Node> node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(node_id, &node));
   std::vector<NodeIdType> neighbors;
-  RETURN_IF_NOT_OK(node->GetAllNeighbors(node_type, &neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNodeNeighbors(node_id, node_type, &neighbors, true));
   std::sort(neighbors.begin(), neighbors.end());
   auto non_normalized_probability = std::vector<float>(neighbors.size(), 1.0);
   *node_probability =
@@ -814,15 +829,12 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
                                                          std::shared_ptr<StochasticIndex> *edge_probability) {
   RETURN_UNEXPECTED_IF_NULL(edge_probability);
   // Get the alias edge setup lists for a given edge.
-  std::shared_ptr<Node> src_node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(src, &src_node));
   std::vector<NodeIdType> src_neighbors;
-  RETURN_IF_NOT_OK(src_node->GetAllNeighbors(meta_path_[meta_path_index], &src_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNodeNeighbors(src, meta_path_[meta_path_index], &src_neighbors, true));
+  std::sort(src_neighbors.begin(), src_neighbors.end());
 
-  std::shared_ptr<Node> dst_node;
-  RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(dst, &dst_node));
   std::vector<NodeIdType> dst_neighbors;
-  RETURN_IF_NOT_OK(dst_node->GetAllNeighbors(meta_path_[meta_path_index + 1], &dst_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->GetNodeNeighbors(dst, meta_path_[meta_path_index + 1], &dst_neighbors, true));
 
   CHECK_FAIL_RETURN_UNEXPECTED(std::fabs(step_home_param_) > std::numeric_limits<float>::epsilon(),
                                "Invalid data, step home parameter can't be zero.");
@@ -835,8 +847,7 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
       non_normalized_probability.push_back(1.0 / step_home_param_);  // replace 1.0 with G[dst][dst_nbr]['weight']
       continue;
     }
-    auto it = std::find(src_neighbors.begin(), src_neighbors.end(), dst_nbr);
-    if (it != src_neighbors.end()) {
+    if (std::binary_search(src_neighbors.begin(), src_neighbors.end(), dst_nbr)) {
       // stay close, this node connect both src and dst
       non_normalized_probability.push_back(1.0);  // replace 1.0 with G[dst][dst_nbr]['weight']
     } else {
@@ -25,6 +25,7 @@
 #include <vector>
 #include <utility>
 
+#include "minddata/dataset/engine/gnn/graph_adjacency.h"
 #include "minddata/dataset/engine/gnn/graph_data.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
@@ -265,6 +266,15 @@ class GraphDataImpl : public GraphData {
   // @return Status The status code returned
   Status GetNodeByNodeId(NodeIdType id, std::shared_ptr<Node> *node);
 
+  // Get all neighbors of a node from the adjacency
+  // @param NodeIdType id - id of the node
+  // @param NodeType neighbor_type - type of neighbor
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
+  // @param bool exclude_itself - if false, the node itself is returned in front of its neighbors
+  // @return Status The status code returned
+  Status GetNodeNeighbors(NodeIdType id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                          bool exclude_itself = false);
+
   // Find edge object using edge id
   // @param EdgeIdType id -
   // @param std::shared_ptr<Node> *edge - Returned edge object
@@ -297,6 +307,7 @@ class GraphDataImpl : public GraphData {
 #endif
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
   std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
+  GraphAdjacency adjacency_;
 
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
   std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
@@ -48,15 +48,32 @@ Status GraphLoader::GetNodesAndEdges() {
   MS_LOG(INFO) << "Start to fill node and edges into graph.";
   NodeIdMap *n_id_map = &graph_impl_->node_id_map_;
   EdgeIdMap *e_id_map = &graph_impl_->edge_id_map_;
+  std::vector<NodeIdType> node_ids;
   for (std::deque<std::shared_ptr<Node>> &dq : n_deques_) {
     while (!dq.empty()) {
       std::shared_ptr<Node> node_ptr = dq.front();
-      n_id_map->insert({node_ptr->id(), node_ptr});
+      if (n_id_map->insert({node_ptr->id(), node_ptr}).second) {
+        node_ids.push_back(node_ptr->id());
+      }
       graph_impl_->node_type_map_[node_ptr->type()].push_back(node_ptr->id());
       dq.pop_front();
     }
   }
 
+  // the adjacency is built in two passes, count the neighbors of each node first
+  GraphAdjacency *adjacency = &graph_impl_->adjacency_;
+  RETURN_IF_NOT_OK(adjacency->Init(node_ids));
+  for (const std::deque<std::shared_ptr<Edge>> &dq : e_deques_) {
+    for (const std::shared_ptr<Edge> &edge_ptr : dq) {
+      NodeIdType src_id, dst_id;
+      RETURN_IF_NOT_OK(edge_ptr->GetNode(&src_id, &dst_id));
+      auto src_itr = n_id_map->find(src_id), dst_itr = n_id_map->find(dst_id);
+      if (src_itr != n_id_map->end() && dst_itr != n_id_map->end()) {
+        RETURN_IF_NOT_OK(adjacency->CountEdge(src_id, dst_itr->second->type()));
+      }
+    }
+  }
+
   for (std::deque<std::shared_ptr<Edge>> &dq : e_deques_) {
     while (!dq.empty()) {
       std::shared_ptr<Edge> edge_ptr = dq.front();
@@ -73,7 +90,7 @@ Status GraphLoader::GetNodesAndEdges() {
 
       RETURN_IF_NOT_OK(edge_ptr->SetNode(src_itr->second->id(), dst_itr->second->id()));
 
-      RETURN_IF_NOT_OK(src_itr->second->AddNeighbor(dst_itr->second, edge_ptr->weight()));
+      RETURN_IF_NOT_OK(adjacency->AddEdge(src_id, dst_id, dst_itr->second->type(), edge_ptr->weight()));
       RETURN_IF_NOT_OK(src_itr->second->AddAdjacent(dst_itr->second, edge_ptr));
 
       e_id_map->insert({edge_ptr->id(), edge_ptr});  // add edge to edge_id_map_
@@ -82,6 +99,8 @@ Status GraphLoader::GetNodesAndEdges() {
     }
   }
 
+  RETURN_IF_NOT_OK(adjacency->Finalize());
+
   for (auto &itr : graph_impl_->node_type_map_) {
     itr.second.shrink_to_fit();
   }
@@ -44,27 +44,6 @@ class LocalNode : public Node {
   // @return Status The status code returned
   Status GetFeatures(FeatureType feature_type, std::shared_ptr<Feature> *out_feature) override;
 
-  // Get the all neighbors of a node
-  // @param NodeType neighbor_type - type of neighbor
-  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
-  // @return Status The status code returned
-  Status GetAllNeighbors(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
-                         bool exclude_itself = false) override;
-
-  // Get the sampled neighbors of a node
-  // @param NodeType neighbor_type - type of neighbor
-  // @param int32_t samples_num - Number of neighbors to be acquired
-  // @param SamplingStrategy strategy - Sampling strategy
-  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
-  // @return Status The status code returned
-  Status GetSampledNeighbors(NodeType neighbor_type, int32_t samples_num, SamplingStrategy strategy,
-                             std::vector<NodeIdType> *out_neighbors, std::mt19937 *rnd) override;
-
-  // Add neighbor of node
-  // @param std::shared_ptr<Node> node -
-  // @return Status The status code returned
-  Status AddNeighbor(const std::shared_ptr<Node> &node, const WeightType &) override;
-
   // Add adjacent node and relative edge for source node
   // @param std::shared_ptr<Node> node - the node to be inserted into adjacent table
   // @param std::shared_ptr<Edge> edge - the edge related to the adjacent node of source node
@@ -83,16 +62,7 @@ class LocalNode : public Node {
   Status UpdateFeature(const std::shared_ptr<Feature> &feature) override;
 
  private:
-  Status GetRandomSampledNeighbors(const std::vector<std::shared_ptr<Node>> &neighbors, int32_t samples_num,
-                                   std::vector<NodeIdType> *out, std::mt19937 *rnd);
-
-  Status GetWeightSampledNeighbors(const std::vector<std::shared_ptr<Node>> &neighbors,
-                                   const std::vector<WeightType> &weights, int32_t samples_num,
-                                   std::vector<NodeIdType> *out, std::mt19937 *rnd);
-
-  uint32_t rnd_seed_;
   std::vector<std::pair<FeatureType, std::shared_ptr<Feature>>> features_;
-  std::unordered_map<NodeType, std::pair<std::vector<std::shared_ptr<Node>>, std::vector<WeightType>>> neighbor_nodes_;
   std::unordered_map<NodeIdType, EdgeIdType> adjacent_nodes_;
 };
 }  // namespace gnn
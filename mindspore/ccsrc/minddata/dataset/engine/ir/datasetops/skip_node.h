@@ -99,12 +99,18 @@ class SkipNode : public DatasetNode {
 
   void SetFirstEpochOnly(bool flag) { first_epoch_only_ = flag; }
 
+  /// \brief Set the number of epochs before the skipped rows when the pipeline is reset to a step, so that seekable
+  ///     samplers can start from the order of that epoch
+  void SetSkippedEpochs(int64_t epochs) { skipped_epochs_ = epochs; }
+
   /// \brief Getter functions
   const bool FirstEpochOnly() const { return first_epoch_only_; }
+  const int64_t SkippedEpochs() const { return skipped_epochs_; }
 
  private:
   int32_t skip_count_;
   bool first_epoch_only_ = false;
+  int64_t skipped_epochs_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
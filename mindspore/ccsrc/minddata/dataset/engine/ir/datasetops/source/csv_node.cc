@@ -17,6 +17,7 @@
 #include "minddata/dataset/engine/ir/datasetops/source/csv_node.h"
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "minddata/dataset/engine/datasetops/source/csv_op.h"
@@ -51,6 +52,7 @@ std::shared_ptr<DatasetNode> CSVNode::Copy() {
                                         shuffle_, num_shards_, shard_id_, cache_);
   (void)node->SetNumWorkers(num_workers_);
   (void)node->SetConnectorQueueSize(connector_que_size_);
+  node->SetRowBlockSize(row_block_size_);
   return node;
 }
 
@@ -107,9 +109,13 @@ Status CSVNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_ops) {
     }
   }
 
+  // a large file is only split across the workers on request, since its rows then come out of file order
+  int64_t split_size =
+    GlobalContext::config_manager()->enable_csv_split() ? CSV_SPLIT_SIZE : std::numeric_limits<int64_t>::max();
   std::shared_ptr<CsvOp> csv_op = std::make_shared<CsvOp>(
     sorted_dataset_files, field_delim_, column_default_list, column_names_, num_workers_, num_samples_,
-    worker_connector_size_, connector_que_size_, shuffle_files, num_shards_, shard_id_);
+    worker_connector_size_, connector_que_size_, shuffle_files, num_shards_, shard_id_, split_size);
+  csv_op->SetRowBlockSize(row_block_size_);
 
   RETURN_IF_NOT_OK(csv_op->Init());
 
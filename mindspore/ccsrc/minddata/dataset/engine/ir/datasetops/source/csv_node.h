@@ -107,6 +107,11 @@ class CSVNode : public NonMappableSourceNode {
   ShuffleMode Shuffle() const { return shuffle_; }
   int32_t NumShards() const { return num_shards_; }
   int32_t ShardId() const { return shard_id_; }
+  int64_t RowBlockSize() const { return row_block_size_; }
+
+  /// \brief Send row blocks of the given number of rows instead of plain rows, set by RowBlockPass.
+  /// \param[in] row_block_size The number of rows of a row block, 0 to send plain rows
+  void SetRowBlockSize(int64_t row_block_size) { row_block_size_ = row_block_size; }
 
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
@@ -144,6 +149,7 @@ class CSVNode : public NonMappableSourceNode {
   ShuffleMode shuffle_;
   int32_t num_shards_;
   int32_t shard_id_;
+  int64_t row_block_size_ = 0;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -23,6 +23,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/mind_record_sampler.h"
 #include "minddata/dataset/engine/ir/datasetops/cache_lookup_node.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/mindrecord_sampler_ir.h"
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/random_sampler_ir.h"
 #include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/util/status.h"
 
@@ -168,6 +169,19 @@ Status MindDataNode::BuildMindDatasetSamplerChain(const std::shared_ptr<SamplerO
   return Status::OK();
 }
 
+bool MindDataNode::IsSeekable() const {
+  auto random_sampler = std::dynamic_pointer_cast<RandomSamplerObj>(input_sampler_);
+  return random_sampler != nullptr && random_sampler->IsSeekable() && !IsCached() && num_padded_ == 0 &&
+         shuffle_mode_ != ShuffleMode::kFiles && shuffle_mode_ != ShuffleMode::kInfile;
+}
+
+void MindDataNode::SetStartPosition(int64_t epoch, int64_t index) {
+  auto random_sampler = std::dynamic_pointer_cast<RandomSamplerObj>(input_sampler_);
+  if (random_sampler != nullptr) {
+    random_sampler->SetStartPosition(epoch, index);
+  }
+}
+
 // Helper function to set sample_bytes from py::byte type
 void MindDataNode::SetSampleBytes(std::map<std::string, std::string> *sample_bytes) { sample_bytes_ = *sample_bytes; }
 
@@ -198,6 +212,14 @@ Status MindDataNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_o
     CHECK_FAIL_RETURN_UNEXPECTED(mr_sampler != nullptr,
                                  "Internal error. MindDataNode's sampler should be a MindRecordSamplerObj object");
     RETURN_IF_NOT_OK(mr_sampler->GetShardReader(&shard_reader));
+    // The shard shuffle of a seekable RandomSampler has been set to the start epoch, skip the rows of that epoch here
+    auto random_sampler = std::dynamic_pointer_cast<RandomSamplerObj>(input_sampler_);
+    if (random_sampler != nullptr && random_sampler->StartIndex() > 0) {
+      auto mr_sampler_rt = std::dynamic_pointer_cast<MindRecordSamplerRT>(sampler_rt);
+      CHECK_FAIL_RETURN_UNEXPECTED(mr_sampler_rt != nullptr,
+                                   "Internal error. MindDataNode's runtime sampler should be a MindRecordSamplerRT");
+      mr_sampler_rt->SetStartIndex(random_sampler->StartIndex());
+    }
   }
 
   std::shared_ptr<MindRecordOp> mindrecord_op;
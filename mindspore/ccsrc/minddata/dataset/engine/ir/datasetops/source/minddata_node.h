@@ -93,6 +93,16 @@ class MindDataNode : public MappableSourceNode {
   /// \brief Sampler setter
   void SetSampler(std::shared_ptr<SamplerObj> sampler) override { sampler_ = sampler; }
 
+  /// \brief Check whether the node can start from any row of any epoch without reading the rows before it, i.e. it is
+  ///     globally shuffled by a seekable RandomSampler and not cached
+  /// \return True if SetStartPosition takes effect
+  bool IsSeekable() const;
+
+  /// \brief Let the first epoch start from a row of a later epoch, e.g. when the pipeline is reset to a step
+  /// \param[in] epoch The number of epochs to skip
+  /// \param[in] index The number of rows to skip in the first epoch
+  void SetStartPosition(int64_t epoch, int64_t index);
+
   /// \brief Base-class override for accepting IRNodePass visitor
   /// \param[in] p The node to visit
   /// \param[out] modified Indicator if the node was modified
@@ -17,6 +17,7 @@
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/random_sampler_ir.h"
 #include "minddata/dataset/engine/datasetops/source/sampler/random_sampler.h"
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/util/random.h"
@@ -32,7 +33,11 @@ namespace mindspore {
 namespace dataset {
 // Constructor
 RandomSamplerObj::RandomSamplerObj(bool replacement, int64_t num_samples, bool reshuffle_each_epoch)
-    : replacement_(replacement), num_samples_(num_samples), reshuffle_each_epoch_(reshuffle_each_epoch) {}
+    : replacement_(replacement),
+      num_samples_(num_samples),
+      reshuffle_each_epoch_(reshuffle_each_epoch),
+      start_epoch_(0),
+      start_index_(0) {}
 
 // Destructor
 RandomSamplerObj::~RandomSamplerObj() = default;
@@ -45,6 +50,10 @@ Status RandomSamplerObj::ValidateParams() {
   return Status::OK();
 }
 
+bool RandomSamplerObj::IsSeekable() const {
+  return !replacement_ && children_.empty() && GlobalContext::config_manager()->enable_seekable_shuffle();
+}
+
 Status RandomSamplerObj::to_json(nlohmann::json *const out_json) {
   nlohmann::json args;
   RETURN_IF_NOT_OK(SamplerObj::to_json(&args));
@@ -71,7 +80,9 @@ Status RandomSamplerObj::from_json(nlohmann::json json_obj, int64_t num_samples,
 
 Status RandomSamplerObj::SamplerBuild(std::shared_ptr<SamplerRT> *sampler) {
   // runtime sampler object
-  *sampler = std::make_shared<dataset::RandomSamplerRT>(replacement_, num_samples_, reshuffle_each_epoch_);
+  auto random_sampler = std::make_shared<dataset::RandomSamplerRT>(replacement_, num_samples_, reshuffle_each_epoch_);
+  random_sampler->SetStartPosition(start_epoch_, start_index_);
+  *sampler = random_sampler;
   Status s = BuildChildren(sampler);
   sampler = s.IsOk() ? sampler : nullptr;
   return s;
@@ -82,6 +93,9 @@ std::shared_ptr<mindrecord::ShardOperator> RandomSamplerObj::BuildForMindDataset
   // runtime mindrecord sampler object
   auto mind_sampler =
     std::make_shared<mindrecord::ShardShuffle>(GetSeed(), num_samples_, replacement_, reshuffle_each_epoch_);
+  if (IsSeekable()) {
+    mind_sampler->SetSeekable(start_epoch_);
+  }
 
   return mind_sampler;
 }
@@ -89,6 +103,7 @@ std::shared_ptr<mindrecord::ShardOperator> RandomSamplerObj::BuildForMindDataset
 
 std::shared_ptr<SamplerObj> RandomSamplerObj::SamplerCopy() {
   auto sampler = std::make_shared<RandomSamplerObj>(replacement_, num_samples_, reshuffle_each_epoch_);
+  sampler->SetStartPosition(start_epoch_, start_index_);
   for (const auto &child : children_) {
     Status rc = sampler->AddChildSampler(child);
     if (rc.IsError()) {
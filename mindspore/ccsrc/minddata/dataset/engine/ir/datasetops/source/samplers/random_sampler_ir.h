@@ -62,10 +62,28 @@ class RandomSamplerObj : public SamplerObj {
 
   Status ValidateParams() override;
 
+  /// \brief Check whether the sampler can start from any row of any epoch without drawing the samples before it,
+  ///     i.e. it draws without replacement, has no child sampler and enable_seekable_shuffle is set
+  /// \return True if SetStartPosition takes effect
+  bool IsSeekable() const;
+
+  /// \brief Let the first epoch start from a row of a later epoch, e.g. when the pipeline is reset to a step
+  /// \param[in] epoch The number of epochs to skip
+  /// \param[in] index The number of samples to skip in the first epoch
+  void SetStartPosition(int64_t epoch, int64_t index) {
+    start_epoch_ = epoch;
+    start_index_ = index;
+  }
+
+  /// \brief Get the number of samples to skip in the first epoch
+  int64_t StartIndex() const { return start_index_; }
+
  private:
   bool replacement_;
   int64_t num_samples_;
   bool reshuffle_each_epoch_;
+  int64_t start_epoch_;
+  int64_t start_index_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 #include <fstream>
+#include <future>
+#include <numeric>
 
 #include "minddata/dataset/engine/datasetops/source/tf_reader_op.h"
 #include "minddata/dataset/engine/jagged_connector.h"
@@ -53,19 +55,68 @@ void TFRecordNode::Print(std::ostream &out) const {
 Status TFRecordNode::ValidateTFRecordFiles(const std::vector<std::string> &filenames) {
   std::vector<std::string> invalid_files;
 
-  for (const std::string &filename : filenames) {
+  // Opening and checking thousands of files one by one is slow on network file systems, so check sections of the
+  // file list in parallel.
+  size_t threads = std::min<size_t>(filenames.size(), GlobalContext::config_manager()->num_parallel_workers());
+  threads = std::max<size_t>(threads, 1);
+  size_t chunk_size = filenames.size() / threads;
+  size_t remainder = filenames.size() % threads;
+  std::vector<std::future<std::vector<int64_t>>> async_results;
+  size_t begin = 0;
+  try {
+    for (size_t i = 0; i < threads; i++) {
+      size_t end = begin + chunk_size + (i < remainder ? 1 : 0);
+      async_results.push_back(
+        std::async(std::launch::async, &TFRecordNode::ValidateTFRecordFilesSectioned, filenames, begin, end));
+      begin = end;
+    }
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED("Failed to validate TFRecord files: " + std::string(e.what()));
+  }
+
+  size_t index = 0;
+  for (auto &result : async_results) {
+    for (auto file_len : result.get()) {
+      const std::string &filename = filenames[index++];
+      if (file_len < 0) {
+        invalid_files.push_back(filename);
+        continue;
+      }
+      // check and log large files
+      CheckLargeFile(filename, file_len);
+    }
+  }
+
+  if (!invalid_files.empty()) {
+    std::string err_msg;
+    err_msg += "Invalid file. The following files either cannot be opened, or are not valid TFRecordDataset files:\n";
+
+    std::string accumulated_filenames = std::accumulate(
+      invalid_files.begin(), invalid_files.end(), std::string(""),
+      [](const std::string &accumulated, const std::string &next) { return accumulated + "    " + next + "\n"; });
+    err_msg += accumulated_filenames;
+    RETURN_SYNTAX_ERROR(err_msg);
+  }
+  return Status::OK();
+}
+
+std::vector<int64_t> TFRecordNode::ValidateTFRecordFilesSectioned(const std::vector<std::string> &filenames,
+                                                                  size_t begin, size_t end) {
+  std::vector<int64_t> file_lens;
+  for (size_t i = begin; i < end; i++) {
+    const std::string &filename = filenames[i];
+    file_lens.push_back(-1);
+
     // invalid path
     auto realpath = FileUtils::GetRealPath(filename.c_str());
     if (!realpath.has_value()) {
-      invalid_files.push_back(filename);
       continue;
     }
 
     // failed to open
     std::ifstream reader;
-    reader.open(realpath.value());
+    reader.open(realpath.value(), std::ios::binary);
     if (!reader) {
-      invalid_files.push_back(filename);
       reader.close();
       continue;
     }
@@ -84,32 +135,18 @@ Status TFRecordNode::ValidateTFRecordFiles(const std::vector<std::string> &filen
 
     // invalid tfrecord file
     if (masked_crc != generated_crc) {
-      invalid_files.push_back(filename);
       reader.close();
       continue;
     }
 
-    // check and log large files
-    CheckLargeFile(filename, &reader);
+    file_lens.back() = static_cast<int64_t>(reader.seekg(0, std::ios::end).tellg());
     reader.close();
   }
-
-  if (!invalid_files.empty()) {
-    std::string err_msg;
-    err_msg += "Invalid file. The following files either cannot be opened, or are not valid TFRecordDataset files:\n";
-
-    std::string accumulated_filenames = std::accumulate(
-      invalid_files.begin(), invalid_files.end(), std::string(""),
-      [](const std::string &accumulated, const std::string &next) { return accumulated + "    " + next + "\n"; });
-    err_msg += accumulated_filenames;
-    RETURN_SYNTAX_ERROR(err_msg);
-  }
-  return Status::OK();
+  return file_lens;
 }
 
-void TFRecordNode::CheckLargeFile(const std::string &filename, std::ifstream *reader) {
+void TFRecordNode::CheckLargeFile(const std::string &filename, int64_t file_len) {
   if (large_files_.find(filename) == large_files_.end()) {
-    int64_t file_len = reader->seekg(0, std::ios::end).tellg();
     if (file_len > kTFRecordFileLimit) {
       MS_LOG(WARNING)
         << "The size of following TFRecord file is larger than 5G. There may be performance problems in "
@@ -161,11 +161,16 @@ class TFRecordNode : public NonMappableSourceNode {
   Status AcceptAfter(IRNodePass *const p, bool *const modified) override;
 
  private:
-  /// Check and return if there exists invalid tfrecord files in the file list
+  /// Check and return if there exists invalid tfrecord files in the file list. Files are checked in parallel.
   Status ValidateTFRecordFiles(const std::vector<std::string> &filenames);
 
+  /// Check the crc of the first record of the files in the range [begin, end).
+  /// @return the size of each file, or -1 if the file is invalid.
+  static std::vector<int64_t> ValidateTFRecordFilesSectioned(const std::vector<std::string> &filenames, size_t begin,
+                                                             size_t end);
+
   /// Record large tf file and log a warning.
-  void CheckLargeFile(const std::string &filename, std::ifstream *reader);
+  void CheckLargeFile(const std::string &filename, int64_t file_len);
 
   std::vector<std::string> dataset_files_;
   std::string schema_path_;  // schema_path_ path to schema file. It is set when type of schema parameter is string
@@ -21,6 +21,9 @@
 #include <utility>
 #include "minddata/dataset/core/tensor_row.h"
 #include "minddata/dataset/engine/connector.h"
+#ifndef ENABLE_SECURITY
+#include "minddata/dataset/engine/perf/profiling.h"
+#endif
 
 #include "minddata/dataset/include/dataset/constants.h"
 
@@ -31,7 +34,8 @@ class OperatorConnector : public Queue<TensorRow> {
  public:
   /// Constructor of OperatorConnector
   /// \param queue_capacity The number of element (TensorRows) for the queue.
-  explicit OperatorConnector(int32_t queue_capacity) : Queue<TensorRow>(queue_capacity), out_rows_count_(0) {}
+  explicit OperatorConnector(int32_t queue_capacity)
+      : Queue<TensorRow>(queue_capacity), out_rows_count_(0), row_timestamp_(false) {}
 
   /// Destructor of -OperatorConnector
   ~OperatorConnector() = default;
@@ -40,6 +44,29 @@ class OperatorConnector : public Queue<TensorRow> {
     out_rows_count_++;
     return Queue::PopFront(row);
   }
+
+  /// Add a row, with row timestamps enabled a data row which has not entered the op from a child, e.g. a row
+  /// created by a leaf op, is stamped with the current time, so the time it waits in the queue is traced.
+  Status Add(const TensorRow &row) noexcept {
+#ifndef ENABLE_SECURITY
+    if (row_timestamp_ && row.Flags() == TensorRow::kFlagNone && row.getTimestamp() == 0) {
+      TensorRow stamped = row;
+      stamped.setTimestamp(ProfilingTime::GetCurMicroSecond());
+      return Queue::Add(std::move(stamped));
+    }
+#endif
+    return Queue::Add(row);
+  }
+
+  Status Add(TensorRow &&row) noexcept {
+#ifndef ENABLE_SECURITY
+    if (row_timestamp_ && row.Flags() == TensorRow::kFlagNone && row.getTimestamp() == 0) {
+      row.setTimestamp(ProfilingTime::GetCurMicroSecond());
+    }
+#endif
+    return Queue::Add(std::move(row));
+  }
+
   Status SendEOE() noexcept {
     TensorRow eoe = TensorRow(TensorRow::kFlagEOE);
     return Add(std::move(eoe));
@@ -51,8 +78,12 @@ class OperatorConnector : public Queue<TensorRow> {
   }
   auto out_rows_count() const { return out_rows_count_; }
 
+  /// Enable or disable the timestamp of the added rows, it is enabled by row tracing of the profiler
+  void SetRowTimestamp(bool enable) { row_timestamp_ = enable; }
+
  private:
   int64_t out_rows_count_;
+  bool row_timestamp_;
 };
 }  // namespace dataset
 }  // namespace mindspore
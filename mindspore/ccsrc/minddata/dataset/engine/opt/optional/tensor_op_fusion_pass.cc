@@ -20,12 +20,15 @@
 #include <vector>
 
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/kernels/image/decode_resize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/resize_ir.h"
 
 namespace mindspore {
 namespace dataset {
@@ -55,12 +58,31 @@ Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modi
   itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
                     [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
 
+  if (itr != ops.end()) {
+    auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
+    RETURN_UNEXPECTED_IF_NULL(fused_ir);
+    // fuse the two ops
+    (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
+    ops.erase(itr + 1);
+    node->setOperations(ops);
+    *modified = true;
+    return Status::OK();
+  }
+
+  // Decode followed by Resize is fused into a pre-built DecodeResizeOp, which can skip the full resolution decode
+  pattern = {vision::kDecodeOperation, vision::kResizeOperation};
+  itr = std::search(ops.begin(), ops.end(), pattern.begin(), pattern.end(),
+                    [](auto op, const std::string &nm) { return op != nullptr ? op->Name() == nm : false; });
+
   // return here if no pattern is found
   RETURN_OK_IF_TRUE(itr == ops.end());
-  auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
-  RETURN_UNEXPECTED_IF_NULL(fused_ir);
-  // fuse the two ops
-  (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
+  nlohmann::json decode_args;
+  RETURN_IF_NOT_OK((*itr)->to_json(&decode_args));
+  // only the RGB decode can be fused, keep the error of the BGR decode as it is
+  RETURN_OK_IF_TRUE(decode_args.find("rgb") == decode_args.end() || !decode_args["rgb"].get<bool>());
+  auto resize_op = std::dynamic_pointer_cast<ResizeOp>((*(itr + 1))->Build());
+  RETURN_UNEXPECTED_IF_NULL(resize_op);
+  (*itr) = std::make_shared<transforms::PreBuiltOperation>(std::make_shared<DecodeResizeOp>(*resize_op));
   ops.erase(itr + 1);
   node->setOperations(ops);
   *modified = true;
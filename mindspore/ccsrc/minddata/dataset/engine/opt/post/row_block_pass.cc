@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/opt/post/row_block_pass.h"
+
+#include "minddata/dataset/engine/ir/datasetops/batch_node.h"
+#include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/csv_node.h"
+#include "minddata/dataset/kernels/ir/tensor_operation.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+
+namespace mindspore {
+namespace dataset {
+
+Status RowBlockPass::Visit(std::shared_ptr<BatchNode> node, bool *const modified) {
+  RETURN_UNEXPECTED_IF_NULL(node);
+  RETURN_UNEXPECTED_IF_NULL(modified);
+#ifdef ENABLE_PYTHON
+  // padding, dynamic batch size and per batch map work on the rows one by one
+  if (node->Pad() || node->BatchSizeFunc() || node->BatchMapFunc()) {
+    return Status::OK();
+  }
+#endif
+  if (node->Children().size() != 1) {
+    return Status::OK();
+  }
+  // Walk down the ops between the batch and the source. Only maps of elementwise operations, projects and renames
+  // keep a row block as it is, any other op (e.g. take, skip, shuffle or a cache) needs plain rows.
+  std::shared_ptr<DatasetNode> child = node->Children()[0];
+  while (child->Children().size() == 1) {
+    if (child->IsCached()) {
+      return Status::OK();
+    }
+    if (child->Name() == kMapNode) {
+      bool elementwise = false;
+      RETURN_IF_NOT_OK(IsElementwise(std::static_pointer_cast<MapNode>(child), &elementwise));
+      if (!elementwise) {
+        return Status::OK();
+      }
+    } else if (child->Name() != kProjectNode && child->Name() != kRenameNode) {
+      return Status::OK();
+    }
+    child = child->Children()[0];
+  }
+  if (child->Name() != kCSVNode) {
+    return Status::OK();
+  }
+  auto csv_node = std::static_pointer_cast<CSVNode>(child);
+  // a global shuffle is built as a shuffle op over the CSV op
+  if (csv_node->IsCached() || csv_node->IsDescendantOfCache() || csv_node->Shuffle() == ShuffleMode::kGlobal) {
+    return Status::OK();
+  }
+  csv_node->SetRowBlockSize(node->BatchSize());
+  *modified = true;
+  return Status::OK();
+}
+
+Status RowBlockPass::IsElementwise(const std::shared_ptr<MapNode> &node, bool *elementwise) {
+  RETURN_UNEXPECTED_IF_NULL(elementwise);
+  *elementwise = false;
+  // callbacks are called for each row
+  if (!node->Callbacks().empty()) {
+    return Status::OK();
+  }
+  // Like the randomness checked by MapNode::Build, whether an operation is elementwise is only known by its TensorOp.
+  for (const auto &operation : node->TensorOperations()) {
+    RETURN_UNEXPECTED_IF_NULL(operation);
+    std::shared_ptr<TensorOp> tensor_op = operation->Build();
+    if (tensor_op == nullptr || !tensor_op->Elementwise()) {
+      return Status::OK();
+    }
+  }
+  *elementwise = true;
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,56 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_POST_ROW_BLOCK_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_POST_ROW_BLOCK_PASS_H_
+
+#include <memory>
+
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+
+/// \class RowBlockPass row_block_pass.h
+/// \brief This is a NodePass who's job is to let a CSV source send row blocks, i.e. rows whose tensors hold a column
+///     of many rows, when its rows only go through elementwise map operations before they are batched. The rows of
+///     a batch are then made of a few tensors per column instead of a tensor per value. It only runs when
+///     enable_row_block is set, since the workers of the source are then interleaved block by block.
+class RowBlockPass : public IRNodePass {
+ public:
+  /// \brief Constructor
+  RowBlockPass() = default;
+
+  /// \brief Destructor
+  ~RowBlockPass() override = default;
+
+  /// \brief Set the row block size of the CSV source under the batch, if the rows can be carried as row blocks
+  /// \param[in] node The node being visited
+  /// \param[in, out] modified Indicator if the node was changed at all
+  /// \return Status The status code returned
+  Status Visit(std::shared_ptr<BatchNode> node, bool *const modified) override;
+
+ private:
+  /// \brief Check whether all operations of a map apply to a column of rows at once
+  /// \param[in] node The map node
+  /// \param[out] elementwise Whether the map can process row blocks
+  /// \return Status The status code returned
+  static Status IsElementwise(const std::shared_ptr<MapNode> &node, bool *elementwise);
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_POST_ROW_BLOCK_PASS_H_
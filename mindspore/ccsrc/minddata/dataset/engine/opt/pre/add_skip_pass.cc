@@ -107,6 +107,7 @@ Status AddSkipPass::RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const
 
   auto skip_node = std::make_shared<SkipNode>(skip_num);
   skip_node->SetFirstEpochOnly(true);
+  skip_node->SetSkippedEpochs(step / dataset_size);
   RETURN_IF_NOT_OK(node->InsertAbove(skip_node));
 
   MS_LOG(INFO) << "Pre pass: AddSkipPass complete.";
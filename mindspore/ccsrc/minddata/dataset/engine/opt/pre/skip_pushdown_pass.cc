@@ -24,11 +24,12 @@
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/ir/datasetops/source/minddata_node.h"
 #endif
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/random_sampler_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/skip_first_epoch_sampler_ir.h"
 
 namespace mindspore {
 namespace dataset {
-SkipPushdownPass::SkipNodes::SkipNodes() : skip_count_(0) {}
+SkipPushdownPass::SkipNodes::SkipNodes() : skip_count_(0), skipped_epochs_(0) {}
 
 // activate the optimization steps, and increase skip_count_ (if not the first skip node in the pipeline)
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<SkipNode> node, bool *const modified) {
@@ -36,6 +37,7 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<SkipNode> node, bool *
     return Visit(std::static_pointer_cast<DatasetNode>(node), modified);
   }
   skip_count_ += node->Count();
+  skipped_epochs_ += node->SkippedEpochs();
   nodes_to_remove_.push_back(node);
   return Status::OK();
 }
@@ -45,6 +47,7 @@ Status SkipPushdownPass::SkipNodes::VisitAfter(std::shared_ptr<SkipNode> node, b
     return VisitAfter(std::static_pointer_cast<DatasetNode>(node), modified);
   }
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ == 0, "The skip_count_ cannot be non-zero here.");
+  skipped_epochs_ = 0;
   return Status::OK();
 }
 
@@ -85,6 +88,16 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<RenameNode> node, bool
 
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MappableSourceNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
+  // A seekable sampler starts from the skipped position of the right epoch, without sampling the rows before it.
+  auto random_sampler = std::dynamic_pointer_cast<RandomSamplerObj>(node->Sampler());
+  if (random_sampler != nullptr && random_sampler->IsSeekable() && (skip_count_ > 0 || skipped_epochs_ > 0)) {
+    MS_LOG(INFO) << "Starting RandomSampler from epoch " << skipped_epochs_ << ", index " << skip_count_;
+    random_sampler->SetStartPosition(skipped_epochs_, skip_count_);
+    skip_count_ = 0;
+    skipped_epochs_ = 0;
+    return Status::OK();
+  }
+  skipped_epochs_ = 0;
   if (skip_count_ == 0) {
     return Status::OK();
   }  // no active skip node above. normal flow
@@ -116,6 +129,7 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MapNode> node, bool *c
 
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<NonMappableSourceNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
+  skipped_epochs_ = 0;
   if (skip_count_ == 0) {
     return Status::OK();
   }  // no active skip node above. normal flow
@@ -127,9 +141,18 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<NonMappableSourceNode>
 }
 
 #ifndef ENABLE_ANDROID
-// Since MindDataset requires its own SkipFirstEpochSampler (which is not implemented) we insert the skip node above it.
+// Since MindDataset requires its own SkipFirstEpochSampler (which is not implemented) we insert the skip node above it,
+// unless it is shuffled by a seekable RandomSampler which can start from the skipped position.
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MindDataNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
+  if (node->IsSeekable() && (skip_count_ > 0 || skipped_epochs_ > 0)) {
+    MS_LOG(INFO) << "Starting MindDataset from epoch " << skipped_epochs_ << ", index " << skip_count_;
+    node->SetStartPosition(skipped_epochs_, skip_count_);
+    skip_count_ = 0;
+    skipped_epochs_ = 0;
+    return Status::OK();
+  }
+  skipped_epochs_ = 0;
   if (skip_count_ == 0) {
     return Status::OK();
   }  // no active skip node above. normal flow
@@ -144,6 +167,7 @@ Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<MindDataNode> node, bo
 // This functions is used for Ops that are random, and the ones in which Visit is Not Implemented yet;
 Status SkipPushdownPass::SkipNodes::Visit(std::shared_ptr<DatasetNode> node, bool *const modified) {
   CHECK_FAIL_RETURN_UNEXPECTED(skip_count_ >= 0, "The skip size cannot be negative.");
+  skipped_epochs_ = 0;
   if (skip_count_ == 0) {
     return Status::OK();
   }  // no active skip node above. normal flow
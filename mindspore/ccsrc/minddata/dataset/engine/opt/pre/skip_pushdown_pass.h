@@ -40,7 +40,7 @@ class SkipNode;
 /// \class SkipPushdownPass skip_pushdown_pass.h
 /// \brief This is a tree pass that will push down a skip node.  It uses SkipNodes to first identify if we have a skip
 /// node, and then based on the node types we observe in the tree, decide where to place the skip node (or use a
-/// SequentialSampler for MappableSource nodes).
+/// SequentialSampler for MappableSource nodes, or the start position of a seekable RandomSampler).
 class SkipPushdownPass : public IRTreePass {
   /// \class SkipNodes
   /// \brief This is a NodePass whose job is to handle different nodes accordingly.
@@ -135,6 +135,7 @@ class SkipPushdownPass : public IRTreePass {
     std::vector<std::pair<std::shared_ptr<DatasetNode>, int64_t>> insert_skip_above_;
     std::vector<std::shared_ptr<DatasetNode>> nodes_to_remove_;
     int64_t skip_count_;
+    int64_t skipped_epochs_;  // epochs before the skipped rows, only pushed down to seekable samplers
   };
 
  public:
@@ -17,6 +17,7 @@
 #include "minddata/dataset/engine/perf/auto_tune.h"
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -53,6 +54,7 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       phase_3_ID_(0),
       avg_batch_time(0.0),
       phase_3_prev_avg_(0.0),
+      cost_model_(GlobalContext::config_manager()->enable_autotune_cost_model()),
       save_autoconfig_(GlobalContext::config_manager()->save_autoconfig()) {
   max_workers_ = GlobalContext::config_manager()->num_cpu_threads();
   autotune_json_filepath_ = GlobalContext::config_manager()->get_autotune_json_filepath();
@@ -606,6 +608,14 @@ Status AutoTune::AnalyseTime() {
   RETURN_IF_NOT_OK(GetOpsQueueUtil(&out_ops_queue_util, &in_ops_queue_util));
   std::map<int32_t, double> ops_cpu_util;
   RETURN_IF_NOT_OK(GetOpsCpuUtil(&ops_cpu_util));
+  if (cost_model_) {
+    bool solved = false;
+    RETURN_IF_NOT_OK(
+      AnalyseTimeCostModel(ops_num_workers, out_ops_queue_util, in_ops_queue_util, ops_cpu_util, &solved));
+    if (solved) {
+      return Status::OK();
+    }
+  }
   // check parallel ops in loop
   for (const auto &op_id : parallel_ops_ids_) {
     if (SkipOpsCheck(op_id)) {
@@ -654,6 +664,80 @@ Status AutoTune::AnalyseTime() {
   return Status::OK();
 }
 
+Status AutoTune::AnalyseTimeCostModel(const std::map<int32_t, int32_t> &ops_num_workers,
+                                      const std::map<int32_t, double> &out_ops_queue_util,
+                                      const std::map<int32_t, double> &in_ops_queue_util,
+                                      const std::map<int32_t, double> &ops_cpu_util, bool *solved) {
+  *solved = false;
+  std::vector<int32_t> tunable_ops;
+  for (const auto &op_id : parallel_ops_ids_) {
+    if (!SkipOpsCheck(op_id) && ops_[op_id]->Name() != "DataQueueOp") {
+      tunable_ops.push_back(op_id);
+    }
+  }
+  // cpu budget in cores, minus what the ops which are not tuned use
+  double budget = max_workers_;
+  double tunable_cores = 0;
+  for (const auto &item : ops_cpu_util) {
+    double cores = item.second / TO_PERCENT;
+    if (std::find(tunable_ops.begin(), tunable_ops.end(), item.first) != tunable_ops.end()) {
+      tunable_cores += cores;
+    } else {
+      budget -= cores;
+    }
+  }
+  if (tunable_ops.empty() || tunable_cores <= 0) {
+    MS_LOG(INFO) << "No cpu utilization of the ops is sampled, AutoTune falls back to the step heuristics.";
+    return Status::OK();
+  }
+  float empty_freq = 0;
+  RETURN_IF_NOT_OK(GetEmptyQueueFrequency(&empty_freq));
+  // The device waits for data in empty_freq of the steps, so the pipeline needs to be this much faster
+  double target_speedup = COST_MODEL_SPEEDUP_MARGIN / (1.0 - std::min(empty_freq, COST_MODEL_MAX_EMPTY_FREQ));
+  // The ops can not be sped up beyond the budget, and a saturated cpu is not relieved by fewer workers
+  double speedup = std::max(1.0, std::min(target_speedup, budget / tunable_cores));
+  MS_LOG(INFO) << "AutoTune cost model: tunable ops use " << tunable_cores << " of " << budget
+               << " available cores, target speedup is " << target_speedup << ", solving for speedup " << speedup
+               << ".";
+
+  // workers of the tunable ops
+  const double worker_util = MAP_OP_WORKER_HIGH_THRESHOLD / TO_PERCENT;
+  std::map<int32_t, int32_t> target_workers = ops_num_workers;
+  for (const auto &op_id : tunable_ops) {
+    int32_t num_workers = ops_num_workers.at(op_id);
+    double cores = ops_cpu_util.at(op_id) / TO_PERCENT;
+    int32_t workers = static_cast<int32_t>(std::ceil(cores * speedup / worker_util));
+    workers = std::min(std::max(workers, num_workers), max_workers_);
+    // An op which is slower than its input without using the cpu of its workers is waiting on io,
+    // which the cpu model does not see.
+    double queue_diff = in_ops_queue_util.at(op_id) - out_ops_queue_util.at(op_id);
+    if (queue_diff > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD && workers == num_workers) {
+      workers = num_workers + INCREMENT_WORKER;
+    }
+    if (workers != num_workers) {
+      RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &workers));
+    }
+    target_workers[op_id] = workers;
+  }
+
+  // queue sizes, a queue holds a row for each of the workers producing into it and consuming from it
+  for (const auto &op_id : tunable_ops) {
+    int32_t consumer_workers = 1;
+    std::vector<DatasetOp *> parents = ops_[op_id]->parents();
+    if (!parents.empty() && target_workers.find(parents[0]->id()) != target_workers.end()) {
+      consumer_workers = std::max(consumer_workers, target_workers[parents[0]->id()]);
+    }
+    int64_t queue_capacity;
+    RETURN_IF_NOT_OK(GetOpConnectorCapacity(op_id, &queue_capacity));
+    int64_t new_queue_capacity = target_workers[op_id] + consumer_workers;
+    if (new_queue_capacity > queue_capacity) {
+      RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, queue_capacity, new_queue_capacity));
+    }
+  }
+  *solved = true;
+  return Status::OK();
+}
+
 bool AutoTune::MemoryPhaseCompareMetric(double prev_avg, double cur_avg) {
   double lower_bound = prev_avg - (prev_avg * MEMORY_COMPARISON_LOWER_BOUND_PERCENT);
   // If cur_avg worse than lower bound - negative impact on performance
@@ -144,6 +144,9 @@ class AutoTune {
   // CPU Specifics
   const float_t MAP_OP_WORKER_HIGH_THRESHOLD = 75;
   const float_t MAP_OP_WORKER_LOW_THRESHOLD = 35;
+  // Cost model specifics
+  const float_t COST_MODEL_SPEEDUP_MARGIN = 1.2;
+  const float_t COST_MODEL_MAX_EMPTY_FREQ = 0.9;
   // Running mode specifics
   enum AutoTuneMode { kAutoTuneModeEpoch, kAutoTuneModeStep };
   enum AutoTunePhase { kAutoTunePhaseTime, kAutoTunePhaseMemory, kAutoTuneEnd };
@@ -188,6 +191,22 @@ class AutoTune {
   /// \return Status code
   Status AnalyseTime();
 
+  /// AutoTune algorithm which solves the workers and queue sizes of all ops at once from a cost model.
+  /// The cpu an op uses per batch is its cpu utilization at the current speed. The speed the device
+  /// needs is estimated from how often it finds its queue empty, and is capped by the cpu budget left
+  /// for the tunable ops. Each op gets the workers for its share of the cpu at that speed, and each
+  /// queue gets room for the workers on both of its ends.
+  /// \param[in] ops_num_workers map from op_id to num_workers
+  /// \param[in] out_ops_queue_util map from op_id to output queue utilization
+  /// \param[in] in_ops_queue_util map from op_id to input queue utilization
+  /// \param[in] ops_cpu_util map from op_id to cpu utilization
+  /// \param[out] solved false if there are no cpu samples to build the model from
+  /// \return Status code
+  Status AnalyseTimeCostModel(const std::map<int32_t, int32_t> &ops_num_workers,
+                              const std::map<int32_t, double> &out_ops_queue_util,
+                              const std::map<int32_t, double> &in_ops_queue_util,
+                              const std::map<int32_t, double> &ops_cpu_util, bool *solved);
+
   /// AutoTune memory algorithm
   /// \return Status code
   Status AnalyseMemory();
@@ -289,6 +308,9 @@ class AutoTune {
   double phase_3_prev_avg_;
   std::vector<int32_t> OP_values;
 
+  /// True if the time phase uses the cost model instead of the step heuristics
+  bool cost_model_;
+
   /// True if should save AutoTune configuration
   bool save_autoconfig_;
 
@@ -25,6 +25,7 @@
 #include "minddata/dataset/engine/perf/monitor.h"
 #include "minddata/dataset/engine/perf/connector_size.h"
 #include "minddata/dataset/engine/perf/cpu_sampler.h"
+#include "minddata/dataset/engine/perf/row_tracing.h"
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/tree_adapter.h"
 #include "minddata/dataset/util/log_adapter.h"
@@ -252,6 +253,13 @@ Status ProfilingManager::RegisterTree(const TreeAdapter *tree_adapter) {
   std::shared_ptr<Sampling> cpu_sampler = std::make_shared<CpuSampler>(tree_);
   RETURN_IF_NOT_OK(RegisterSamplingNode(cpu_sampler));
 #endif
+  if (profiling_ && GlobalContext::config_manager()->enable_row_tracing()) {
+    auto row_tracing = std::make_shared<RowTracing>(tree_);
+    RETURN_IF_NOT_OK(RegisterSamplingNode(row_tracing));
+    for (auto &op : *tree_) {
+      op.SetRowTracing(row_tracing);
+    }
+  }
   // can insert a correct timestamp so that we can ignore the samples that were taken
   // during start up of the pipeline.
   (void)epoch_end_ts_.emplace_back(0);
@@ -852,5 +860,12 @@ uint64_t ProfilingTime::GetCurMilliSecond() {
   using std::chrono::steady_clock;
   return static_cast<uint64_t>(duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count());
 }
+
+uint64_t ProfilingTime::GetCurMicroSecond() {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+  using std::chrono::steady_clock;
+  return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
 }  // namespace dataset
 }  // namespace mindspore
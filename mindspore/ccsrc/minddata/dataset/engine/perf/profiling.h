@@ -41,6 +41,7 @@ const char kDeviceQueueTracingName[] = "Device_Queue_Tracing";
 const char kDatasetIteratorTracingName[] = "Dataset_Iterator_Tracing";
 const char kConnectorSizeSamplingName[] = "Connector_Size_Sampling";
 const char kCpuSamplerName[] = "Cpu_Sampler";
+const char kRowTracingName[] = "Row_Tracing";
 
 // Values for process memory metrics - common for profiling and cpu_sampler
 enum ProcessMemoryMetric { kPSS, kRSS, kVSS };
@@ -618,6 +619,7 @@ enum ProfilingTimeSubType {
 class ProfilingTime {
  public:
   static uint64_t GetCurMilliSecond();
+  static uint64_t GetCurMicroSecond();
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,243 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/perf/row_tracing.h"
+
+#include <sys/stat.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <utility>
+#include <nlohmann/json.hpp>
+
+#include "utils/ms_utils.h"
+#include "minddata/dataset/engine/execution_tree.h"
+#include "minddata/dataset/util/path.h"
+
+namespace mindspore {
+namespace dataset {
+constexpr double kP50 = 50.0;
+constexpr double kP99 = 99.0;
+constexpr double kMaxPercentile = 100.0;
+
+LatencyHistogram::LatencyHistogram() : count_(0), sum_(0), max_(0) {
+  for (auto &bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Snapshot(std::vector<uint64_t> *counts) const {
+  counts->resize(kNumBuckets);
+  for (int i = 0; i < kNumBuckets; i++) {
+    (*counts)[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(int index) {
+  if (index < kSubBuckets) {
+    return static_cast<uint64_t>(index);
+  }
+  int shift = index / kSubBuckets - 1;
+  auto mantissa = static_cast<uint64_t>(index % kSubBuckets + kSubBuckets);
+  uint64_t lower = mantissa << shift;
+  return lower + ((uint64_t(1) << shift) - 1);
+}
+
+uint64_t LatencyHistogram::Percentile(const std::vector<uint64_t> &counts, double percentile) {
+  uint64_t total = 0;
+  for (auto count : counts) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+  // the rank of the percentile, counted from 1
+  auto rank = static_cast<uint64_t>(std::ceil(percentile / kMaxPercentile * static_cast<double>(total)));
+  rank = std::max<uint64_t>(rank, 1);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < counts.size(); i++) {
+    seen += counts[i];
+    if (seen >= rank) {
+      return BucketUpperBound(static_cast<int>(i));
+    }
+  }
+  return BucketUpperBound(static_cast<int>(counts.size()) - 1);
+}
+
+Status RowTracing::Init() {
+  ops_.clear();
+  for (auto &node : *tree_) {
+    auto op_id = static_cast<size_t>(node.id());
+    if (op_id >= ops_.size()) {
+      ops_.resize(op_id + 1);
+    }
+    ops_[op_id] = std::make_unique<OpLatency>();
+    ops_[op_id]->name = node.Name();
+  }
+  return Status::OK();
+}
+
+void RowTracing::Record(int32_t op_id, uint64_t start_ts, uint64_t end_ts) {
+  if (!active_ || start_ts == 0 || op_id < 0 || static_cast<size_t>(op_id) >= ops_.size() ||
+      ops_[op_id] == nullptr) {
+    return;
+  }
+  OpLatency *op = ops_[op_id].get();
+  uint64_t latency = end_ts > start_ts ? end_ts - start_ts : 0;
+  op->histogram.Add(latency);
+  if (op->num_rows.fetch_add(1, std::memory_order_relaxed) % kEventInterval == 0) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (events_.size() < kMaxEvents) {
+      events_.push_back({op_id, start_ts, latency});
+    }
+  }
+}
+
+Status RowTracing::Sample() {
+  if (!active_) {
+    return Status::OK();
+  }
+  uint64_t ts = ProfilingTime::GetCurMicroSecond();
+  std::vector<uint64_t> counts;
+  std::vector<LatencySample> new_samples;
+  for (size_t op_id = 0; op_id < ops_.size(); op_id++) {
+    OpLatency *op = ops_[op_id].get();
+    if (op == nullptr) {
+      continue;
+    }
+    op->histogram.Snapshot(&counts);
+    if (op->last_counts.empty()) {
+      op->last_counts.resize(counts.size(), 0);
+    }
+    bool has_rows = false;
+    for (size_t i = 0; i < counts.size(); i++) {
+      std::swap(counts[i], op->last_counts[i]);
+      // counts now holds the rows recorded since the last sample
+      counts[i] = op->last_counts[i] - counts[i];
+      has_rows = has_rows || counts[i] > 0;
+    }
+    if (has_rows) {
+      new_samples.push_back({ts, static_cast<int32_t>(op_id), LatencyHistogram::Percentile(counts, kP50),
+                             LatencyHistogram::Percentile(counts, kP99)});
+    }
+  }
+  std::lock_guard<std::mutex> guard(lock_);
+  (void)samples_.insert(samples_.end(), new_samples.begin(), new_samples.end());
+  return Status::OK();
+}
+
+Status RowTracing::GetOpLatency(int32_t op_id, double percentile, uint64_t *latency) {
+  RETURN_UNEXPECTED_IF_NULL(latency);
+  CHECK_FAIL_RETURN_UNEXPECTED(op_id >= 0 && static_cast<size_t>(op_id) < ops_.size() && ops_[op_id] != nullptr,
+                               "Invalid op id: " + std::to_string(op_id));
+  CHECK_FAIL_RETURN_UNEXPECTED(percentile >= 0 && percentile <= kMaxPercentile,
+                               "Expected percentile in [0, 100]. Got percentile: " + std::to_string(percentile));
+  std::vector<uint64_t> counts;
+  ops_[op_id]->histogram.Snapshot(&counts);
+  // the upper bound of the last bucket may be above the largest latency
+  *latency = std::min(LatencyHistogram::Percentile(counts, percentile), ops_[op_id]->histogram.max());
+  return Status::OK();
+}
+
+Status RowTracing::SaveToFile(const std::string &dir_path, const std::string &rank_id) {
+  Path path = GetFileName(dir_path, rank_id);
+  // Remove the file if it exists (from prior profiling usage)
+  RETURN_IF_NOT_OK(path.Remove());
+  std::string file_path = path.ToString();
+
+  // Each op is shown as a thread of the process, so its rows and latencies are on a track of their own.
+  nlohmann::json events = nlohmann::json::array();
+  events.push_back({{"name", "process_name"}, {"ph", "M"}, {"pid", 0}, {"args", {{"name", "MindData " + rank_id}}}});
+  nlohmann::json op_latency = nlohmann::json::array();
+  std::vector<uint64_t> counts;
+  for (size_t op_id = 0; op_id < ops_.size(); op_id++) {
+    OpLatency *op = ops_[op_id].get();
+    if (op == nullptr) {
+      continue;
+    }
+    events.push_back({{"name", "thread_name"},
+                      {"ph", "M"},
+                      {"pid", 0},
+                      {"tid", op_id},
+                      {"args", {{"name", OpLabel(static_cast<int32_t>(op_id))}}}});
+    op->histogram.Snapshot(&counts);
+    uint64_t count = op->histogram.count();
+    uint64_t max = op->histogram.max();
+    op_latency.push_back({{"op_id", op_id},
+                          {"op_type", op->name},
+                          {"count", count},
+                          {"mean_us", count == 0 ? 0 : op->histogram.sum() / count},
+                          {"p50_us", std::min(LatencyHistogram::Percentile(counts, kP50), max)},
+                          {"p99_us", std::min(LatencyHistogram::Percentile(counts, kP99), max)},
+                          {"max_us", max}});
+  }
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto &event : events_) {
+      events.push_back({{"name", "row"},
+                        {"cat", "row"},
+                        {"ph", "X"},
+                        {"pid", 0},
+                        {"tid", event.op_id},
+                        {"ts", event.start_ts},
+                        {"dur", event.duration}});
+    }
+    for (const auto &sample : samples_) {
+      // counters are grouped by name, so each op has its own counter track
+      events.push_back({{"name", "latency_us " + OpLabel(sample.op_id)},
+                        {"ph", "C"},
+                        {"pid", 0},
+                        {"tid", sample.op_id},
+                        {"ts", sample.ts},
+                        {"args", {{"p50", sample.p50}, {"p99", sample.p99}}}});
+    }
+  }
+
+  nlohmann::json output;
+  output["traceEvents"] = events;
+  output["displayTimeUnit"] = "ms";
+  output["otherData"] = {{"op_latency", op_latency}};
+  // Discard the content of the file when opening.
+  std::ofstream os(file_path, std::ios::trunc);
+  os << output;
+  os.close();
+  return Status::OK();
+}
+
+Status RowTracing::ChangeFileMode(const std::string &dir_path, const std::string &rank_id) {
+  Path path = GetFileName(dir_path, rank_id);
+  std::string file_path = path.ToString();
+  if (chmod(common::SafeCStr(file_path), S_IRUSR | S_IWUSR) == -1) {
+    std::string err_str = "Change file mode failed," + file_path;
+    return Status(StatusCode::kMDUnexpectedError, err_str);
+  }
+  return Status::OK();
+}
+
+void RowTracing::Clear() {
+  std::lock_guard<std::mutex> guard(lock_);
+  events_.clear();
+  samples_.clear();
+}
+
+std::string RowTracing::OpLabel(int32_t op_id) const {
+  return ops_[op_id]->name + "(ID:" + std::to_string(op_id) + ")";
+}
+
+Path RowTracing::GetFileName(const std::string &dir_path, const std::string &rank_id) {
+  return Path(dir_path) / Path("row_tracing_" + rank_id + ".json");
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_ROW_TRACING_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_ROW_TRACING_H_
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/dataset/engine/perf/profiling.h"
+
+namespace mindspore {
+namespace dataset {
+class ExecutionTree;
+
+// Histogram of latencies in us which can be updated by many threads without a lock.
+// Buckets are log-linear: values below 8 have a bucket each, and every power of two above is split into 8 buckets,
+// so a percentile is within 12.5% of the exact value.
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kSubBuckets = 1 << kSubBucketBits;
+  static constexpr int kNumBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  LatencyHistogram();
+
+  ~LatencyHistogram() = default;
+
+  // Add a latency
+  // @param latency - latency in us
+  void Add(uint64_t latency) {
+    (void)buckets_[BucketIndex(latency)].fetch_add(1, std::memory_order_relaxed);
+    (void)count_.fetch_add(1, std::memory_order_relaxed);
+    (void)sum_.fetch_add(latency, std::memory_order_relaxed);
+    uint64_t max = max_.load(std::memory_order_relaxed);
+    while (latency > max && !max_.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Copy the bucket counts, which may be slightly behind the other counters while rows are added
+  // @param counts - Returned count of each bucket
+  void Snapshot(std::vector<uint64_t> *counts) const;
+
+  uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+
+  uint64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+
+  uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+  // Get a percentile from bucket counts
+  // @param counts - count of each bucket, e.g. the difference of two snapshots
+  // @param percentile - the percentile in [0, 100]
+  // @return the upper bound of the bucket which holds the percentile, 0 if there is no count
+  static uint64_t Percentile(const std::vector<uint64_t> &counts, double percentile);
+
+  static int BucketIndex(uint64_t value) {
+    if (value < static_cast<uint64_t>(kSubBuckets)) {
+      return static_cast<int>(value);
+    }
+    int exponent = 63 - __builtin_clzll(value);
+    int mantissa = static_cast<int>((value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+    return (exponent - kSubBucketBits + 1) * kSubBuckets + mantissa;
+  }
+
+  // The largest value of a bucket
+  static uint64_t BucketUpperBound(int index);
+
+ private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_;
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> max_;
+};
+
+// Row tracing measures how long each row stays in each op of the pipeline, from the time the op gets it from its
+// child, or creates it, to the time the parent gets it from the op. The latencies of every op are kept in a
+// LatencyHistogram, p50 and p99 are sampled periodically by the monitor thread, and one row out of kEventInterval
+// is kept as a trace event. Everything is saved as a Chrome trace file which chrome://tracing or Perfetto can open.
+class RowTracing : public Sampling {
+ public:
+  explicit RowTracing(ExecutionTree *tree) : tree_(tree) {}
+
+  ~RowTracing() override = default;
+
+  // Sample the p50 and p99 latency of every op since the last sample
+  Status Sample() override;
+
+  std::string Name() const override { return kRowTracingName; }
+
+  // Save the trace events, the latency samples and the latency summary of the ops as a Chrome trace file
+  // @return Status The status code returned
+  Status SaveToFile(const std::string &dir_path, const std::string &rank_id) override;
+
+  Status Init() override;
+
+  // Change file mode after save row tracing data
+  Status ChangeFileMode(const std::string &dir_path, const std::string &rank_id) override;
+
+  // Record a row which leaves an op, it is called by the rows of all ops and does not take a lock
+  // @param op_id - id of the op
+  // @param start_ts - time in us when the row entered the op, 0 if unknown
+  // @param end_ts - time in us when the row left the op
+  void Record(int32_t op_id, uint64_t start_ts, uint64_t end_ts);
+
+  // Get a latency percentile of an op over all recorded rows
+  // @param op_id - id of the op
+  // @param percentile - the percentile in [0, 100]
+  // @param latency - Returned latency in us
+  // @return Status The status code returned
+  Status GetOpLatency(int32_t op_id, double percentile, uint64_t *latency);
+
+  // Clear all collected data
+  void Clear() override;
+
+ protected:
+  Path GetFileName(const std::string &dir_path, const std::string &rank_id) override;
+
+ private:
+  static constexpr uint64_t kEventInterval = 100;
+  static constexpr size_t kMaxEvents = 100000;
+
+  struct OpLatency {
+    std::string name;
+    LatencyHistogram histogram;
+    std::atomic<uint64_t> num_rows{0};
+    std::vector<uint64_t> last_counts;  // bucket counts of the last sample, only used by the monitor thread
+  };
+
+  struct RowEvent {
+    int32_t op_id;
+    uint64_t start_ts;
+    uint64_t duration;
+  };
+
+  struct LatencySample {
+    uint64_t ts;
+    int32_t op_id;
+    uint64_t p50;
+    uint64_t p99;
+  };
+
+  // Name of an op in the trace, e.g. MapOp(ID:2)
+  std::string OpLabel(int32_t op_id) const;
+
+  ExecutionTree *tree_ = nullptr;
+  std::vector<std::unique_ptr<OpLatency>> ops_;  // indexed by op id, null for ids which are not in the tree
+  std::vector<RowEvent> events_;
+  std::vector<LatencySample> samples_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_ROW_TRACING_H_
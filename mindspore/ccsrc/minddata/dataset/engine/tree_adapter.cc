@@ -23,6 +23,7 @@
 #include "minddata/dataset/engine/opt/pre/cache_transform_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_offload_pass.h"
 #include "minddata/dataset/engine/opt/post/repeat_pass.h"
+#include "minddata/dataset/engine/opt/post/row_block_pass.h"
 #endif
 #include "minddata/dataset/engine/opt/pass.h"
 #include "minddata/dataset/engine/opt/post/auto_worker_pass.h"
@@ -126,6 +127,10 @@ Status TreeAdapter::PostPass(std::shared_ptr<DatasetNode> ir) {
 #endif
 #ifndef ENABLE_ANDROID
   (void)actions.emplace_back(std::make_unique<RepeatPass>());
+  // row blocks of several workers are interleaved block by block instead of row by row
+  if (GlobalContext::config_manager()->enable_row_block()) {
+    (void)actions.emplace_back(std::make_unique<RowBlockPass>());
+  }
 #endif
   // We will gradually move RepeatPass from ExecutionTree::PrepareTreePostAction to here.
 
@@ -28,7 +28,7 @@ namespace dataset {
 
 class DuplicateOp : public TensorOp {
  public:
-  DuplicateOp() = default;
+  DuplicateOp() { is_elementwise_ = true; }
 
   ~DuplicateOp() override = default;
 
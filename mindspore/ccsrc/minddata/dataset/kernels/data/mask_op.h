@@ -33,7 +33,9 @@ namespace dataset {
 class MaskOp : public TensorOp {
  public:
   MaskOp(RelationalOp op, std::shared_ptr<Tensor> value, DataType type = DataType(DataType::DE_BOOL))
-      : op_(op), value_(std::move(value)), type_(type), cast_(new TypeCastOp(type)) {}
+      : op_(op), value_(std::move(value)), type_(type), cast_(new TypeCastOp(type)) {
+    is_elementwise_ = true;
+  }
 
   ~MaskOp() override = default;
 
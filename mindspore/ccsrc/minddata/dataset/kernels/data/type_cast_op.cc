@@ -21,9 +21,12 @@
 
 namespace mindspore {
 namespace dataset {
-TypeCastOp::TypeCastOp(const DataType &new_type) : type_(new_type) {}
+TypeCastOp::TypeCastOp(const DataType &new_type) : type_(new_type) { is_elementwise_ = true; }
 
-TypeCastOp::TypeCastOp(const std::string &data_type) { type_ = DataType(data_type); }
+TypeCastOp::TypeCastOp(const std::string &data_type) {
+  type_ = DataType(data_type);
+  is_elementwise_ = true;
+}
 
 Status TypeCastOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/decode_resize_op.h"
+
+#include <vector>
+
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+
+namespace mindspore {
+namespace dataset {
+DecodeResizeOp::DecodeResizeOp(const ResizeOp &rhs)
+    : ResizeOp(rhs), scaled_decode_(GlobalContext::config_manager()->enable_jpeg_scaled_decode()) {}
+
+Status DecodeResizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  if (!scaled_decode_ || input->Rank() != 1 || !IsNonEmptyJPEG(input)) {
+    std::shared_ptr<Tensor> decoded;
+    RETURN_IF_NOT_OK(DecodeOp(true).Compute(input, &decoded));
+    return ResizeOp::Compute(decoded, output);
+  }
+  // the output size is computed from the full resolution image, so it does not depend on the DCT scale
+  int input_h = 0;
+  int input_w = 0;
+  RETURN_IF_NOT_OK(GetJpegImageInfo(input, &input_w, &input_h));
+  int32_t output_h = 0;
+  int32_t output_w = 0;
+  RETURN_IF_NOT_OK(GetOutputSize(input_h, input_w, &output_h, &output_w));
+  std::shared_ptr<Tensor> decoded;
+  RETURN_IF_NOT_OK(JpegCropAndDecode(input, &decoded, 0, 0, 0, 0, output_w, output_h));
+  if (decoded->shape()[0] == output_h && decoded->shape()[1] == output_w) {
+    *output = decoded;
+    return Status::OK();
+  }
+  return Resize(decoded, output, output_h, output_w, 0.0, 0.0, interpolation_);
+}
+
+Status DecodeResizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
+  std::vector<TensorShape> decoded;
+  RETURN_IF_NOT_OK(DecodeOp(true).OutputShape(inputs, decoded));
+  return ResizeOp::OutputShape(decoded, outputs);
+}
+
+Status DecodeResizeOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  outputs[0] = DataType(DataType::DE_UINT8);
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
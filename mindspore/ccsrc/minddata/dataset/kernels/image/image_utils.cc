@@ -499,8 +499,19 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
     STATUS_ERROR(StatusCode::kMDUnexpectedError, "Error raised by libjpeg: " + std::string(jpeg_error_msg)));
 }
 
+// Get the largest DCT scaling denominator which keeps a crop of crop_w x crop_h at least min_w x min_h
+static unsigned int JpegScaleDenom(int crop_w, int crop_h, int min_w, int min_h) {
+  // libjpeg has fast paths for the scales 1/2, 1/4 and 1/8
+  constexpr unsigned int kMaxScaleDenom = 8;
+  unsigned int denom = kMaxScaleDenom;
+  while (denom > 1 && (crop_w / static_cast<int>(denom) < min_w || crop_h / static_cast<int>(denom) < min_h)) {
+    denom /= 2;
+  }
+  return denom;
+}
+
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+                         int crop_w, int crop_h, int min_w, int min_h) {
   struct jpeg_decompress_struct cinfo;
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -514,18 +525,48 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
+  } catch (std::runtime_error &e) {
+    return DestroyDecompressAndReturnError(e.what());
+  }
+  bool whole_image = (crop_x == 0 && crop_y == 0 && crop_w == 0 && crop_h == 0);
+  if (min_w > 0 && min_h > 0) {
+    int region_w = whole_image ? static_cast<int>(cinfo.image_width) : crop_w;
+    int region_h = whole_image ? static_cast<int>(cinfo.image_height) : crop_h;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = JpegScaleDenom(region_w, region_h, min_w, min_h);
+  }
+  try {
     jpeg_calc_output_dimensions(&cinfo);
     RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
   } catch (std::runtime_error &e) {
     return DestroyDecompressAndReturnError(e.what());
   }
+  if (cinfo.scale_denom > 1 && !whole_image) {
+    // map the crop window onto the scaled image, rounding outwards so nothing of the window is lost
+    const int denom = static_cast<int>(cinfo.scale_denom);
+    if (crop_x < 0 || crop_y < 0 || crop_w <= 0 || crop_h <= 0 ||
+        static_cast<int64_t>(crop_x) + crop_w > static_cast<int64_t>(cinfo.image_width) ||
+        static_cast<int64_t>(crop_y) + crop_h > static_cast<int64_t>(cinfo.image_height)) {
+      return DestroyDecompressAndReturnError(
+        "Crop: invalid crop size, corresponding crop value equal to 0 or too big, got crop width: " +
+        std::to_string(crop_w) + ", crop height:" + std::to_string(crop_h) +
+        ", and crop x coordinate:" + std::to_string(crop_x) + ", crop y coordinate:" + std::to_string(crop_y));
+    }
+    int crop_x_end = std::min((crop_x + crop_w + denom - 1) / denom, static_cast<int>(cinfo.output_width));
+    int crop_y_end = std::min((crop_y + crop_h + denom - 1) / denom, static_cast<int>(cinfo.output_height));
+    crop_x /= denom;
+    crop_y /= denom;
+    crop_w = crop_x_end - crop_x;
+    crop_h = crop_y_end - crop_y;
+  }
   CHECK_FAIL_RETURN_UNEXPECTED((std::numeric_limits<int32_t>::max() - crop_w) > crop_x,
                                "JpegCropAndDecode: addition(crop x and crop width) out of bounds, got crop x:" +
                                  std::to_string(crop_x) + ", and crop width:" + std::to_string(crop_w));
   CHECK_FAIL_RETURN_UNEXPECTED((std::numeric_limits<int32_t>::max() - crop_h) > crop_y,
                                "JpegCropAndDecode: addition(crop y and crop height) out of bounds, got crop y:" +
                                  std::to_string(crop_y) + ", and crop height:" + std::to_string(crop_h));
-  if (crop_x == 0 && crop_y == 0 && crop_w == 0 && crop_h == 0) {
+  if (whole_image) {
     crop_w = cinfo.output_width;
     crop_h = cinfo.output_height;
   } else if (crop_w == 0 || static_cast<unsigned int>(crop_w + crop_x) > cinfo.output_width || crop_h == 0 ||
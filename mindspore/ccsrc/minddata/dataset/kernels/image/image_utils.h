@@ -157,8 +157,14 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input);
 
 void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size);
 
+/// \brief Decode a JPEG image and crop it while decoding, only the rows and iMCU columns of the crop are decompressed
+/// \param input: Tensor containing the not decoded JPEG bytes
+/// \param output: Decoded image Tensor of shape <H,W,C> and type DE_UINT8. Pixel order is RGB
+/// \param x, y, w, h: crop window in the full resolution image, all 0 means no crop
+/// \param min_w, min_h: if both are positive, decode at the smallest DCT scale (1/8, 1/4 or 1/2) that still leaves
+///     the crop at least min_w x min_h, the crop window is scaled accordingly. Use it when the crop is resized next.
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
-                         int w = 0, int h = 0);
+                         int w = 0, int h = 0, int min_w = 0, int min_h = 0);
 
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
@@ -17,6 +17,7 @@
 #include <random>
 #include "minddata/dataset/kernels/image/image_utils.h"
 #include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
 
 namespace mindspore {
@@ -25,7 +26,11 @@ RandomCropDecodeResizeOp::RandomCropDecodeResizeOp(int32_t target_height, int32_
                                                    float scale_ub, float aspect_lb, float aspect_ub,
                                                    InterpolationMode interpolation, int32_t max_attempts)
     : RandomCropAndResizeOp(target_height, target_width, scale_lb, scale_ub, aspect_lb, aspect_ub, interpolation,
-                            max_attempts) {}
+                            max_attempts),
+      scaled_decode_(GlobalContext::config_manager()->enable_jpeg_scaled_decode()) {}
+
+RandomCropDecodeResizeOp::RandomCropDecodeResizeOp(const RandomCropAndResizeOp &rhs)
+    : RandomCropAndResizeOp(rhs), scaled_decode_(GlobalContext::config_manager()->enable_jpeg_scaled_decode()) {}
 
 Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
@@ -53,7 +58,12 @@ Status RandomCropDecodeResizeOp::Compute(const TensorRow &input, TensorRow *outp
         RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
       }
       std::shared_ptr<Tensor> decoded_tensor = nullptr;
-      RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, x, y, crop_width, crop_height));
+      if (scaled_decode_) {
+        RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, x, y, crop_width, crop_height, target_width_,
+                                           target_height_));
+      } else {
+        RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded_tensor, x, y, crop_width, crop_height));
+      }
       RETURN_IF_NOT_OK(Resize(decoded_tensor, &(*output)[i], target_height_, target_width_, 0.0, 0.0, interpolation_));
     }
   }
@@ -39,20 +39,7 @@ Status ResizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
   int32_t input_w = size[kWidthIndex];
   int32_t output_h;
   int32_t output_w;
-  if (size2_ == 0) {
-    if (input_h < input_w) {
-      CHECK_FAIL_RETURN_UNEXPECTED(input_h != 0, "Resize: the input height cannot be 0.");
-      output_h = size1_;
-      output_w = static_cast<int>(std::floor(static_cast<float>(input_w) / input_h * output_h));
-    } else {
-      CHECK_FAIL_RETURN_UNEXPECTED(input_w != 0, "Resize: the input width cannot be 0.");
-      output_w = size1_;
-      output_h = static_cast<int>(std::floor(static_cast<float>(input_h) / input_w * output_w));
-    }
-  } else {
-    output_h = size1_;
-    output_w = size2_;
-  }
+  RETURN_IF_NOT_OK(GetOutputSize(input_h, input_w, &output_h, &output_w));
   if (input_h == output_h && input_w == output_w) {
     *output = input;
     return Status::OK();
@@ -83,6 +70,26 @@ Status ResizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
   return Status::OK();
 }
 
+Status ResizeOp::GetOutputSize(int32_t input_h, int32_t input_w, int32_t *output_h, int32_t *output_w) const {
+  RETURN_UNEXPECTED_IF_NULL(output_h);
+  RETURN_UNEXPECTED_IF_NULL(output_w);
+  if (size2_ == 0) {
+    if (input_h < input_w) {
+      CHECK_FAIL_RETURN_UNEXPECTED(input_h != 0, "Resize: the input height cannot be 0.");
+      *output_h = size1_;
+      *output_w = static_cast<int>(std::floor(static_cast<float>(input_w) / input_h * (*output_h)));
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED(input_w != 0, "Resize: the input width cannot be 0.");
+      *output_w = size1_;
+      *output_h = static_cast<int>(std::floor(static_cast<float>(input_h) / input_w * (*output_w)));
+    }
+  } else {
+    *output_h = size1_;
+    *output_w = size2_;
+  }
+  return Status::OK();
+}
+
 Status ResizeOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
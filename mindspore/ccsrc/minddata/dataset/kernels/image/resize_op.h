@@ -59,6 +59,9 @@ class ResizeOp : public TensorOp {
   std::string Name() const override { return kResizeOp; }
 
  protected:
+  // Get the output size for an input image of input_h x input_w
+  Status GetOutputSize(int32_t input_h, int32_t input_w, int32_t *output_h, int32_t *output_w) const;
+
   int32_t size1_;
   int32_t size2_;
   InterpolationMode interpolation_;
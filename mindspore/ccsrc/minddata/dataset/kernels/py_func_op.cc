@@ -15,6 +15,7 @@
  */
 #include "minddata/dataset/kernels/py_func_op.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -26,16 +27,62 @@
 
 namespace mindspore {
 namespace dataset {
-Status ConvertNumpyToTensor(const py::object &py_obj, TensorRow *output) {
-  std::shared_ptr<Tensor> out;
-  // Python object like bool, int, float, list or tuple can also be converted
-  // to a NumPy array by the following cast, but the data type will be unknown
-  // if it is not a valid NumPy object
-  RETURN_IF_NOT_OK(Tensor::CreateFromNpArray(py_obj.cast<py::array>(), &out));
-  output->push_back(out);
+namespace {
+// Convert the numpy arrays returned by the python function to tensors. The data of numeric C-contiguous arrays is
+// copied without holding the GIL, so the map workers which wait for python multiprocessing workers only hold the GIL
+// for the python calls. The arrays are referenced by py_objs and stay alive during the copies.
+Status ConvertNumpyToTensors(const std::vector<py::object> &py_objs, TensorRow *output) {
+  std::vector<py::array> arrays;
+  for (const auto &py_obj : py_objs) {
+    // Python object like bool, int, float, list or tuple can also be converted
+    // to a NumPy array by the following cast, but the data type will be unknown
+    // if it is not a valid NumPy object
+    arrays.push_back(py_obj.cast<py::array>());
+  }
+  std::vector<std::shared_ptr<Tensor>> tensors(arrays.size());
+  std::vector<const uchar *> srcs(arrays.size(), nullptr);
+  for (size_t i = 0; i < arrays.size(); i++) {
+    DataType type = DataType::FromNpArray(arrays[i]);
+    if (type.IsNumeric() && (arrays[i].flags() & py::array::c_style)) {
+      std::vector<dsize_t> shape(arrays[i].shape(), arrays[i].shape() + arrays[i].ndim());
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(shape), type, &tensors[i]));
+      srcs[i] = static_cast<const uchar *>(arrays[i].data());
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateFromNpArray(arrays[i], &tensors[i]));
+    }
+  }
+  {
+    py::gil_scoped_release gil_release;
+    for (size_t i = 0; i < tensors.size(); i++) {
+      int64_t byte_size = tensors[i]->SizeInBytes();
+      if (srcs[i] != nullptr && byte_size > 0) {
+        (void)std::copy(srcs[i], srcs[i] + byte_size, tensors[i]->GetMutableBuffer());
+      }
+    }
+  }
+  (void)output->insert(output->end(), tensors.begin(), tensors.end());
   return Status::OK();
 }
 
+// Wrap a tensor into a numpy array for the python function. Numeric tensors are wrapped without copying into a
+// read-only array which keeps the tensor alive.
+Status ConvertTensorToNumpy(const std::shared_ptr<Tensor> &tensor, bool zero_copy, py::array *out) {
+  if (!zero_copy || !tensor->type().IsNumeric() || tensor->GetBuffer() == nullptr) {
+    return tensor->GetDataAsNumpy(out);
+  }
+  auto *holder = new std::shared_ptr<Tensor>(tensor);
+  py::capsule base(holder, [](void *p) { delete static_cast<std::shared_ptr<Tensor> *>(p); });
+  *out = py::array(tensor->type().AsNumpyType(), tensor->shape().AsVector(), tensor->GetBuffer(), base);
+  (void)out->attr("setflags")(false);
+  return Status::OK();
+}
+}  // namespace
+
+bool PyFuncOp::ZeroCopyInputs(const py::function &func) {
+  return py::hasattr(func, "zero_copy_inputs") &&
+         static_cast<bool>(py::reinterpret_borrow<py::bool_>(func.attr("zero_copy_inputs")));
+}
+
 Status PyFuncOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
   Status ret = Status(StatusCode::kSuccess, "PyFunc Call Succeed");
@@ -53,7 +100,7 @@ Status PyFuncOp::Compute(const TensorRow &input, TensorRow *output) {
       if (input.size() > 0) {
         for (size_t i = 0; i < input.size(); i++) {
           py::array new_data;
-          RETURN_IF_NOT_OK(input.at(i)->GetDataAsNumpy(&new_data));
+          RETURN_IF_NOT_OK(ConvertTensorToNumpy(input.at(i), zero_copy_inputs_, &new_data));
           // possible memcpy here
           input_args[i] = new_data;
         }
@@ -68,7 +115,7 @@ Status PyFuncOp::Compute(const TensorRow &input, TensorRow *output) {
         if (py::isinstance<py::tuple>(ret_py_obj)) {
           // In case of a n-m mapping, the return value will be a tuple of numpy arrays
           auto ret_py_tuple = ret_py_obj.cast<py::tuple>();
-          // Iterate over two containers simultaneously for memory copy
+          std::vector<py::object> ret_py_eles;
           for (size_t i = 0; i < ret_py_tuple.size(); i++) {
             py::object ret_py_ele = ret_py_tuple[i];
             // Object is none if pyfunc timeout
@@ -77,11 +124,12 @@ Status PyFuncOp::Compute(const TensorRow &input, TensorRow *output) {
                               "True, PyFunc may execute time out.";
               goto TimeoutError;
             }
-            RETURN_IF_NOT_OK(ConvertNumpyToTensor(ret_py_ele, output));
+            ret_py_eles.push_back(ret_py_ele);
           }
+          RETURN_IF_NOT_OK(ConvertNumpyToTensors(ret_py_eles, output));
         } else {
           // In case of a n-1 mapping, the return value will be a numpy array
-          RETURN_IF_NOT_OK(ConvertNumpyToTensor(ret_py_obj, output));
+          RETURN_IF_NOT_OK(ConvertNumpyToTensors({ret_py_obj}, output));
         }
       }
     } catch (const py::error_already_set &e) {
@@ -29,9 +29,12 @@ namespace mindspore {
 namespace dataset {
 class PyFuncOp : public TensorOp {
  public:
-  explicit PyFuncOp(py::function func) : py_func_ptr_(std::move(func)) { output_type_ = DataType::DE_UNKNOWN; }
+  explicit PyFuncOp(py::function func)
+      : py_func_ptr_(std::move(func)), zero_copy_inputs_(ZeroCopyInputs(py_func_ptr_)) {
+    output_type_ = DataType::DE_UNKNOWN;
+  }
   explicit PyFuncOp(py::function func, DataType::Type output_type)
-      : py_func_ptr_(std::move(func)), output_type_(output_type) {}
+      : py_func_ptr_(std::move(func)), output_type_(output_type), zero_copy_inputs_(ZeroCopyInputs(py_func_ptr_)) {}
 
   ~PyFuncOp() override = default;
 
@@ -58,8 +61,15 @@ class PyFuncOp : public TensorOp {
   bool IsRandom();
 
  private:
+  /// \brief Check whether the python function only reads its inputs, e.g. it sends them to python multiprocessing
+  ///    workers, so that numeric inputs can be passed as read-only numpy views of the tensors instead of copies.
+  /// \param[in] func The python function
+  /// \return True if the function has a true zero_copy_inputs attribute
+  static bool ZeroCopyInputs(const py::function &func);
+
   py::function py_func_ptr_;
   DataType::Type output_type_;
+  bool zero_copy_inputs_;
 };
 }  // namespace dataset
 }  // namespace mindspore
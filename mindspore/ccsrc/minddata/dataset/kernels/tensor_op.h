@@ -63,6 +63,7 @@ constexpr char kAutoAugmentOp[] = "AutoAugmentOp";
 constexpr char kAutoContrastOp[] = "AutoContrastOp";
 constexpr char kBoundingBoxAugmentOp[] = "BoundingBoxAugmentOp";
 constexpr char kDecodeOp[] = "DecodeOp";
+constexpr char kDecodeResizeOp[] = "DecodeResizeOp";
 constexpr char kCenterCropOp[] = "CenterCropOp";
 constexpr char kConvertColorOp[] = "ConvertColorOp";
 constexpr char kCutMixBatchOp[] = "CutMixBatchOp";
@@ -270,6 +271,11 @@ class TensorOp {
   // @return true/false
   bool Deterministic() { return is_deterministic_; }
 
+  // Returns true if every element of the output only depends on the element at the same index of the input, so the
+  // TensorOp can be applied to a row block, where each column holds the values of many rows.
+  // @return true/false
+  bool Elementwise() const { return is_elementwise_; }
+
   // Function to determine the number of inputs the TensorOp can take. 0: means undefined.
   // @return uint32_t
   virtual uint32_t NumInput() { return 1; }
@@ -300,6 +306,7 @@ class TensorOp {
 
  protected:
   bool is_deterministic_{true};
+  bool is_elementwise_{false};
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,159 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/double_array_trie.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int32_t kFree = -1;
+constexpr size_t kNumLabels = 256;
+}  // namespace
+
+void DoubleArrayTrie::Build(const std::unordered_map<WordType, WordIdType> &words) {
+  std::vector<std::pair<std::string_view, WordIdType>> keys;
+  keys.reserve(words.size());
+  size_t total_bytes = 0;
+  for (const auto &word : words) {
+    if (!word.first.empty()) {
+      (void)keys.emplace_back(word.first, word.second);
+      total_bytes += word.first.size();
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+
+  base_.clear();
+  check_.clear();
+  values_.clear();
+  // free slots are kept in a circular doubly linked list, so a base is only tried where its first child fits
+  std::vector<int32_t> next_free;
+  std::vector<int32_t> prev_free;
+  int32_t first_free = kFree;
+  auto grow = [&](size_t size) {
+    size_t old_size = check_.size();
+    base_.resize(size, 0);
+    check_.resize(size, kFree);
+    values_.resize(size, Vocab::kNoTokenExists);
+    next_free.resize(size);
+    prev_free.resize(size);
+    for (size_t i = std::max<size_t>(old_size, 1); i < size; i++) {
+      auto slot = static_cast<int32_t>(i);
+      if (first_free == kFree) {
+        first_free = slot;
+        next_free[slot] = slot;
+        prev_free[slot] = slot;
+      } else {
+        int32_t last = prev_free[first_free];
+        next_free[last] = slot;
+        prev_free[slot] = last;
+        next_free[slot] = first_free;
+        prev_free[first_free] = slot;
+      }
+    }
+  };
+  auto use = [&](size_t slot, int32_t parent) {
+    auto i = static_cast<int32_t>(slot);
+    check_[slot] = parent;
+    if (next_free[i] == i) {
+      first_free = kFree;
+      return;
+    }
+    next_free[prev_free[i]] = next_free[i];
+    prev_free[next_free[i]] = prev_free[i];
+    if (first_free == i) {
+      first_free = next_free[i];
+    }
+  };
+  grow(total_bytes + kNumLabels + 1);
+  check_[kRoot] = kRoot;
+
+  // Each item is a node and the range of sorted keys below it, which share the first depth bytes.
+  struct Range {
+    int32_t node;
+    size_t depth;
+    size_t begin;
+    size_t end;
+  };
+  std::vector<Range> ranges = {{kRoot, 0, 0, keys.size()}};
+  std::vector<std::pair<size_t, size_t>> children;  // (label, first key) of each child
+  size_t last_used = kRoot;
+  while (!ranges.empty()) {
+    Range range = ranges.back();
+    ranges.pop_back();
+    size_t i = range.begin;
+    // the key which ends at the node is the smallest one
+    if (i < range.end && keys[i].first.size() == range.depth) {
+      values_[range.node] = keys[i].second;
+      i++;
+    }
+    children.clear();
+    for (; i < range.end; i++) {
+      size_t label = static_cast<unsigned char>(keys[i].first[range.depth]) + 1;
+      if (children.empty() || children.back().first != label) {
+        (void)children.emplace_back(label, i);
+      }
+    }
+    if (children.empty()) {
+      continue;
+    }
+
+    // try the free slots in order for the first child, until the other children fit as well
+    if (first_free == kFree) {
+      grow(check_.size() * 2);
+    }
+    size_t base = 0;
+    int32_t slot = first_free;
+    while (true) {
+      if (static_cast<size_t>(slot) > children.front().first) {
+        base = static_cast<size_t>(slot) - children.front().first;
+        if (base + kNumLabels + 1 > check_.size()) {
+          grow(std::max(check_.size() * 2, base + kNumLabels + 1));
+        }
+        if (std::all_of(children.begin(), children.end(),
+                        [this, base](const auto &child) { return check_[base + child.first] == kFree; })) {
+          break;
+        }
+      }
+      slot = next_free[slot];
+      if (slot == first_free) {
+        // all free slots are tried, the first new slot will do
+        size_t size = check_.size();
+        grow(size * 2);
+        slot = static_cast<int32_t>(size);
+      }
+    }
+
+    base_[range.node] = static_cast<int32_t>(base);
+    for (size_t j = 0; j < children.size(); j++) {
+      size_t node = base + children[j].first;
+      use(node, range.node);
+      last_used = std::max(last_used, node);
+      size_t end = j + 1 < children.size() ? children[j + 1].second : range.end;
+      ranges.push_back({static_cast<int32_t>(node), range.depth + 1, children[j].second, end});
+    }
+  }
+
+  base_.resize(last_used + 1);
+  check_.resize(last_used + 1);
+  values_.resize(last_used + 1);
+  base_.shrink_to_fit();
+  check_.shrink_to_fit();
+  values_.shrink_to_fit();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_DOUBLE_ARRAY_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_DOUBLE_ARRAY_TRIE_H_
+
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/include/dataset/text.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A read-only byte trie of the words of a vocab, stored as a double array.
+/// \note The child of node s on byte c is node t = base[s] + c + 1 if check[t] == s, so following an edge costs two
+///     array reads and no node is allocated. The word ending at a node is kept in a separate array of ids.
+class DoubleArrayTrie {
+ public:
+  /// \brief The node of the empty string.
+  static constexpr int32_t kRoot = 0;
+
+  DoubleArrayTrie() = default;
+
+  ~DoubleArrayTrie() = default;
+
+  /// \brief Build the trie from the words of a vocab, the previous content is dropped.
+  /// \param[in] words The map from words to their ids, the empty word is ignored.
+  void Build(const std::unordered_map<WordType, WordIdType> &words);
+
+  /// \brief Follow the edge of a byte.
+  /// \param[in] c The byte.
+  /// \param[in, out] node The node to start from, it is moved to the child if the edge exists.
+  /// \return Whether the edge exists.
+  bool Next(unsigned char c, int32_t *node) const {
+    size_t next = static_cast<size_t>(base_[*node]) + c + 1;
+    if (next >= check_.size() || check_[next] != *node) {
+      return false;
+    }
+    *node = static_cast<int32_t>(next);
+    return true;
+  }
+
+  /// \brief Follow the edges of all bytes of a string.
+  /// \param[in] str The string.
+  /// \param[in, out] node The node to start from, it is moved to the last node reached.
+  /// \return Whether all edges exist.
+  bool Next(std::string_view str, int32_t *node) const {
+    for (char c : str) {
+      if (!Next(static_cast<unsigned char>(c), node)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// \brief Get the id of the word ending at a node.
+  /// \param[in] node The node.
+  /// \return The id, or Vocab::kNoTokenExists if no word ends at the node.
+  WordIdType Value(int32_t node) const { return values_[node]; }
+
+ private:
+  std::vector<int32_t> base_;
+  std::vector<int32_t> check_;
+  std::vector<WordIdType> values_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_DOUBLE_ARRAY_TRIE_H_
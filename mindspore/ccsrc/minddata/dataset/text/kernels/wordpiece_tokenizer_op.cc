@@ -17,10 +17,33 @@
 #include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
 #include <algorithm>
 #include <utility>
+
 #include "minddata/dataset/text/kernels/data_utils.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Get the length of the utf8 char which starts at str from its first byte, or 0 if it is invalid or truncated.
+// Only the first byte is checked, the same as cppjieba decodes a string.
+int RuneLength(const char *str, size_t len) {
+  constexpr uint8_t kMaxOneByte = 0x7f;
+  constexpr uint8_t kMaxTwoBytes = 0xdf;
+  constexpr uint8_t kMaxThreeBytes = 0xef;
+  constexpr uint8_t kMaxFourBytes = 0xf7;
+  auto first = static_cast<uint8_t>(str[0]);
+  int rune_len = 0;
+  if (first <= kMaxOneByte) {
+    rune_len = 1;
+  } else if (first <= kMaxTwoBytes) {
+    rune_len = 2;
+  } else if (first <= kMaxThreeBytes) {
+    rune_len = 3;
+  } else if (first <= kMaxFourBytes) {
+    rune_len = 4;
+  }
+  return static_cast<size_t>(rune_len) <= len ? rune_len : 0;
+}
+}  // namespace
 
 const char WordpieceTokenizerOp::kDefSuffixIndicator[] = "##";
 const int WordpieceTokenizerOp::kDefMaxBytesPerToken = 100;
@@ -33,55 +56,57 @@ WordpieceTokenizerOp::WordpieceTokenizerOp(const std::shared_ptr<Vocab> &vocab,
       vocab_(vocab),
       suffix_indicator_(suffix_indicator),
       max_bytes_per_token_(max_bytes_per_token),
-      unknown_token_(unknown_token) {}
+      unknown_token_(unknown_token),
+      suffix_node_(-1) {
+  if (vocab_ != nullptr) {
+    trie_.Build(vocab_->GetVocab());
+  }
+  int32_t node = DoubleArrayTrie::kRoot;
+  if (trie_.Next(suffix_indicator_, &node)) {
+    suffix_node_ = node;
+  }
+}
 
-Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start,
-                                        bool *out_found, int *out_end) const {
+Status WordpieceTokenizerOp::LookupWord(std::string_view input_token, const int start, int *out_end) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && start < input_token.size(), "WordpieceTokenizer: LookupWord Out of range");
-  *out_found = false;
-  for (int i = runes.size() - 1; i >= 0; i--) {
-    *out_end = runes[i].offset + runes[i].len;
-    int len = *out_end - start;
-    std::string word = input_token.substr(start, len);
-    if (start > 0) {
-      word = suffix_indicator_ + word;
+  *out_end = start;
+  int32_t node = start > 0 ? suffix_node_ : DoubleArrayTrie::kRoot;
+  if (node < 0) {
+    return Status::OK();
+  }
+  // walk down the trie one char at a time, the last word seen is the longest one
+  int pos = start;
+  while (pos < static_cast<int>(input_token.size())) {
+    int rune_len = RuneLength(input_token.data() + pos, input_token.size() - pos);
+    int rune_end = pos + rune_len;
+    for (; pos < rune_end; pos++) {
+      if (!trie_.Next(static_cast<unsigned char>(input_token[pos]), &node)) {
+        return Status::OK();
+      }
     }
-    if (vocab_->TokensToIds(word) != Vocab::kNoTokenExists) {
-      *out_found = true;
-      break;
+    if (trie_.Value(node) != Vocab::kNoTokenExists) {
+      *out_end = pos;
     }
   }
   return Status::OK();
 }
 
-Status WordpieceTokenizerOp::FoundNoToken(const std::string &input_token, const uint32_t &basic_start,
-                                          std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
-                                          std::vector<uint32_t> *offsets_limit) const {
-  out_tokens->clear();
+void WordpieceTokenizerOp::FoundNoToken(std::string_view input_token, const uint32_t &basic_start, size_t first,
+                                        std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+                                        std::vector<uint32_t> *offsets_limit) const {
+  out_tokens->resize(first);
+  offsets_start->resize(first);
+  offsets_limit->resize(first);
   offsets_start->push_back(basic_start);
   if (unknown_token_.empty()) {
     (void)out_tokens->emplace_back(input_token);
-    offsets_limit->push_back(basic_start + input_token.length());
   } else {
     (void)out_tokens->emplace_back(unknown_token_);
-    offsets_limit->push_back(basic_start + input_token.length());
-  }
-  return Status::OK();
-}
-
-Status WordpieceTokenizerOp::AddSubword(const std::string &input_token, const int &start, const int &end,
-                                        std::vector<std::string> *out_tokens) const {
-  CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && end > start && end <= static_cast<int>(input_token.size()),
-                               "Out of range");
-  std::string subword = input_token.substr(start, end - start);
-  if (start > 0) {
-    subword = suffix_indicator_ + subword;
   }
-  (void)out_tokens->emplace_back(subword);
-  return Status::OK();
+  offsets_limit->push_back(basic_start + input_token.length());
 }
 
-Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uint32_t &basic_start,
+Status WordpieceTokenizerOp::GetTokens(std::string_view input_token, const uint32_t &basic_start,
                                        std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
                                        std::vector<uint32_t> *offsets_limit) const {
   if (input_token.size() > static_cast<int>(max_bytes_per_token_)) {
@@ -95,22 +120,30 @@ Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uin
     }
     return Status::OK();
   }
-  RuneStrArray runes;
-  if (!DecodeRunesInString(input_token.data(), input_token.size(), runes)) {
-    RETURN_STATUS_UNEXPECTED("WordpieceTokenizer: Decode utf8 string failed.");
+  for (size_t pos = 0; pos < input_token.size();) {
+    int rune_len = RuneLength(input_token.data() + pos, input_token.size() - pos);
+    if (rune_len == 0) {
+      RETURN_STATUS_UNEXPECTED("WordpieceTokenizer: Decode utf8 string failed.");
+    }
+    pos += rune_len;
   }
+  size_t first = out_tokens->size();
   int end = 0;
-  for (int start = 0; start < static_cast<int>(input_token.size());) {
-    bool found = false;
-    RETURN_IF_NOT_OK(LookupWord(input_token, runes, start, &found, &end));
-    if (found) {
-      RETURN_IF_NOT_OK(AddSubword(input_token, start, end, out_tokens));
-      offsets_start->push_back(static_cast<uint32_t>(basic_start + start));
-      offsets_limit->push_back(static_cast<uint32_t>(basic_start + end));
-      start = end;
-    } else {
-      return FoundNoToken(input_token, basic_start, out_tokens, offsets_start, offsets_limit);
+  for (int start = 0; start < static_cast<int>(input_token.size()); start = end) {
+    RETURN_IF_NOT_OK(LookupWord(input_token, start, &end));
+    if (end == start) {
+      FoundNoToken(input_token, basic_start, first, out_tokens, offsets_start, offsets_limit);
+      return Status::OK();
+    }
+    std::string subword;
+    if (start > 0) {
+      subword.reserve(suffix_indicator_.size() + end - start);
+      subword = suffix_indicator_;
     }
+    (void)subword.append(input_token.substr(start, end - start));
+    (void)out_tokens->emplace_back(std::move(subword));
+    offsets_start->push_back(static_cast<uint32_t>(basic_start + start));
+    offsets_limit->push_back(static_cast<uint32_t>(basic_start + end));
   }
   return Status::OK();
 }
@@ -121,25 +154,30 @@ Status WordpieceTokenizerOp::Compute(const TensorRow &input, TensorRow *output)
     RETURN_STATUS_UNEXPECTED(
       "WordpieceTokenizer: The input shape should be 1D scalar the input datatype should be string.");
   }
-  dsize_t count = 0;
+  bool has_basic_offsets = with_offsets_ && input.size() == 3;
+  if (has_basic_offsets) {
+    CHECK_FAIL_RETURN_UNEXPECTED(input[1]->type() == DataType::DE_UINT32 && input[1]->Size() == input[0]->Size(),
+                                 "WordpieceTokenizer: The offsets should be uint32 with the same size as the input.");
+  }
+  // all words of the tensor are split in one pass into the same output, which usually has a few more items
   std::vector<std::string> out_tokens;
   std::vector<uint32_t> offsets_start, offsets_limit;
-  std::shared_ptr<Tensor> token_tensor;
-  for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); iter++) {
-    uint32_t basic_start = 0;
-    std::vector<std::string> temp_tokens;
-    if (with_offsets_ && input.size() == 3) {
-      RETURN_IF_NOT_OK(input[1]->GetItemAt<uint32_t>(&basic_start, {count}));
-    }
-    RETURN_IF_NOT_OK(GetTokens(std::string(*iter), basic_start, &temp_tokens, &offsets_start, &offsets_limit));
-    out_tokens.insert(out_tokens.end(), temp_tokens.begin(), temp_tokens.end());
-    count++;
+  out_tokens.reserve(input[0]->Size());
+  if (with_offsets_) {
+    offsets_start.reserve(input[0]->Size());
+    offsets_limit.reserve(input[0]->Size());
+  }
+  const uint32_t *basic_start = has_basic_offsets ? &*input[1]->begin<uint32_t>() : nullptr;
+  for (auto iter = input[0]->begin<std::string_view>(); iter != input[0]->end<std::string_view>(); ++iter) {
+    RETURN_IF_NOT_OK(GetTokens(*iter, basic_start == nullptr ? 0 : *basic_start++, &out_tokens, &offsets_start,
+                               &offsets_limit));
   }
   if (out_tokens.empty()) {
     (void)out_tokens.emplace_back("");
     offsets_start.push_back(0);
     offsets_limit.push_back(0);
   }
+  std::shared_ptr<Tensor> token_tensor;
   RETURN_IF_NOT_OK(Tensor::CreateFromVector(out_tokens, &token_tensor));
   output->push_back(token_tensor);
   if (with_offsets_) {
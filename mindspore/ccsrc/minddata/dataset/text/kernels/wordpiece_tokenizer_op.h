@@ -20,16 +20,13 @@
 #include <string_view>
 #include <vector>
 
-#include "cppjieba/Unicode.hpp"
-
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/include/dataset/text.h"
 #include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/text/double_array_trie.h"
 #include "minddata/dataset/text/kernels/tokenizer_op.h"
 #include "minddata/dataset/util/status.h"
 
-using cppjieba::DecodeRunesInString;
-using cppjieba::RuneStrArray;
 namespace mindspore {
 namespace dataset {
 
@@ -47,13 +44,21 @@ class WordpieceTokenizerOp : public TokenizerOp {
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
  protected:
-  Status AddSubword(const std::string &input_token, const int &start, const int &end,
-                    std::vector<std::string> *out_tokens) const;
-  Status FoundNoToken(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
-                      std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
-  Status LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start, bool *out_found,
-                    int *out_end) const;
-  Status GetTokens(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
+  // Replace the subwords of the word added since index first by the unknown token or the word itself
+  void FoundNoToken(std::string_view input_token, const uint32_t &basic_start, size_t first,
+                    std::vector<std::string> *out_tokens, std::vector<uint32_t> *offsets_start,
+                    std::vector<uint32_t> *offsets_limit) const;
+
+  // Find the longest subword in vocab which starts at start and ends at a utf8 char boundary
+  // @param std::string_view input_token - the word
+  // @param int start - the start of the subword, which is prefixed by suffix_indicator_ if it is not 0
+  // @param int *out_end - the end of the subword, or start if there is none
+  // @return Status The status code returned
+  Status LookupWord(std::string_view input_token, const int start, int *out_end) const;
+
+  // Split a word into subwords and append them to the output
+  // @return Status The status code returned
+  Status GetTokens(std::string_view input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
                    std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
 
   std::string Name() const override { return kWordpieceTokenizerOp; }
@@ -63,6 +68,10 @@ class WordpieceTokenizerOp : public TokenizerOp {
   const std::string suffix_indicator_;
   const int max_bytes_per_token_;
   const std::string unknown_token_;
+  // the words of vocab_, built once so a subword is looked up without creating a string for each candidate
+  DoubleArrayTrie trie_;
+  // the node of suffix_indicator_ in trie_, or -1 if no word starts with it
+  int32_t suffix_node_;
 };
 }  // namespace dataset
 }  // namespace mindspore
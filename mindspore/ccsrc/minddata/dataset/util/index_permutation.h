@@ -0,0 +1,117 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_INDEX_PERMUTATION_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_INDEX_PERMUTATION_H_
+
+#include <cstdint>
+
+namespace mindspore {
+namespace dataset {
+/// \brief A seeded random permutation of [0, size) which can be evaluated at any index in O(1), without building the
+///     shuffled list of all indices.
+/// \note The permutation is a balanced Feistel network over the smallest power of 4 not less than size. Indices
+///     which are mapped out of range are mapped again (cycle walking), which is expected to take less than 4 rounds.
+///     It only depends on the seed and the size, so the order of any epoch can be computed from scratch.
+class IndexPermutation {
+ public:
+  IndexPermutation() : IndexPermutation(0, 0) {}
+
+  /// \brief Constructor.
+  /// \param[in] size The number of indices to permute.
+  /// \param[in] seed The seed of the permutation, e.g. the seed of the sampler plus the epoch number.
+  IndexPermutation(int64_t size, uint64_t seed) : size_(size > 0 ? static_cast<uint64_t>(size) : 0), half_bits_(0) {
+    while ((uint64_t(1) << (2 * half_bits_)) < size_) {
+      half_bits_++;
+    }
+    half_mask_ = (uint64_t(1) << half_bits_) - 1;
+    uint64_t state = seed;
+    for (auto &key : keys_) {
+      state += kGoldenGamma;
+      key = Mix(state);
+    }
+  }
+
+  ~IndexPermutation() = default;
+
+  /// \brief Get the number of indices in the permutation.
+  int64_t size() const { return static_cast<int64_t>(size_); }
+
+  /// \brief Get the index at the given position of the permutation.
+  /// \param[in] position The position in [0, size).
+  /// \return The permuted index in [0, size).
+  int64_t operator[](int64_t position) const {
+    uint64_t x = Encrypt(static_cast<uint64_t>(position));
+    while (x >= size_) {
+      x = Encrypt(x);
+    }
+    return static_cast<int64_t>(x);
+  }
+
+  /// \brief Get the position of an index in the permutation, the inverse of operator[].
+  /// \param[in] index The index in [0, size).
+  /// \return The position in [0, size).
+  int64_t Position(int64_t index) const {
+    uint64_t x = Decrypt(static_cast<uint64_t>(index));
+    while (x >= size_) {
+      x = Decrypt(x);
+    }
+    return static_cast<int64_t>(x);
+  }
+
+ private:
+  static constexpr int kRounds = 6;
+  static constexpr uint64_t kGoldenGamma = 0x9E3779B97F4A7C15ULL;
+
+  // The finalizer of splitmix64.
+  static uint64_t Mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+  }
+
+  uint64_t Round(int round, uint64_t half) const { return Mix(keys_[round] ^ half) & half_mask_; }
+
+  uint64_t Encrypt(uint64_t x) const {
+    uint64_t left = x >> half_bits_;
+    uint64_t right = x & half_mask_;
+    for (int i = 0; i < kRounds; i++) {
+      uint64_t next = left ^ Round(i, right);
+      left = right;
+      right = next;
+    }
+    return (left << half_bits_) | right;
+  }
+
+  uint64_t Decrypt(uint64_t x) const {
+    uint64_t left = x >> half_bits_;
+    uint64_t right = x & half_mask_;
+    for (int i = kRounds - 1; i >= 0; i--) {
+      uint64_t prev = right ^ Round(i, left);
+      right = left;
+      left = prev;
+    }
+    return (left << half_bits_) | right;
+  }
+
+  uint64_t size_;
+  uint32_t half_bits_;
+  uint64_t half_mask_;
+  uint64_t keys_[kRounds];
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_INDEX_PERMUTATION_H_
@@ -20,6 +20,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -34,7 +35,10 @@
 
 namespace mindspore {
 namespace dataset {
-// A simple thread safe queue using a fixed size array
+// A simple thread safe queue using a fixed size array.
+// When created in lock free mode the queue must have exactly one producer thread and one consumer thread. Add/PopFront
+// then only publish the atomic tail_/head_ indices and spin for a short while before parking on the condition
+// variables, so the mutex is only taken when one side has to sleep.
 template <typename T>
 class Queue {
  public:
@@ -44,8 +48,15 @@ class Queue {
   using reference = T &;
   using const_reference = const T &;
 
-  explicit Queue(int sz)
-      : sz_(sz), arr_(Services::GetAllocator<T>()), head_(0), tail_(0), my_name_(Services::GetUniqueID()) {
+  explicit Queue(int sz, bool lock_free = false)
+      : sz_(sz),
+        lock_free_(lock_free),
+        arr_(Services::GetAllocator<T>()),
+        head_(0),
+        tail_(0),
+        my_name_(Services::GetUniqueID()),
+        producer_parked_(false),
+        consumer_parked_(false) {
     Status rc = arr_.allocate(sz);
     if (rc.IsError()) {
       MS_LOG(ERROR) << "Fail to create a queue.";
@@ -58,7 +69,9 @@ class Queue {
   virtual ~Queue() { ResetQue(); }
 
   size_t size() const {
-    size_t v = tail_ - head_;
+    // load head_ first, it never passes a later value of tail_
+    size_t h = head_;
+    size_t v = tail_ - h;
     return (v >= 0) ? v : 0;
   }
 
@@ -66,6 +79,8 @@ class Queue {
 
   bool empty() const { return head_ == tail_; }
 
+  bool lock_free() const { return lock_free_; }
+
   void Reset() {
     std::unique_lock<std::mutex> _lock(mux_);
     ResetQue();
@@ -74,6 +89,12 @@ class Queue {
 
   // Producer
   Status Add(const_reference ele) noexcept {
+    if (lock_free_) {
+      RETURN_IF_NOT_OK(WaitForSlotLockFree());
+      *(arr_[tail_ % sz_]) = ele;
+      CommitAddLockFree();
+      return Status::OK();
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
@@ -88,6 +109,12 @@ class Queue {
   }
 
   Status Add(T &&ele) noexcept {
+    if (lock_free_) {
+      RETURN_IF_NOT_OK(WaitForSlotLockFree());
+      *(arr_[tail_ % sz_]) = std::forward<T>(ele);
+      CommitAddLockFree();
+      return Status::OK();
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
@@ -101,8 +128,33 @@ class Queue {
     return rc;
   }
 
+  // Producer which doesn't block. Returns false if the queue is full.
+  bool TryAdd(T &&ele) noexcept {
+    if (lock_free_) {
+      if (size() == capacity()) {
+        return false;
+      }
+      *(arr_[tail_ % sz_]) = std::forward<T>(ele);
+      CommitAddLockFree();
+      return true;
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    if (size() == capacity()) {
+      return false;
+    }
+    (void)AddWhileHoldingLock(std::forward<T>(ele));
+    empty_cv_.NotifyAll();
+    return true;
+  }
+
   template <typename... Ts>
   Status EmplaceBack(Ts &&... args) noexcept {
+    if (lock_free_) {
+      RETURN_IF_NOT_OK(WaitForSlotLockFree());
+      new (arr_[tail_ % sz_]) T(std::forward<Ts>(args)...);
+      CommitAddLockFree();
+      return Status::OK();
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when full
     Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
@@ -119,6 +171,12 @@ class Queue {
 
   // Consumer
   virtual Status PopFront(pointer p) {
+    if (lock_free_) {
+      RETURN_IF_NOT_OK(WaitForElementLockFree());
+      *p = std::move(*(arr_[head_ % sz_]));
+      CommitPopLockFree();
+      return Status::OK();
+    }
     std::unique_lock<std::mutex> _lock(mux_);
     // Block when empty
     Status rc = empty_cv_.Wait(&_lock, [this]() -> bool { return !empty(); });
@@ -143,6 +201,7 @@ class Queue {
   }
 
   Status Resize(int32_t new_capacity) {
+    CHECK_FAIL_RETURN_UNEXPECTED(!lock_free_, "Resize is not supported by a lock free queue.");
     std::unique_lock<std::mutex> _lock(mux_);
     CHECK_FAIL_RETURN_UNEXPECTED(new_capacity > 0,
                                  "New capacity: " + std::to_string(new_capacity) + ", should be larger than 0");
@@ -185,16 +244,76 @@ class Queue {
   }
 
  private:
+  // Number of polls before a lock free producer or consumer parks on its condition variable
+  static constexpr int kSpinCount = 64;
+
   size_t sz_;
+  bool lock_free_;
   MemGuard<T, Allocator<T>> arr_;
   std::vector<T> extra_arr_;  // used to store extra elements after reducing capacity, will not be changed by Add,
                               // will pop when there is a space in queue (by PopFront or Resize)
-  size_t head_;
-  size_t tail_;
+  std::atomic<size_t> head_;
+  std::atomic<size_t> tail_;
   std::string my_name_;
   std::mutex mux_;
   CondVar empty_cv_;
   CondVar full_cv_;
+  std::atomic<bool> producer_parked_;
+  std::atomic<bool> consumer_parked_;
+
+  // Helper functions for the lock free mode. The slot at tail_ belongs to the producer and the slot at head_ belongs
+  // to the consumer until the index is advanced. A thread which parks sets its flag under mux_ before checking the
+  // condition again, and the other side checks the flag after advancing its index. Both use sequentially consistent
+  // atomics, so either the sleeper sees the new index or the waker sees the flag and notifies under mux_.
+  Status WaitForSlotLockFree() {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (size() != capacity()) {
+        return Status::OK();
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    producer_parked_ = true;
+    Status rc = full_cv_.Wait(&_lock, [this]() -> bool { return (size() != capacity()); });
+    producer_parked_ = false;
+    if (rc.IsError()) {
+      empty_cv_.Interrupt();
+    }
+    return rc;
+  }
+
+  void CommitAddLockFree() {
+    ++tail_;
+    if (consumer_parked_) {
+      std::unique_lock<std::mutex> _lock(mux_);
+      empty_cv_.NotifyAll();
+    }
+  }
+
+  Status WaitForElementLockFree() {
+    for (int i = 0; i < kSpinCount; ++i) {
+      if (!empty()) {
+        return Status::OK();
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> _lock(mux_);
+    consumer_parked_ = true;
+    Status rc = empty_cv_.Wait(&_lock, [this]() -> bool { return !empty(); });
+    consumer_parked_ = false;
+    if (rc.IsError()) {
+      full_cv_.Interrupt();
+    }
+    return rc;
+  }
+
+  void CommitPopLockFree() {
+    ++head_;
+    if (producer_parked_) {
+      std::unique_lock<std::mutex> _lock(mux_);
+      full_cv_.NotifyAll();
+    }
+  }
 
   // Helper function for Add, must be called when holding a lock
   Status AddWhileHoldingLock(const_reference ele) {
@@ -241,10 +360,12 @@ class QueueList {
  public:
   QueueList() {}
 
-  void Init(int num_queues, int capacity) {
+  /// \param lock_free - create single-producer single-consumer lock free queues, see Queue
+  void Init(int num_queues, int capacity, bool lock_free = false) {
+    lock_free_ = lock_free;
     (void)queue_list_.reserve(num_queues);
     for (int i = 0; i < num_queues; i++) {
-      (void)queue_list_.emplace_back(std::make_unique<Queue<T>>(capacity));
+      (void)queue_list_.emplace_back(std::make_unique<Queue<T>>(capacity, lock_free_));
     }
   }
 
@@ -267,7 +388,7 @@ class QueueList {
   ~QueueList() = default;
 
   Status AddQueue(TaskGroup *vg) {
-    (void)queue_list_.emplace_back(std::make_unique<Queue<T>>(queue_list_[0]->capacity()));
+    (void)queue_list_.emplace_back(std::make_unique<Queue<T>>(queue_list_[0]->capacity(), lock_free_));
     return queue_list_[queue_list_.size() - 1]->Register(vg);
   }
   Status RemoveLastQueue() {
@@ -281,6 +402,7 @@ class QueueList {
   // requirement that objects must have copy semantics.  To resolve this, we use a vector of unique
   // pointers.  This allows us to provide dynamic creation of queues in a container.
   std::vector<std::unique_ptr<Queue<T>>> queue_list_;
+  bool lock_free_{false};
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/recycling_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+RecyclingPool::~RecyclingPool() {
+  for (auto &item : free_blocks_) {
+    for (auto block : item.second) {
+      FreeBlock(block);
+    }
+  }
+}
+
+void RecyclingPool::FreeBlock(void *block) { free(static_cast<char *>(block) - kHeaderSize); }
+
+size_t RecyclingPool::CachedBytes() {
+  std::unique_lock<std::mutex> lck(mux_);
+  return cached_bytes_;
+}
+
+Status RecyclingPool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  CHECK_FAIL_RETURN_UNEXPECTED(n <= get_max_size(), "RecyclingPool: allocation size is too large.");
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    in_use_bytes_ += n;
+    auto it = free_blocks_.find(n);
+    if (it != free_blocks_.end()) {
+      *p = it->second.back();
+      it->second.pop_back();
+      if (it->second.empty()) {
+        (void)free_blocks_.erase(it);
+      }
+      cached_bytes_ -= n;
+      ++num_recycled_;
+      return Status::OK();
+    }
+  }
+  void *block = nullptr;
+  Status rc = DeMalloc(n + kHeaderSize, &block, false);
+  if (rc.IsError()) {
+    std::unique_lock<std::mutex> lck(mux_);
+    in_use_bytes_ -= n;
+    return rc;
+  }
+  *static_cast<size_t *>(block) = n;
+  *p = static_cast<char *>(block) + kHeaderSize;
+  ++num_malloced_;
+  return Status::OK();
+}
+
+Status RecyclingPool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (old_sz >= new_sz) {
+    // Do nothing if we shrink.
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  errno_t err = memcpy_s(q, new_sz, *p, old_sz);
+  if (err != EOK) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED("RecyclingPool: memcpy failed, error code: " + std::to_string(err));
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void RecyclingPool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  size_t n = *reinterpret_cast<size_t *>(static_cast<char *>(p) - kHeaderSize);
+  std::vector<void *> dropped;
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    in_use_bytes_ -= n;
+    const size_t limit = std::max(in_use_bytes_, n);
+    // make room by dropping blocks of other sizes
+    for (auto it = free_blocks_.begin(); it != free_blocks_.end() && cached_bytes_ + n > limit;) {
+      if (it->first == n) {
+        ++it;
+        continue;
+      }
+      while (!it->second.empty() && cached_bytes_ + n > limit) {
+        dropped.push_back(it->second.back());
+        it->second.pop_back();
+        cached_bytes_ -= it->first;
+      }
+      it = it->second.empty() ? free_blocks_.erase(it) : std::next(it);
+    }
+    if (cached_bytes_ + n <= limit) {
+      free_blocks_[n].push_back(p);
+      cached_bytes_ += n;
+      p = nullptr;
+    }
+  }
+  // free outside of the lock, releasing large blocks can be slow
+  for (auto block : dropped) {
+    FreeBlock(block);
+  }
+  if (p != nullptr) {
+    FreeBlock(p);
+  }
+}
+
+uint64_t RecyclingPool::get_max_size() const { return std::numeric_limits<size_t>::max() - kHeaderSize; }
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLING_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLING_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A memory pool which keeps released blocks and hands them out again to allocations of the same size. It suits
+// buffers of a few recurring sizes which are released by other threads, e.g. the batched tensors of a BatchOp which
+// are freed after the consumer has sent them. A released block is only kept while the kept bytes stay within the
+// bytes still in use (or the size of the block itself), so the pool holds at most about as much memory as the
+// pipeline has in flight. Blocks of other sizes are dropped first when a block does not fit, which lets pipelines
+// whose buffer sizes change follow the new sizes.
+class RecyclingPool : public MemoryPool {
+ public:
+  RecyclingPool() = default;
+
+  RecyclingPool(const RecyclingPool &) = delete;
+
+  RecyclingPool &operator=(const RecyclingPool &) = delete;
+
+  ~RecyclingPool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override { return 100; }
+
+  // Number of allocations which were served by a released block
+  int64_t NumRecycled() const { return num_recycled_; }
+
+  // Number of allocations which had to go to malloc
+  int64_t NumMalloced() const { return num_malloced_; }
+
+  // Number of bytes kept in released blocks
+  size_t CachedBytes();
+
+ private:
+  // Every block starts with a header holding the requested size. Its size keeps the alignment given by malloc.
+  static constexpr size_t kHeaderSize = 64;
+
+  static void FreeBlock(void *block);
+
+  std::mutex mux_;
+  std::unordered_map<size_t, std::vector<void *>> free_blocks_;  // released blocks by size
+  size_t cached_bytes_{0};                                        // bytes in free_blocks_
+  size_t in_use_bytes_{0};                                        // bytes handed out and not released yet
+  std::atomic<int64_t> num_recycled_{0};
+  std::atomic<int64_t> num_malloced_{0};
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLING_POOL_H_
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+const char kColumnarIndexExtension[] = ".idx";
+
+/// \brief Columnar copy of the INDEXES table of one shard.
+///
+/// The offset columns (ROW_ID, ROW_GROUP_ID, PAGE_ID_RAW, ...) are stored as fixed width arrays sorted by ROW_ID and
+/// the index fields are stored as length-delimited text columns, so the whole index can be loaded with a single read
+/// instead of running sql statements against the meta file.
+class MINDRECORD_API ShardColumnarIndex {
+ public:
+  ShardColumnarIndex() = default;
+
+  ~ShardColumnarIndex() = default;
+
+  /// \brief append one row of the INDEXES table
+  /// \param[in] row_data tuples of (place holder, sql type, value) which are bound to the insert statement
+  /// \return Status
+  Status AddRow(const std::vector<std::tuple<std::string, std::string, std::string>> &row_data);
+
+  /// \brief sort rows by ROW_ID and write the index next to the mindrecord file
+  /// \param[in] shard_address path of the mindrecord file
+  /// \return Status
+  Status WriteToFile(const std::string &shard_address);
+
+  /// \brief load the index of a mindrecord file
+  /// \param[in] shard_address path of the mindrecord file
+  /// \param[out] index_ptr the loaded index, nullptr if there is no index or it is stale, then the meta file is used
+  /// \return Status, error if the index belongs to a mindrecord file of another name
+  static Status Load(const std::string &shard_address, std::shared_ptr<ShardColumnarIndex> *index_ptr);
+
+  /// \brief select columns of the rows which fulfill all criteria, values are formatted as they are returned by sqlite
+  /// \param[in] columns column names in the INDEXES table
+  /// \param[in] criteria column-value pairs which must be equal
+  /// \param[out] rows selected rows in ROW_ID order
+  /// \return Status
+  Status Select(const std::vector<std::string> &columns,
+                const std::vector<std::pair<std::string, std::string>> &criteria,
+                std::vector<std::vector<std::string>> *rows) const;
+
+  /// \brief get the number of rows in the index
+  uint64_t GetRowCount() const { return row_count_; }
+
+ private:
+  struct TextColumn {
+    bool numeric = false;           // compare by value instead of by text
+    std::vector<uint64_t> offsets;  // offsets[i] is the start of row i in data, offsets[row_count] is the end
+    std::string data;               // concatenated values
+  };
+
+  std::string GetText(const TextColumn &column, uint64_t row) const;
+
+  bool Match(const std::string &column, const std::string &value, uint64_t row) const;
+
+  uint64_t row_count_ = 0;
+  uint64_t shard_size_ = 0;  // size of the mindrecord file when the index was built
+  std::map<std::string, std::vector<uint64_t>> int_columns_;
+  std::map<std::string, TextColumn> text_columns_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
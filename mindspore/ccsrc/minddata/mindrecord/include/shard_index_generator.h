@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_INDEX_GENERATOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_INDEX_GENERATOR_H_
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -25,6 +26,7 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "./sqlite3.h"
 
@@ -67,7 +69,19 @@ class MINDRECORD_API ShardIndexGenerator {
 
   static std::string ConvertJsonToSQL(const std::string &json);
 
-  Status CreateDatabase(int shard_no, sqlite3 **db);
+  Status CreateDatabase(int shard_no, sqlite3 **db, int *indexed_raw_page);
+
+  /// \brief get the last raw page which is indexed in the meta file of a shard that rows are appended to
+  /// \param[in] db meta file of the shard
+  /// \param[out] raw_page_id -1 if the shard has to be indexed from scratch
+  /// \return Status
+  Status GetIndexedRawPage(sqlite3 *db, int *raw_page_id);
+
+  /// \brief select one column of a query, NULL is returned as empty string
+  static Status SelectColumn(sqlite3 *db, const std::string &sql, int column, std::vector<std::string> *values);
+
+  /// \brief load the INDEXES table of the meta file into its columnar copy
+  Status LoadColumnarIndex(sqlite3 *db, ShardColumnarIndex *columnar_index);
 
   Status GetSchemaDetails(const std::vector<uint64_t> &schema_lens, std::fstream &in,
                           std::shared_ptr<std::vector<json>> *detail_ptr);
@@ -94,8 +108,10 @@ class MINDRECORD_API ShardIndexGenerator {
 
   Status GenerateIndexFields(const std::vector<json> &schema_detail, std::shared_ptr<INDEX_FIELDS> *index_fields_ptr);
 
+  /// \brief insert the rows of raw pages, the next pages are read from the mindrecord file in background
+  /// \param[in] indexed_raw_page rows from this raw page on are replaced, -1 if the table is new
   Status ExecuteTransaction(const int &shard_no, sqlite3 *db, const std::vector<int> &raw_page_ids,
-                            const std::map<int, int> &blob_id_to_page_id);
+                            const std::map<int, int> &blob_id_to_page_id, int indexed_raw_page);
 
   Status CreateShardNameTable(sqlite3 *db, const std::string &shard_name);
 
@@ -21,6 +21,9 @@
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
 #include <sys/prctl.h>
 #endif
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <algorithm>
@@ -44,6 +47,7 @@
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_category.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
@@ -187,6 +191,11 @@ class MINDRECORD_API ShardReader {
   /// \return null
   void SetAllInIndex(bool all_in_index) { all_in_index_ = all_in_index; }
 
+  /// \brief set flag of mmap read mode, must be called before Open
+  /// \param[in] use_mmap map each shard file once and read blob data from the mapped region
+  /// \return null
+  void SetMmapRead(bool use_mmap) { use_mmap_ = use_mmap; }
+
   /// \brief get all classes
   Status GetAllClasses(const std::string &category_field, std::shared_ptr<std::set<std::string>> category_ptr);
 
@@ -204,6 +213,9 @@ class MINDRECORD_API ShardReader {
   /// \brief sqlite call back function
   static int SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names);
 
+  /// \brief open the meta files of the shards read from their columnar index, for queries the index can not answer
+  Status OpenMetaFiles();
+
  private:
   /// \brief wrap up labels to json format
   Status ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels, std::shared_ptr<std::fstream> fs,
@@ -222,11 +234,23 @@ class MINDRECORD_API ShardReader {
   Status ReadRowGroupByShardIDAndSampleID(const std::vector<std::string> &columns, const uint32_t &shard_id,
                                           const uint32_t &sample_id, std::shared_ptr<ROW_GROUPS> *row_group_ptr);
 
-  /// \brief read all rows in one shard
-  Status ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+  /// \brief read all rows in one shard, from columnar index if exists, otherwise from meta file by sql
+  Status ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &fields,
+                            const std::vector<std::pair<std::string, std::string>> &criteria,
+                            const std::vector<std::string> &columns,
                             std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                             std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
 
+  /// \brief get the index fields to be read for specified columns
+  Status GetIndexFields(const std::vector<std::string> &columns, std::vector<std::string> *fields);
+
+  /// \brief join index fields to the select list of sql
+  static std::string JoinIndexFields(const std::vector<std::string> &fields);
+
+  /// \brief convert page id and category criteria to the criteria of columnar index
+  std::vector<std::pair<std::string, std::string>> GetIndexCriteria(int page_id,
+                                                                    const std::pair<std::string, std::string> &criteria);
+
   /// \brief initialize reader
   Status Init(const std::vector<std::string> &file_paths, bool load_dataset);
 
@@ -279,6 +303,16 @@ class MINDRECORD_API ShardReader {
   /// \brief open multiple file handle
   void FileStreamsOperator();
 
+  /// \brief map all shard files into memory for mmap read mode
+  Status MapShardFiles();
+
+  /// \brief unmap all shard files mapped by MapShardFiles
+  void UnmapShardFiles();
+
+  /// \brief copy blob data of one task from file stream or mapped region
+  Status ReadBlob(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                  std::vector<uint8_t> *images);
+
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
@@ -288,7 +322,7 @@ class MINDRECORD_API ShardReader {
                                  std::shared_ptr<std::vector<json>> *labels_ptr);
 
   /// \brief get classes in one shard
-  void GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
+  void GetClassesInShard(sqlite3 *db, int shard_id, const std::string &field,
                          std::shared_ptr<std::set<std::string>> category_ptr);
 
   /// \brief get number of classes
@@ -306,9 +340,11 @@ class MINDRECORD_API ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::shared_ptr<ShardColumnarIndex>> columnar_indexes_;            // columnar index list
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::pair<uint8_t *, uint64_t>> mapped_files_;                     // mapped address and size per shard
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -321,6 +357,7 @@ class MINDRECORD_API ShardReader {
   // flags
   bool all_in_index_ = true;  // if all columns are stored in index-table
   bool interrupt_ = false;    // reader interrupted
+  bool use_mmap_ = false;     // read blob data from mapped shard files
 
   int64_t num_padded_;  // number of padding samples
 
@@ -18,6 +18,8 @@
 #define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_SHUFFLE_H_
 
 #include <random>
+#include <vector>
+
 #include "minddata/mindrecord/include/shard_operator.h"
 
 namespace mindspore {
@@ -35,6 +37,11 @@ class MINDRECORD_API ShardShuffle : public ShardOperator {
 
   int64_t GetNumSamples(int64_t dataset_size, int64_t num_classes) override;
 
+  /// \brief Shuffle the samples of every epoch with a seekable permutation of the samples of the first epoch, so
+  ///     that the order of any epoch only depends on the seed and the epoch number
+  /// \param[in] start_epoch The number of epochs to skip, e.g. when the pipeline is reset to a step
+  void SetSeekable(int64_t start_epoch);
+
  private:
   // Private helper function
   Status CategoryShuffle(ShardTaskList &tasks);  // NOLINT
@@ -45,11 +52,16 @@ class MINDRECORD_API ShardShuffle : public ShardOperator {
   // Shuffle the file sequence but keep the order of data within each file
   Status ShuffleFiles(ShardTaskList &tasks);  // NOLINT
 
+  // Shuffle the samples of the first epoch with a permutation which is computed from the seed
+  Status SeekableShuffle(ShardTaskList &tasks);  // NOLINT
+
   uint32_t shuffle_seed_;
   int64_t no_of_samples_;
   bool replacement_;
   bool reshuffle_each_epoch_;
   ShuffleType shuffle_type_;
+  bool seekable_;
+  std::vector<int64_t> first_epoch_sample_ids_;  // sample ids before the first shuffle, only used if seekable
 };
 }  // namespace mindrecord
 }  // namespace mindspore
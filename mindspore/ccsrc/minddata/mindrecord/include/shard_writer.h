@@ -40,6 +40,7 @@
 #include "minddata/mindrecord/include/common/log_adapter.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "minddata/mindrecord/include/shard_index.h"
@@ -215,6 +216,9 @@ class MINDRECORD_API ShardWriter {
   /// \brief Unlock writer and save pages info
   Status UnlockWriter(int fd, bool parallel_writer = false);
 
+  /// \brief compress the int32/int64 columns of blob data with multi threads
+  Status CompressBlobData(std::vector<std::vector<uint8_t>> &blob_data);  // NOLINT
+
   /// \brief Check raw data before writing
   Status WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &raw_data,  // NOLINT
                               vector<vector<uint8_t>> &blob_data,               // NOLINT
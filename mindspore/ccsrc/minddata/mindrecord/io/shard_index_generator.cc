@@ -15,11 +15,24 @@
  */
 #include "minddata/mindrecord/include/shard_index_generator.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace mindrecord {
+namespace {
+// raw pages which are read ahead of the sqlite insert
+const size_t kIndexPrefetchPages = 8;
+const std::vector<std::string> kIndexOffsetColumns = {"ROW_ID",           "ROW_GROUP_ID",        "PAGE_ID_RAW",
+                                                      "PAGE_OFFSET_RAW",  "PAGE_OFFSET_RAW_END", "PAGE_ID_BLOB",
+                                                      "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
+}  // namespace
+
 ShardIndexGenerator::ShardIndexGenerator(const std::string &file_path, bool append)
     : file_path_(file_path),
       append_(append),
@@ -228,12 +241,124 @@ Status ShardIndexGenerator::CreateShardNameTable(sqlite3 *db, const std::string
   return Status::OK();
 }
 
-Status ShardIndexGenerator::CreateDatabase(int shard_no, sqlite3 **db) {
+Status ShardIndexGenerator::SelectColumn(sqlite3 *db, const std::string &sql, int column,
+                                         std::vector<std::string> *values) {
+  RETURN_UNEXPECTED_IF_NULL_MR(values);
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, common::SafeCStr(sql), -1, &stmt, 0) != SQLITE_OK) {
+    if (stmt != nullptr) {
+      (void)sqlite3_finalize(stmt);
+    }
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to prepare statement [ " + sql + " ].");
+  }
+  int rc = sqlite3_step(stmt);
+  while (rc == SQLITE_ROW) {
+    auto text = sqlite3_column_text(stmt, column);
+    values->emplace_back(text == nullptr ? "" : reinterpret_cast<const char *>(text));
+    rc = sqlite3_step(stmt);
+  }
+  (void)sqlite3_finalize(stmt);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(rc == SQLITE_DONE, "[Internal ERROR] Failed to step execute stmt [ " + sql + " ].");
+  return Status::OK();
+}
+
+Status ShardIndexGenerator::GetIndexedRawPage(sqlite3 *db, int *raw_page_id) {
+  RETURN_UNEXPECTED_IF_NULL_MR(raw_page_id);
+  *raw_page_id = -1;
+  // the table is rebuilt if it is missing or was created for other index fields
+  std::vector<std::string> columns;
+  RETURN_IF_NOT_OK_MR(SelectColumn(db, "PRAGMA table_info(INDEXES);", 1, &columns));
+  if (columns.size() != kIndexOffsetColumns.size() + 2 * fields_.size()) {
+    return Status::OK();
+  }
+  for (const auto &field : fields_) {
+    std::shared_ptr<std::string> fn_ptr;
+    RETURN_IF_NOT_OK_MR(GenerateFieldName(field, &fn_ptr));
+    if (std::find(columns.begin(), columns.end(), *fn_ptr) == columns.end()) {
+      return Status::OK();
+    }
+  }
+  std::vector<std::string> max_page;
+  RETURN_IF_NOT_OK_MR(SelectColumn(db, "SELECT IFNULL(MAX(PAGE_ID_RAW), -1) FROM INDEXES;", 0, &max_page));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(max_page.size() == 1, "[Internal ERROR] Failed to get the last indexed raw page.");
+  try {
+    *raw_page_id = std::stoi(max_page[0]);
+  } catch (std::exception &e) {
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Invalid raw page id in mindrecord meta file: " + max_page[0]);
+  }
+  return Status::OK();
+}
+
+Status ShardIndexGenerator::LoadColumnarIndex(sqlite3 *db, ShardColumnarIndex *columnar_index) {
+  RETURN_UNEXPECTED_IF_NULL_MR(columnar_index);
+  // pair: column name, sql type
+  std::vector<std::pair<std::string, std::string>> columns;
+  for (const auto &column : kIndexOffsetColumns) {
+    columns.emplace_back(column, "INTEGER");
+  }
+  for (const auto &field : fields_) {
+    std::shared_ptr<Schema> schema_ptr;
+    RETURN_IF_NOT_OK_MR(shard_header_.GetSchemaByID(field.first, &schema_ptr));
+    json json_schema = schema_ptr->GetSchema()["schema"];
+    std::shared_ptr<std::string> fn_ptr;
+    RETURN_IF_NOT_OK_MR(GenerateFieldName(field, &fn_ptr));
+    columns.emplace_back(*fn_ptr, ConvertJsonToSQL(TakeFieldType(field.second, json_schema)));
+  }
+  std::string sql = "SELECT ";
+  for (size_t i = 0; i < columns.size(); ++i) {
+    sql += (i == 0 ? "" : ",") + columns[i].first;
+  }
+  sql += " FROM INDEXES ORDER BY ROW_ID;";
+
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(db, common::SafeCStr(sql), -1, &stmt, 0) != SQLITE_OK) {
+    if (stmt != nullptr) {
+      (void)sqlite3_finalize(stmt);
+    }
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to prepare statement [ " + sql + " ].");
+  }
+  int rc = sqlite3_step(stmt);
+  while (rc == SQLITE_ROW) {
+    std::vector<std::tuple<std::string, std::string, std::string>> row_data;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (sqlite3_column_type(stmt, static_cast<int>(i)) == SQLITE_NULL) {
+        row_data.emplace_back(":" + columns[i].first, "NULL", "");
+      } else {
+        auto text = reinterpret_cast<const char *>(sqlite3_column_text(stmt, static_cast<int>(i)));
+        row_data.emplace_back(":" + columns[i].first, columns[i].second, text == nullptr ? "" : text);
+      }
+    }
+    Status status = columnar_index->AddRow(row_data);
+    if (status.IsError()) {
+      (void)sqlite3_finalize(stmt);
+      return status;
+    }
+    rc = sqlite3_step(stmt);
+  }
+  (void)sqlite3_finalize(stmt);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(rc == SQLITE_DONE, "[Internal ERROR] Failed to step execute stmt [ " + sql + " ].");
+  return Status::OK();
+}
+
+Status ShardIndexGenerator::CreateDatabase(int shard_no, sqlite3 **db, int *indexed_raw_page) {
+  RETURN_UNEXPECTED_IF_NULL_MR(indexed_raw_page);
+  *indexed_raw_page = -1;
   std::string shard_address = shard_header_.GetShardAddressByID(shard_no);
   std::shared_ptr<std::string> fn_ptr;
   RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr));
   shard_address += ".db";
   RETURN_IF_NOT_OK_MR(CheckDatabase(shard_address, db));
+  if (append_) {
+    // keep the rows of the pages which are not touched by appending
+    Status rc = GetIndexedRawPage(*db, indexed_raw_page);
+    if (rc.IsError()) {
+      sqlite3_close(*db);
+      return rc;
+    }
+    if (*indexed_raw_page >= 0) {
+      return Status::OK();
+    }
+  }
   std::string sql = "DROP TABLE IF EXISTS INDEXES;";
   RETURN_IF_NOT_OK_MR(ExecuteSQL(sql, *db, "drop table successfully."));
   sql =
@@ -494,7 +619,7 @@ Status ShardIndexGenerator::GenerateIndexFields(const std::vector<json> &schema_
 }
 
 Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db, const std::vector<int> &raw_page_ids,
-                                               const std::map<int, int> &blob_id_to_page_id) {
+                                               const std::map<int, int> &blob_id_to_page_id, int indexed_raw_page) {
   // Add index data to database
   std::string shard_address = shard_header_.GetShardAddressByID(shard_no);
 
@@ -511,19 +636,89 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
       "-a): " +
       shard_address);
   }
+  std::shared_ptr<std::string> sql_ptr;
+  RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRawSQL(fields_, &sql_ptr), db, in);
+
+  // The rows of the next raw pages are read from the mindrecord file while the current page is inserted
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<std::shared_ptr<ROW_DATA>> row_data_queue;
+  Status read_status = Status::OK();
+  bool read_done = false;
+  bool stop_read = false;
+  std::thread reader([&]() {
+    for (int raw_page_id : raw_page_ids) {
+      auto row_data_ptr = std::make_shared<ROW_DATA>();
+      Status rc = GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in, &row_data_ptr);
+      std::unique_lock<std::mutex> lock(mtx);
+      if (rc.IsError()) {
+        read_status = rc;
+        break;
+      }
+      cv.wait(lock, [&]() { return stop_read || row_data_queue.size() < kIndexPrefetchPages; });
+      if (stop_read) {
+        break;
+      }
+      row_data_queue.push_back(std::move(row_data_ptr));
+      cv.notify_all();
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    read_done = true;
+    cv.notify_all();
+  });
+
+  ShardColumnarIndex columnar_index;
+  Status rc = Status::OK();
   (void)sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
-  for (int raw_page_id : raw_page_ids) {
-    std::shared_ptr<std::string> sql_ptr;
-    RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRawSQL(fields_, &sql_ptr), db, in);
-    auto row_data_ptr = std::make_shared<ROW_DATA>();
-    RELEASE_AND_RETURN_IF_NOT_OK_MR(GenerateRowData(shard_no, blob_id_to_page_id, raw_page_id, in, &row_data_ptr), db,
-                                    in);
-    RELEASE_AND_RETURN_IF_NOT_OK_MR(BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr), db, in);
+  if (indexed_raw_page >= 0) {
+    // Appending only adds pages behind the indexed ones and may move the last row group of the last raw page to a new
+    // raw page, so the rows from the last indexed raw page on are indexed again
+    std::string sql = "DELETE FROM INDEXES WHERE PAGE_ID_RAW >= " + std::to_string(indexed_raw_page) + ";";
+    char *z_err_msg = nullptr;
+    if (sqlite3_exec(db, common::SafeCStr(sql), nullptr, nullptr, &z_err_msg) != SQLITE_OK) {
+      rc = STATUS_ERROR_MR(StatusCode::kMDUnexpectedError, "[Internal ERROR] Failed to execute the sql [ " + sql +
+                                                             " ], " + (z_err_msg ? z_err_msg : ""));
+    }
+    sqlite3_free(z_err_msg);
+  }
+  while (rc.IsOk()) {
+    std::shared_ptr<ROW_DATA> row_data_ptr;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [&]() { return read_done || !row_data_queue.empty(); });
+      if (row_data_queue.empty()) {
+        break;
+      }
+      row_data_ptr = std::move(row_data_queue.front());
+      row_data_queue.pop_front();
+      cv.notify_all();
+    }
+    rc = BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr);
+    if (indexed_raw_page < 0) {
+      for (size_t i = 0; rc.IsOk() && i < row_data_ptr->size(); ++i) {
+        rc = columnar_index.AddRow((*row_data_ptr)[i]);
+      }
+    }
     MS_LOG(INFO) << "Insert " << row_data_ptr->size() << " rows to index db.";
   }
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    stop_read = true;
+    cv.notify_all();
+  }
+  reader.join();
+  RELEASE_AND_RETURN_IF_NOT_OK_MR(rc, db, in);
+  RELEASE_AND_RETURN_IF_NOT_OK_MR(read_status, db, in);
   (void)sqlite3_exec(db, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
 
+  if (indexed_raw_page >= 0) {
+    // The kept rows are not read from the mindrecord file, so the columnar copy is loaded from the meta file
+    RELEASE_AND_RETURN_IF_NOT_OK_MR(LoadColumnarIndex(db, &columnar_index), db, in);
+  }
+  // Write the columnar copy of the index which is used by reader instead of sql queries
+  RELEASE_AND_RETURN_IF_NOT_OK_MR(columnar_index.WriteToFile(shard_address), db, in);
+
   // Close database
   sqlite3_close(db);
   db = nullptr;
@@ -564,7 +759,8 @@ void ShardIndexGenerator::DatabaseWriter() {
   int shard_no = task_++;
   while (shard_no < shard_header_.GetShardCount()) {
     sqlite3 *db = nullptr;
-    if (CreateDatabase(shard_no, &db).IsError()) {
+    int indexed_raw_page = -1;
+    if (CreateDatabase(shard_no, &db, &indexed_raw_page).IsError()) {
       write_success_ = false;
       return;
     }
@@ -581,13 +777,15 @@ void ShardIndexGenerator::DatabaseWriter() {
         return;
       }
       if (page_ptr->GetPageType() == "RAW_DATA") {
-        raw_page_ids.push_back(i);
+        if (static_cast<int64_t>(i) >= indexed_raw_page) {
+          raw_page_ids.push_back(i);
+        }
       } else if (page_ptr->GetPageType() == "BLOB_DATA") {
         blob_id_to_page_id[page_ptr->GetPageTypeID()] = i;
       }
     }
 
-    if (ExecuteTransaction(shard_no, db, raw_page_ids, blob_id_to_page_id).IsError()) {
+    if (ExecuteTransaction(shard_no, db, raw_page_ids, blob_id_to_page_id, indexed_raw_page).IsError()) {
       write_success_ = false;
       return;
     }
@@ -16,6 +16,9 @@
 
 #include "minddata/mindrecord/include/shard_reader.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <algorithm>
 #include <thread>
 
@@ -83,8 +86,19 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
       *meta_data_ptr == *first_meta_data_ptr,
       "Invalid file, the metadata of mindrecord file: " + file +
         " is different from others, please make sure all the mindrecord files generated by the same script.");
+    std::shared_ptr<ShardColumnarIndex> columnar_index;
+    RETURN_IF_NOT_OK_MR(ShardColumnarIndex::Load(file, &columnar_index));
+    columnar_indexes_.push_back(columnar_index);
+    // the meta file is only opened when there is no index to read from
     sqlite3 *db = nullptr;
-    RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    if (columnar_index == nullptr) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    } else {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(FileUtils::GetRealPath((file + ".db").c_str()).has_value(),
+                                      "Invalid file, failed to open mindrecord meta file. Please check whether the "
+                                      "meta file: " +
+                                        file + ".db exists and do not rename the mindrecord file and meta file.");
+    }
     database_paths_.push_back(db);
   }
   ShardHeader sh = ShardHeader();
@@ -130,6 +144,15 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
   return Status::OK();
 }
 
+Status ShardReader::OpenMetaFiles() {
+  for (size_t i = 0; i < database_paths_.size(); ++i) {
+    if (database_paths_[i] == nullptr) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&database_paths_[i], file_paths_[i]));
+    }
+  }
+  return Status::OK();
+}
+
 Status ShardReader::VerifyDataset(sqlite3 **db, const string &file) {
   std::string path_utf8 = "";
 #if defined(_WIN32) || defined(_WIN64)
@@ -183,6 +206,16 @@ Status ShardReader::CheckColumnList(const std::vector<std::string> &selected_col
 Status ShardReader::Open(int n_consumer) {
   file_streams_random_ =
     std::vector<std::vector<std::shared_ptr<std::fstream>>>(n_consumer, std::vector<std::shared_ptr<std::fstream>>());
+#if defined(_WIN32) || defined(_WIN64)
+  if (use_mmap_) {
+    MS_LOG(WARNING) << "Mmap read mode is not supported on Windows, fall back to file stream read mode.";
+    use_mmap_ = false;
+  }
+#endif
+  if (use_mmap_) {
+    // all consumers share one mapping per shard, so no per-consumer file stream is needed
+    return MapShardFiles();
+  }
   for (const auto &file : file_paths_) {
     for (int j = 0; j < n_consumer; ++j) {
       std::optional<std::string> dir = "";
@@ -232,7 +265,9 @@ Status ShardReader::ExtendRandomFileStreams(const int n_new_consumers) {
     (void)file_streams_random_.emplace_back(std::vector<std::shared_ptr<std::fstream>>());
   }
 
-  for (const auto &file : file_paths_) {
+  // in mmap read mode the new consumers share the existing mappings
+  const std::vector<std::string> &files_to_open = use_mmap_ ? std::vector<std::string>() : file_paths_;
+  for (const auto &file : files_to_open) {
     std::optional<std::string> dir = "";
     std::optional<std::string> local_file_name = "";
     FileUtils::SplitDirAndFileName(file, &dir, &local_file_name);
@@ -294,6 +329,81 @@ Status ShardReader::ShrinkRandomFileStreams(const int n_remove_consumers) {
   return Status::OK();
 }
 
+Status ShardReader::MapShardFiles() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  bool random_access = std::any_of(operators_.begin(), operators_.end(), [](const std::shared_ptr<ShardOperator> &op) {
+    return std::dynamic_pointer_cast<ShardShuffle>(op) != nullptr;
+  });
+  for (const auto &file : file_paths_) {
+    auto realpath = FileUtils::GetRealPath(file.c_str());
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      realpath.has_value(), "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file);
+
+    int fd = ::open(realpath.value().c_str(), O_RDONLY);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0,
+                                    "Invalid file, failed to open files for reading mindrecord files. Please check file "
+                                    "path, permission and open files limit(ulimit -a): " +
+                                      file);
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      (void)::close(fd);
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the size of mindrecord file: " + file);
+    }
+    auto file_size = static_cast<uint64_t>(file_stat.st_size);
+    void *addr = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping holds its own reference to the file, so the descriptor can be released right away
+    (void)::close(fd);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "[Internal ERROR] Failed to mmap mindrecord file: " + file);
+    // shuffled reads jump between pages, so kernel readahead would only pollute the page cache
+    if (madvise(addr, file_size, random_access ? MADV_RANDOM : MADV_SEQUENTIAL) != 0) {
+      MS_LOG(WARNING) << "Failed to set readahead hint for mindrecord file: " << file;
+    }
+    (void)mapped_files_.emplace_back(static_cast<uint8_t *>(addr), file_size);
+    MS_LOG(INFO) << "Succeed to map file, path: " << file;
+  }
+#endif
+  return Status::OK();
+}
+
+void ShardReader::UnmapShardFiles() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (auto &mapped_file : mapped_files_) {
+    if (mapped_file.first != nullptr && munmap(mapped_file.first, mapped_file.second) != 0) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to unmap mindrecord file.";
+    }
+  }
+#endif
+  mapped_files_.clear();
+}
+
+Status ShardReader::ReadBlob(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t blob_size,
+                             std::vector<uint8_t> *images) {
+  RETURN_UNEXPECTED_IF_NULL_MR(images);
+  if (use_mmap_) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id < mapped_files_.size(),
+                                    "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) +
+                                      " is out of bound: " + std::to_string(mapped_files_.size()));
+    const auto &mapped_file = mapped_files_[shard_id];
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(file_offset + blob_size <= mapped_file.second,
+                                    "[Internal ERROR] Blob data exceeds the size of mindrecord file.");
+    images->assign(mapped_file.first + file_offset, mapped_file.first + file_offset + blob_size);
+    return Status::OK();
+  }
+
+  images->resize(blob_size);
+  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    file_streams_random_[consumer_id][shard_id]->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+  }
+  auto &io_read = file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(images->data()), blob_size);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    file_streams_random_[consumer_id][shard_id]->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+  }
+  return Status::OK();
+}
+
 void ShardReader::FileStreamsOperator() {
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; --i) {
     if (file_streams_[i] != nullptr) {
@@ -307,6 +417,7 @@ void ShardReader::FileStreamsOperator() {
       }
     }
   }
+  UnmapShardFiles();
   for (int i = static_cast<int>(database_paths_.size()) - 1; i >= 0; --i) {
     if (database_paths_[i] != nullptr) {
       auto ret = sqlite3_close(database_paths_[i]);
@@ -466,20 +577,26 @@ Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, cons
   }
   return Status::OK();
 }
-Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &fields,
+                                       const std::vector<std::pair<std::string, std::string>> &criteria,
+                                       const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
   auto db = database_paths_[shard_id];
   std::vector<std::vector<std::string>> labels;
   char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
-  if (rc != SQLITE_OK) {
-    std::ostringstream oss;
-    oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
-    sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    RETURN_STATUS_UNEXPECTED_MR(oss.str());
+  if (columnar_indexes_[shard_id] != nullptr) {
+    RETURN_IF_NOT_OK_MR(columnar_indexes_[shard_id]->Select(fields, criteria, &labels));
+  } else {
+    int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
+    if (rc != SQLITE_OK) {
+      std::ostringstream oss;
+      oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
+      sqlite3_free(errmsg);
+      sqlite3_close(db);
+      db = nullptr;
+      RETURN_STATUS_UNEXPECTED_MR(oss.str());
+    }
   }
   MS_LOG(INFO) << "Succeed to get " << labels.size() << " records from shard " << std::to_string(shard_id) << " index.";
 
@@ -521,10 +638,9 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   std::shared_ptr<std::string> fn_ptr;
   RETURN_IF_NOT_OK_MR(
     ShardIndexGenerator::GenerateFieldName(std::make_pair(index_columns[category_field], category_field), &fn_ptr));
-  std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, category_ptr);
+    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, *fn_ptr, category_ptr);
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -533,12 +649,25 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   return Status::OK();
 }
 
-void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
+void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &field,
                                     std::shared_ptr<std::set<std::string>> category_ptr) {
+  std::vector<std::vector<std::string>> columns;
+  if (static_cast<size_t>(shard_id) < columnar_indexes_.size() && columnar_indexes_[shard_id] != nullptr) {
+    auto rc = columnar_indexes_[shard_id]->Select({field}, {}, &columns);
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to get classes from index, " << rc.ToString();
+      return;
+    }
+    std::lock_guard<std::mutex> lck(shard_locker_);
+    for (const auto &column : columns) {
+      category_ptr->emplace(column[0]);
+    }
+    return;
+  }
   if (db == nullptr) {
     return;
   }
-  std::vector<std::vector<std::string>> columns;
+  std::string sql = "SELECT DISTINCT " + field + " FROM INDEXES";
   char *errmsg = nullptr;
   int ret = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &columns, &errmsg);
   if (ret != SQLITE_OK) {
@@ -558,31 +687,49 @@ void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string
   sqlite3_free(errmsg);
 }
 
-Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
-                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
-  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
-    shard_count_, std::vector<std::vector<uint64_t>>{});
-  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
-
+Status ShardReader::GetIndexFields(const std::vector<std::string> &columns, std::vector<std::string> *fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(fields);
+  *fields = {"ROW_GROUP_ID", "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
   if (all_in_index_) {
     for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
       std::shared_ptr<std::string> fn_ptr;
       RETURN_IF_NOT_OK_MR(
         ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
+      fields->push_back(*fn_ptr);
     }
   } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
+    fields->insert(fields->end(), {"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"});
   }
+  return Status::OK();
+}
 
-  std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
+std::string ShardReader::JoinIndexFields(const std::vector<std::string> &fields) {
+  std::string joined_fields;
+  for (const auto &field : fields) {
+    if (!joined_fields.empty()) {
+      joined_fields += ", ";
+    }
+    joined_fields += field;
+  }
+  return joined_fields;
+}
+
+Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
+                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GetIndexFields(columns, &fields));
+  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
+    shard_count_, std::vector<std::vector<uint64_t>>{});
+  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
+
+  std::string sql = "SELECT " + JoinIndexFields(fields) + " FROM INDEXES ORDER BY ROW_ID ;";
+  std::vector<std::pair<std::string, std::string>> criteria;
 
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] = std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, offset_ptr, col_val_ptr);
+    thread_read_db[x] =
+      std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, fields, criteria, columns, offset_ptr, col_val_ptr);
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -596,25 +743,16 @@ Status ShardReader::ReadRowGroupByShardIDAndSampleID(const std::vector<std::stri
                                                      const uint32_t &sample_id,
                                                      std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GetIndexFields(columns, &fields));
   auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
     shard_count_, std::vector<std::vector<uint64_t>>{});
   auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
-  if (all_in_index_) {
-    for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
-      std::shared_ptr<std::string> fn_ptr;
-      RETURN_IF_NOT_OK_MR(
-        ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
-    }
-  } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
-  }
 
-  std::string sql = "SELECT " + fields + " FROM INDEXES WHERE ROW_ID = " + std::to_string(sample_id);
+  std::string sql = "SELECT " + JoinIndexFields(fields) + " FROM INDEXES WHERE ROW_ID = " + std::to_string(sample_id);
+  std::vector<std::pair<std::string, std::string>> criteria = {{"ROW_ID", std::to_string(sample_id)}};
 
-  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, columns, offset_ptr, col_val_ptr));
+  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, fields, criteria, columns, offset_ptr, col_val_ptr));
   *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
   return Status::OK();
 }
@@ -671,8 +809,32 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
   return 0;
 }
 
+std::vector<std::pair<std::string, std::string>> ShardReader::GetIndexCriteria(
+  int page_id, const std::pair<std::string, std::string> &criteria) {
+  std::vector<std::pair<std::string, std::string>> index_criteria = {{"PAGE_ID_BLOB", std::to_string(page_id)}};
+  if (!criteria.first.empty()) {
+    index_criteria.emplace_back(criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]),
+                                criteria.second);
+  }
+  return index_criteria;
+}
+
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
+  if (columnar_indexes_[shard_id] != nullptr) {
+    std::vector<std::vector<std::string>> image_offsets;
+    auto rc = columnar_indexes_[shard_id]->Select({"PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"},
+                                                  GetIndexCriteria(page_id, criteria), &image_offsets);
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to get image offset from index, " << rc.ToString();
+      return std::vector<std::vector<uint64_t>>();
+    }
+    std::vector<std::vector<uint64_t>> res;
+    for (const auto &image_offset : image_offsets) {
+      res.emplace_back(std::vector<uint64_t>{std::stoull(image_offset[0]) + kInt64Len, std::stoull(image_offset[1])});
+    }
+    return res;
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql =
@@ -721,6 +883,23 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
 Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                                        std::shared_ptr<std::vector<uint64_t>> *pages_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(pages_ptr);
+  if (columnar_indexes_[shard_id] != nullptr) {
+    std::vector<std::pair<std::string, std::string>> index_criteria;
+    if (!criteria.first.empty()) {
+      index_criteria.emplace_back(criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]),
+                                  criteria.second);
+    }
+    std::vector<std::vector<std::string>> page_ids;
+    RETURN_IF_NOT_OK_MR(columnar_indexes_[shard_id]->Select({"PAGE_ID_BLOB"}, index_criteria, &page_ids));
+    std::set<uint64_t> distinct_page_ids;
+    for (const auto &page_id : page_ids) {
+      auto id = std::stoull(page_id[0]);
+      if (distinct_page_ids.insert(id).second) {
+        (*pages_ptr)->emplace_back(id);
+      }
+    }
+    return Status::OK();
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql = "SELECT DISTINCT PAGE_ID_BLOB FROM INDEXES WHERE 1 = 1 ";
@@ -874,7 +1053,11 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
   std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END FROM INDEXES WHERE PAGE_ID_BLOB = " +
                     std::to_string(page_id);
   auto label_offset_ptr = std::make_shared<std::vector<std::vector<std::string>>>();
-  if (!criteria.first.empty()) {
+  if (columnar_indexes_[shard_id] != nullptr) {
+    RETURN_IF_NOT_OK_MR(columnar_indexes_[shard_id]->Select({"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"},
+                                                             GetIndexCriteria(page_id, criteria),
+                                                             label_offset_ptr.get()));
+  } else if (!criteria.first.empty()) {
     sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
     RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, label_offset_ptr));
   } else {
@@ -916,7 +1099,14 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
     }
     auto labels = std::make_shared<std::vector<std::vector<std::string>>>();
     std::string sql = "SELECT " + fields + " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
-    if (!criteria.first.empty()) {
+    if (columnar_indexes_[shard_id] != nullptr) {
+      std::vector<std::string> index_fields;
+      for (const auto &column : columns) {
+        index_fields.push_back(column + "_" + std::to_string(column_schema_id_[column]));
+      }
+      RETURN_IF_NOT_OK_MR(
+        columnar_indexes_[shard_id]->Select(index_fields, GetIndexCriteria(page_id, criteria), labels.get()));
+    } else if (!criteria.first.empty()) {
       sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria";
       RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, labels));
     } else {
@@ -986,31 +1176,16 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   std::shared_ptr<std::string> fn_ptr;
   (void)ShardIndexGenerator::GenerateFieldName(std::make_pair(map_schema_id_fields[category_field], category_field),
                                                &fn_ptr);
-  std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
   auto category_ptr = std::make_shared<std::set<std::string>>();
-  sqlite3 *db = nullptr;
+  // the shards are read from their index, or from the meta files opened by Init when there is no index
   for (int x = 0; x < shard_count; x++) {
-    std::string path_utf8 = "";
-#if defined(_WIN32) || defined(_WIN64)
-    path_utf8 = FileUtils::GB2312ToUTF_8((file_paths_[x] + ".db").data());
-#endif
-    if (path_utf8.empty()) {
-      path_utf8 = file_paths_[x] + ".db";
-    }
-
-    int rc = sqlite3_open_v2(path_utf8.data(), &db, SQLITE_OPEN_READONLY, nullptr);
-    if (SQLITE_OK != rc) {
-      MS_LOG(ERROR) << "[Internal ERROR] Failed to open meta file: " << file_paths_[x] + ".db, " << sqlite3_errmsg(db);
-      return -1;
-    }
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, db, x, sql, category_ptr);
+    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, *fn_ptr, category_ptr);
   }
 
   for (int x = 0; x < shard_count; x++) {
     threads[x].join();
   }
-  sqlite3_close(db);
   return category_ptr->size();
 }
 
@@ -1384,20 +1559,9 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
 
   // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
+  std::vector<uint8_t> images;
   auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
-
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
-  }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
-  }
+  RETURN_IF_NOT_OK_MR(ReadBlob(consumer_id, shard_id, file_offset, blob_end - blob_start, &images));
 
   // Deliver batch data to output map
   std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
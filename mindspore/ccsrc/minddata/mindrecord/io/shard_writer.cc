@@ -103,6 +103,8 @@ Status ShardWriter::OpenDataFiles(bool append, bool overwrite) {
           if (res2 == 0) {
             MS_LOG(WARNING) << "Succeed to remove the old mindrecord metadata files, path: " << file + ".db";
           }
+          // the columnar index is optional, a stale one is rebuilt by index generator anyway
+          (void)std::remove((whole_path.value() + kColumnarIndexExtension).c_str());
         } else {
           RETURN_STATUS_UNEXPECTED_MR(
             "Invalid file, mindrecord files already exist. Please check file path: " + file +
@@ -552,6 +554,35 @@ Status ShardWriter::UnlockWriter(int fd, bool parallel_writer) {
   return Status::OK();
 }
 
+Status ShardWriter::CompressBlobData(std::vector<std::vector<uint8_t>> &blob_data) {
+  if (!shard_column_->CheckCompressBlob() || blob_data.empty()) {
+    return Status::OK();
+  }
+  // compression does not depend on the shard, so use the cores instead of the shard count
+  int thread_num = static_cast<int>(std::min<size_t>(
+    {static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1U)), static_cast<size_t>(kMaxThreadCount),
+     blob_data.size()}));
+  auto compress = [this, &blob_data, thread_num](int thread_id) {
+    int64_t compression_bytes = 0;
+    for (size_t i = thread_id; i < blob_data.size(); i += thread_num) {
+      int64_t blob_compression_bytes = 0;
+      blob_data[i] = shard_column_->CompressBlob(blob_data[i], &blob_compression_bytes);
+      compression_bytes += blob_compression_bytes;
+    }
+    compression_size_ += compression_bytes;
+  };
+  std::vector<std::thread> thread_set;
+  thread_set.reserve(thread_num - 1);
+  for (int x = 1; x < thread_num; ++x) {
+    thread_set.emplace_back(compress, x);
+  }
+  compress(0);
+  for (auto &thread : thread_set) {
+    thread.join();
+  }
+  return Status::OK();
+}
+
 Status ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &raw_data,
                                          std::vector<std::vector<uint8_t>> &blob_data, bool sign, int *schema_count,
                                          int *row_count) {
@@ -562,13 +593,7 @@ Status ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &
     *size_ptr >= kMinFreeDiskSize,
     "No free disk to be used while writing mindrecord files, available free disk size: " + std::to_string(*size_ptr));
   // compress blob
-  if (shard_column_->CheckCompressBlob()) {
-    for (auto &blob : blob_data) {
-      int64_t compression_bytes = 0;
-      blob = shard_column_->CompressBlob(blob, &compression_bytes);
-      compression_size_ += compression_bytes;
-    }
-  }
+  RETURN_IF_NOT_OK_MR(CompressBlobData(blob_data));
 
   // Add 4-bytes dummy blob data if no any blob fields
   if (blob_data.size() == 0 && raw_data.size() > 0) {
@@ -707,17 +732,23 @@ Status ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &b
     }
     // Start one thread for one shard
     std::vector<std::thread> thread_set(thread_num);
+    std::vector<Status> thread_status(thread_num);
     if (thread_num <= kMaxThreadCount) {
       for (int x = 0; x < thread_num; ++x) {
         int start_row = shards[current_thread + x].first;
         int end_row = shards[current_thread + x].second;
-        thread_set[x] = std::thread(&ShardWriter::WriteByShard, this, current_thread + x, start_row, end_row,
-                                    std::ref(blob_data), std::ref(bin_raw_data));
+        thread_set[x] = std::thread([this, &thread_status, &blob_data, &bin_raw_data, x, current_thread, start_row,
+                                     end_row]() {
+          thread_status[x] = WriteByShard(current_thread + x, start_row, end_row, blob_data, bin_raw_data);
+        });
       }
       // Wait for threads done
       for (int x = 0; x < thread_num; ++x) {
         thread_set[x].join();
       }
+      for (int x = 0; x < thread_num; ++x) {
+        RETURN_IF_NOT_OK_MR(thread_status[x]);
+      }
       left_thread -= thread_num;
       current_thread += thread_num;
     }
@@ -0,0 +1,333 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_columnar_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+const char kColumnarIndexMagic[] = "MRCIDX02";
+const uint64_t kColumnarIndexMagicLen = 8;
+const char kRowIdColumn[] = "ROW_ID";
+const char kIncColumnPrefix[] = "INC_";
+const std::vector<std::string> kOffsetColumns = {"ROW_ID",           "ROW_GROUP_ID",        "PAGE_ID_RAW",
+                                                 "PAGE_OFFSET_RAW",  "PAGE_OFFSET_RAW_END", "PAGE_ID_BLOB",
+                                                 "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
+
+void WriteUint64(std::ofstream *out, uint64_t value) {
+  (void)out->write(reinterpret_cast<const char *>(&value), kInt64Len);
+}
+
+void WriteName(std::ofstream *out, const std::string &name) {
+  WriteUint64(out, name.size());
+  (void)out->write(name.data(), name.size());
+}
+
+bool ReadUint64(const std::vector<char> &buffer, uint64_t *pos, uint64_t *value) {
+  if (*pos + kInt64Len > buffer.size()) {
+    return false;
+  }
+  (void)memcpy(value, buffer.data() + *pos, kInt64Len);
+  *pos += kInt64Len;
+  return true;
+}
+
+bool ReadBytes(const std::vector<char> &buffer, uint64_t *pos, uint64_t len, std::string *value) {
+  if (len > buffer.size() || *pos + len > buffer.size()) {
+    return false;
+  }
+  value->assign(buffer.data() + *pos, len);
+  *pos += len;
+  return true;
+}
+
+bool ReadName(const std::vector<char> &buffer, uint64_t *pos, std::string *name) {
+  uint64_t len = 0;
+  return ReadUint64(buffer, pos, &len) && ReadBytes(buffer, pos, len, name);
+}
+
+int64_t GetShardFileSize(const std::string &shard_address) {
+  auto realpath = FileUtils::GetRealPath(shard_address.c_str());
+  if (!realpath.has_value()) {
+    return -1;
+  }
+  std::ifstream in(realpath.value(), std::ios::in | std::ios::binary | std::ios::ate);
+  if (!in.good()) {
+    return -1;
+  }
+  return static_cast<int64_t>(in.tellg());
+}
+}  // namespace
+
+Status ShardColumnarIndex::AddRow(const std::vector<std::tuple<std::string, std::string, std::string>> &row_data) {
+  for (const auto &field : row_data) {
+    const auto &place_holder = std::get<0>(field);
+    const auto &field_type = std::get<1>(field);
+    const auto &field_value = std::get<2>(field);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(place_holder.size() > 1 && place_holder[0] == ':',
+                                    "[Internal ERROR] Invalid place holder of index: " + place_holder);
+    std::string name = place_holder.substr(1);
+    // INC_ columns only extend the primary key of sqlite table and carry no data
+    if (name.compare(0, strlen(kIncColumnPrefix), kIncColumnPrefix) == 0) {
+      continue;
+    }
+    if (std::find(kOffsetColumns.begin(), kOffsetColumns.end(), name) != kOffsetColumns.end()) {
+      try {
+        int_columns_[name].push_back(std::stoull(field_value));
+      } catch (std::exception &e) {
+        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Invalid value of index column: " + name + ", value: " +
+                                    field_value);
+      }
+      continue;
+    }
+    auto &column = text_columns_[name];
+    if (column.offsets.empty()) {
+      column.offsets.push_back(0);
+    }
+    // a NULL value has no type, so the type of the column is taken from its typed values
+    if (field_type == "INTEGER" || field_type == "NUMERIC" || field_type == "REAL") {
+      column.numeric = true;
+    }
+    // sqlite returns NULL as empty string to the select callback
+    if (field_type != "NULL") {
+      column.data += field_value;
+    }
+    column.offsets.push_back(column.data.size());
+  }
+  row_count_++;
+  for (const auto &column : int_columns_) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(column.second.size() == row_count_,
+                                    "[Internal ERROR] Index column: " + column.first + " is missing in row data.");
+  }
+  for (const auto &column : text_columns_) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(column.second.offsets.size() == row_count_ + 1,
+                                    "[Internal ERROR] Index column: " + column.first + " is missing in row data.");
+  }
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::WriteToFile(const std::string &shard_address) {
+  // sort by ROW_ID, so that select returns rows in the same order as "ORDER BY ROW_ID"
+  std::vector<uint64_t> order(row_count_);
+  std::iota(order.begin(), order.end(), 0);
+  if (row_count_ > 0) {
+    auto iter = int_columns_.find(kRowIdColumn);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(iter != int_columns_.end(), "[Internal ERROR] ROW_ID is missing in index.");
+    const auto &row_ids = iter->second;
+    std::stable_sort(order.begin(), order.end(),
+                     [&row_ids](uint64_t a, uint64_t b) { return row_ids[a] < row_ids[b]; });
+  }
+
+  auto shard_size = GetShardFileSize(shard_address);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_size >= 0, "Invalid file, failed to get the size of mindrecord file: " +
+                                                     shard_address + ". Please check file path and permission.");
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr));
+  std::string index_file = shard_address + kColumnarIndexExtension;
+  std::ofstream out(index_file, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(), "Invalid file, failed to open mindrecord index file: " + index_file +
+                                                ". Please check file path and permission.");
+  (void)out.write(kColumnarIndexMagic, kColumnarIndexMagicLen);
+  WriteName(&out, *fn_ptr);
+  WriteUint64(&out, static_cast<uint64_t>(shard_size));
+  WriteUint64(&out, row_count_);
+  WriteUint64(&out, int_columns_.size());
+  WriteUint64(&out, text_columns_.size());
+  for (const auto &column : int_columns_) {
+    WriteName(&out, column.first);
+    for (auto row : order) {
+      WriteUint64(&out, column.second[row]);
+    }
+  }
+  for (const auto &column : text_columns_) {
+    WriteName(&out, column.first);
+    WriteUint64(&out, column.second.numeric ? 1 : 0);
+    uint64_t offset = 0;
+    WriteUint64(&out, offset);
+    for (auto row : order) {
+      offset += column.second.offsets[row + 1] - column.second.offsets[row];
+      WriteUint64(&out, offset);
+    }
+    for (auto row : order) {
+      (void)out.write(column.second.data.data() + column.second.offsets[row],
+                      column.second.offsets[row + 1] - column.second.offsets[row]);
+    }
+  }
+  bool success = out.good();
+  out.close();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(success, "[Internal ERROR] Failed to write mindrecord index file: " + index_file);
+  MS_LOG(INFO) << "Succeed to write " << row_count_ << " rows to index file: " << index_file;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Load(const std::string &shard_address, std::shared_ptr<ShardColumnarIndex> *index_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index_ptr);
+  *index_ptr = nullptr;
+  std::string index_file = shard_address + kColumnarIndexExtension;
+  std::ifstream in(index_file, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!in.good()) {
+    MS_LOG(INFO) << "Index file: " << index_file << " does not exist, use meta file instead.";
+    return Status::OK();
+  }
+  std::vector<char> buffer(static_cast<size_t>(in.tellg()));
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(buffer.data(), buffer.size());
+  bool read_success = in.good();
+  in.close();
+  if (!read_success) {
+    MS_LOG(WARNING) << "Failed to read index file: " << index_file << ", use meta file instead.";
+    return Status::OK();
+  }
+
+  auto index = std::make_shared<ShardColumnarIndex>();
+  uint64_t pos = 0;
+  std::string magic;
+  uint64_t int_column_count = 0;
+  uint64_t text_column_count = 0;
+  std::string shard_name;
+  bool valid = ReadBytes(buffer, &pos, kColumnarIndexMagicLen, &magic) && magic == kColumnarIndexMagic &&
+               ReadName(buffer, &pos, &shard_name) && ReadUint64(buffer, &pos, &index->shard_size_) &&
+               ReadUint64(buffer, &pos, &index->row_count_) && ReadUint64(buffer, &pos, &int_column_count) &&
+               ReadUint64(buffer, &pos, &text_column_count);
+  // every value takes at least one byte, it protects the allocations below from a corrupted row count
+  valid = valid && index->row_count_ <= buffer.size();
+  for (uint64_t i = 0; valid && i < int_column_count; ++i) {
+    std::string name;
+    valid = ReadName(buffer, &pos, &name);
+    auto &values = index->int_columns_[name];
+    values.resize(valid ? index->row_count_ : 0);
+    for (uint64_t row = 0; valid && row < index->row_count_; ++row) {
+      valid = ReadUint64(buffer, &pos, &values[row]);
+    }
+  }
+  for (uint64_t i = 0; valid && i < text_column_count; ++i) {
+    std::string name;
+    uint64_t numeric = 0;
+    valid = ReadName(buffer, &pos, &name) && ReadUint64(buffer, &pos, &numeric);
+    auto &column = index->text_columns_[name];
+    column.numeric = numeric != 0;
+    column.offsets.resize(valid ? index->row_count_ + 1 : 0);
+    for (uint64_t row = 0; valid && row <= index->row_count_; ++row) {
+      valid = ReadUint64(buffer, &pos, &column.offsets[row]) &&
+              (row == 0 || column.offsets[row] >= column.offsets[row - 1]);
+    }
+    valid = valid && ReadBytes(buffer, &pos, column.offsets.back(), &column.data);
+  }
+  if (!valid || pos != buffer.size()) {
+    MS_LOG(WARNING) << "Index file: " << index_file << " is corrupted, use meta file instead.";
+    return Status::OK();
+  }
+  if (GetShardFileSize(shard_address) != static_cast<int64_t>(index->shard_size_)) {
+    MS_LOG(WARNING) << "Index file: " << index_file << " does not match mindrecord file: " << shard_address
+                    << ", use meta file instead.";
+    return Status::OK();
+  }
+  // the same check as the name in the meta file
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_name == *fn_ptr, "Invalid file, mindrecord index file: " + index_file +
+                                                           " and mindrecord file: " + shard_address +
+                                                           " can not match. Please do not rename the mindrecord file "
+                                                           "or index file.");
+  *index_ptr = index;
+  MS_LOG(DEBUG) << "Succeed to load " << index->row_count_ << " rows from index file: " << index_file;
+  return Status::OK();
+}
+
+std::string ShardColumnarIndex::GetText(const TextColumn &column, uint64_t row) const {
+  return column.data.substr(column.offsets[row], column.offsets[row + 1] - column.offsets[row]);
+}
+
+bool ShardColumnarIndex::Match(const std::string &column, const std::string &value, uint64_t row) const {
+  auto int_iter = int_columns_.find(column);
+  if (int_iter != int_columns_.end()) {
+    try {
+      return int_iter->second[row] == std::stoull(value);
+    } catch (std::exception &e) {
+      return false;
+    }
+  }
+  const auto &text_column = text_columns_.at(column);
+  auto text = GetText(text_column, row);
+  if (text_column.numeric) {
+    // sqlite compares values of numeric columns by number, e.g. '1.0' = 1, and keeps a REAL value as a double
+    try {
+      return std::stod(text) == std::stod(value);
+    } catch (std::exception &e) {
+      return text == value;
+    }
+  }
+  return text == value;
+}
+
+Status ShardColumnarIndex::Select(const std::vector<std::string> &columns,
+                                  const std::vector<std::pair<std::string, std::string>> &criteria,
+                                  std::vector<std::vector<std::string>> *rows) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  auto has_column = [this](const std::string &name) {
+    return int_columns_.find(name) != int_columns_.end() || text_columns_.find(name) != text_columns_.end();
+  };
+  for (const auto &column : columns) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(has_column(column), "[Internal ERROR] Column: " + column + " is not in index.");
+  }
+  uint64_t begin = 0;
+  uint64_t end = row_count_;
+  for (const auto &criterion : criteria) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(has_column(criterion.first),
+                                    "[Internal ERROR] Column: " + criterion.first + " is not in index.");
+    // rows are sorted by ROW_ID, so a lookup by ROW_ID is a binary search
+    if (criterion.first == kRowIdColumn && row_count_ > 0) {
+      const auto &row_ids = int_columns_.at(kRowIdColumn);
+      uint64_t row_id = 0;
+      try {
+        row_id = std::stoull(criterion.second);
+      } catch (std::exception &e) {
+        return Status::OK();
+      }
+      auto range = std::equal_range(row_ids.begin(), row_ids.end(), row_id);
+      begin = std::max(begin, static_cast<uint64_t>(range.first - row_ids.begin()));
+      end = std::min(end, static_cast<uint64_t>(range.second - row_ids.begin()));
+    }
+  }
+  for (uint64_t row = begin; row < end; ++row) {
+    if (!std::all_of(criteria.begin(), criteria.end(), [this, row](const std::pair<std::string, std::string> &c) {
+          return Match(c.first, c.second, row);
+        })) {
+      continue;
+    }
+    std::vector<std::string> values;
+    values.reserve(columns.size());
+    for (const auto &column : columns) {
+      auto int_iter = int_columns_.find(column);
+      if (int_iter != int_columns_.end()) {
+        values.emplace_back(std::to_string(int_iter->second[row]));
+      } else {
+        values.emplace_back(GetText(text_columns_.at(column), row));
+      }
+    }
+    rows->emplace_back(std::move(values));
+  }
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 
+#include "minddata/dataset/util/index_permutation.h"
+
 namespace mindspore {
 namespace mindrecord {
 ShardShuffle::ShardShuffle(uint32_t seed, ShuffleType shuffle_type)
@@ -25,7 +27,8 @@ ShardShuffle::ShardShuffle(uint32_t seed, ShuffleType shuffle_type)
       no_of_samples_(0),
       replacement_(false),
       reshuffle_each_epoch_(true),
-      shuffle_type_(shuffle_type) {}
+      shuffle_type_(shuffle_type),
+      seekable_(false) {}
 
 ShardShuffle::ShardShuffle(uint32_t seed, int64_t no_of_samples, bool replacement, bool reshuffle_each_epoch,
                            ShuffleType shuffle_type)
@@ -33,7 +36,8 @@ ShardShuffle::ShardShuffle(uint32_t seed, int64_t no_of_samples, bool replacemen
       no_of_samples_(no_of_samples),
       replacement_(replacement),
       reshuffle_each_epoch_(reshuffle_each_epoch),
-      shuffle_type_(shuffle_type) {}
+      shuffle_type_(shuffle_type),
+      seekable_(false) {}
 
 int64_t ShardShuffle::GetNumSamples(int64_t dataset_size, int64_t num_classes) {
   if (replacement_) {
@@ -42,6 +46,14 @@ int64_t ShardShuffle::GetNumSamples(int64_t dataset_size, int64_t num_classes) {
   return no_of_samples_ == 0 ? dataset_size : std::min(dataset_size, no_of_samples_);
 }
 
+void ShardShuffle::SetSeekable(int64_t start_epoch) {
+  seekable_ = true;
+  // The seed is increased before each epoch, so the seed of a later epoch can be set directly
+  if (reshuffle_each_epoch_) {
+    shuffle_seed_ += static_cast<uint32_t>(start_epoch);
+  }
+}
+
 Status ShardShuffle::CategoryShuffle(ShardTaskList &tasks) {
   int64_t individual_size = tasks.sample_ids_.size() / tasks.categories;
   std::vector<std::vector<int64_t>> new_permutations(tasks.categories, std::vector<int64_t>(individual_size));
@@ -156,6 +168,23 @@ Status ShardShuffle::ShuffleInfile(ShardTaskList &tasks) {
   return Status::OK();
 }
 
+Status ShardShuffle::SeekableShuffle(ShardTaskList &tasks) {
+  // The tasks hold the order of the previous epoch, so every epoch is permuted from the order of the first epoch
+  if (first_epoch_sample_ids_.empty()) {
+    first_epoch_sample_ids_ = tasks.sample_ids_;
+  }
+  int64_t total_no = static_cast<int64_t>(first_epoch_sample_ids_.size());
+  int64_t samples_to_assign = (no_of_samples_ > 0 && no_of_samples_ < total_no) ? no_of_samples_ : total_no;
+  dataset::IndexPermutation permutation(total_no, shuffle_seed_);
+  ShardTaskList new_tasks;
+  new_tasks.sample_ids_.reserve(samples_to_assign);
+  for (int64_t i = 0; i < samples_to_assign; ++i) {
+    new_tasks.sample_ids_.push_back(first_epoch_sample_ids_[permutation[i]]);
+  }
+  ShardTaskList::TaskListSwap(tasks, new_tasks);
+  return Status::OK();
+}
+
 Status ShardShuffle::Execute(ShardTaskList &tasks) {
   if (reshuffle_each_epoch_) {
     shuffle_seed_++;
@@ -181,6 +210,8 @@ Status ShardShuffle::Execute(ShardTaskList &tasks) {
         }
 
         ShardTaskList::TaskListSwap(tasks, new_tasks);
+      } else if (seekable_) {
+        RETURN_IF_NOT_OK_MR(SeekableShuffle(tasks));
       } else {
         std::shuffle(tasks.permutation_.begin(), tasks.permutation_.end(), std::default_random_engine(shuffle_seed_));
         auto total_no = tasks.Size();
@@ -38,7 +38,8 @@ class CPUMemoryPool : public DynamicMemPoolBestFit {
   size_t free_mem_size() override;
 
  private:
-  CPUMemoryPool() = default;
+  // The kernel actors alloc and free the small memory concurrently, which are served by the size class cache.
+  CPUMemoryPool() { EnableSizeClassCache(); }
   DISABLE_COPY_AND_ASSIGN(CPUMemoryPool);
 
   size_t total_used_memory_{0};
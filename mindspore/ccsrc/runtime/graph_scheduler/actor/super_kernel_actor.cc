@@ -15,11 +15,15 @@
  */
 
 #include <set>
+#include <algorithm>
+#include "utils/hash_map.h"
 #include "runtime/graph_scheduler/actor/super_kernel_actor.h"
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
+#include "mindrt/src/actor/actormgr.h"
 #include "mindrt/include/async/async.h"
+#include "include/common/utils/utils.h"
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -50,6 +54,45 @@ bool IsInputNodeUsedByRealKernel(const AnfNodePtr &input_node, const AnfNodePtr
   }
   return false;
 }
+
+// The memory which is read or written by a kernel of the linear plan. The tensors which use the somas are the ranges of
+// somas block, and the other tensors are identified by their device tensors.
+struct LinearPlanMemory {
+  const void *owner_;
+  size_t offset_;
+  size_t size_;
+};
+
+bool IsMemoryOverlapped(const std::vector<LinearPlanMemory> &lhs, const std::vector<LinearPlanMemory> &rhs) {
+  for (const auto &lhs_memory : lhs) {
+    for (const auto &rhs_memory : rhs) {
+      if ((lhs_memory.owner_ == rhs_memory.owner_) && (lhs_memory.offset_ < rhs_memory.offset_ + rhs_memory.size_) &&
+          (rhs_memory.offset_ < lhs_memory.offset_ + lhs_memory.size_)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// The kernel which has the side effect or modifies its input can't be reordered with any other kernels.
+bool IsLinearPlanBarrier(const CNodePtr &kernel, const KernelGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  MS_EXCEPTION_IF_NULL(graph);
+  for (const auto &input : kernel->inputs()) {
+    MS_EXCEPTION_IF_NULL(input);
+    if (HasAbstractMonad(input)) {
+      return true;
+    }
+  }
+  size_t output_num = common::AnfAlgo::GetOutputTensorNum(kernel);
+  for (size_t i = 0; i < output_num; ++i) {
+    if (graph->IsInRefOutputMap(std::make_pair(kernel, i))) {
+      return true;
+    }
+  }
+  return false;
+}
 }  // namespace
 
 void SuperKernelActor::Init() {
@@ -102,6 +145,141 @@ void SuperKernelActor::Init() {
     // If the parameter has ref attribute and is directly used by the kernel in the graph, it needs to be copied.
     is_parameters_need_copy_[i] = true;
   }
+
+  enable_linear_plan_ = graph_->has_flag(kFlagLinearPlan);
+  if (enable_linear_plan_) {
+    BuildLinearPlan();
+    if (common::GetEnv(kCPULinearPlan) == kCPULinearPlanParallel) {
+      BuildLinearPlanWaves();
+    }
+  }
+}
+
+void SuperKernelActor::BuildLinearPlan() {
+  MS_EXCEPTION_IF_NULL(graph_);
+  for (const auto &kernel : graph_->execution_order()) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    auto kernel_info = dynamic_cast<device::KernelInfo *>(kernel->kernel_info());
+    MS_EXCEPTION_IF_NULL(kernel_info);
+    LinearPlanKernel plan_kernel;
+    plan_kernel.kernel_ = kernel;
+    plan_kernel.is_launch_skipped_ =
+      common::AnfAlgo::IsNopNode(kernel) && graph_->IsInRefOutputMap(std::make_pair(kernel, 0));
+
+    size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+    for (size_t i = 0; i < input_num; ++i) {
+      const auto &input_with_index = common::AnfAlgo::GetPrevNodeOutput(kernel, i, false);
+      MS_EXCEPTION_IF_NULL(input_with_index.first);
+      auto input_device_tensor = AnfAlgo::GetMutableOutputAddr(input_with_index.first, input_with_index.second, false);
+      MS_EXCEPTION_IF_NULL(input_device_tensor);
+      (void)plan_kernel.input_parameters_.emplace_back(
+        input_with_index.first->isa<Parameter>() ? input_with_index.first : nullptr);
+      (void)plan_kernel.input_device_tensors_.emplace_back(input_device_tensor.get());
+      (void)plan_kernel.launch_info_.inputs_.emplace_back(std::make_shared<kernel::Address>());
+    }
+
+    const auto &output_addresses = kernel_info->output_address_list();
+    const auto &somas_outputs = kernel_info->somas_output_result();
+    for (size_t i = 0; i < output_addresses.size(); ++i) {
+      MS_EXCEPTION_IF_NULL(output_addresses[i]);
+      (void)plan_kernel.output_device_tensors_.emplace_back(output_addresses[i].get());
+      (void)plan_kernel.launch_info_.outputs_.emplace_back(std::make_shared<kernel::Address>());
+      if (kernel_info->IsTensorEnableSomas(somas_outputs, i)) {
+        MS_EXCEPTION_IF_CHECK_FAIL((somas_outputs[i].second >= output_addresses[i]->GetSize()),
+                                   "The somas size is wrong.");
+        (void)somas_device_tensors_.emplace_back(output_addresses[i].get(), somas_outputs[i].first);
+      }
+    }
+
+    const auto &workspace_addresses = kernel_info->workspace_address_list();
+    const auto &somas_workspace = kernel_info->somas_workspace_result();
+    for (size_t i = 0; i < workspace_addresses.size(); ++i) {
+      MS_EXCEPTION_IF_NULL(workspace_addresses[i]);
+      (void)plan_kernel.workspace_device_tensors_.emplace_back(workspace_addresses[i].get());
+      (void)plan_kernel.launch_info_.workspaces_.emplace_back(std::make_shared<kernel::Address>());
+      if (kernel_info->IsTensorEnableSomas(somas_workspace, i)) {
+        MS_EXCEPTION_IF_CHECK_FAIL((somas_workspace[i].second >= workspace_addresses[i]->GetSize()),
+                                   "The somas size is wrong.");
+        (void)somas_device_tensors_.emplace_back(workspace_addresses[i].get(), somas_workspace[i].first);
+      }
+    }
+    (void)linear_plan_kernels_.emplace_back(std::move(plan_kernel));
+  }
+
+  if ((!somas_device_tensors_.empty()) && (graph_->somas_whole_block_size() == 0)) {
+    MS_LOG(EXCEPTION) << "The somas is not enable for: " << GetAID().Name();
+  }
+  MS_LOG(INFO) << "Super kernel actor(" << GetAID().Name() << ") builds the linear plan of "
+               << linear_plan_kernels_.size() << " kernels, somas tensor num: " << somas_device_tensors_.size();
+}
+
+void SuperKernelActor::BuildLinearPlanWaves() {
+  MS_EXCEPTION_IF_NULL(graph_);
+  // Collect the memory read and written by each kernel.
+  std::vector<std::vector<LinearPlanMemory>> read_memories(linear_plan_kernels_.size());
+  std::vector<std::vector<LinearPlanMemory>> write_memories(linear_plan_kernels_.size());
+  mindspore::HashMap<const DeviceTensor *, size_t> somas_offsets;
+  for (const auto &somas_device_tensor : somas_device_tensors_) {
+    somas_offsets[somas_device_tensor.first] = somas_device_tensor.second;
+  }
+  auto get_memory = [this, &somas_offsets](const DeviceTensor *device_tensor, const AnfNodePtr &parameter) {
+    if (parameter != nullptr) {
+      return LinearPlanMemory{parameter.get(), 0, 1};
+    }
+    const auto &iter = somas_offsets.find(device_tensor);
+    if (iter != somas_offsets.end()) {
+      return LinearPlanMemory{graph_.get(), iter->second, device_tensor->GetSize()};
+    }
+    return LinearPlanMemory{device_tensor, 0, 1};
+  };
+  for (size_t i = 0; i < linear_plan_kernels_.size(); ++i) {
+    const auto &plan_kernel = linear_plan_kernels_[i];
+    for (size_t j = 0; j < plan_kernel.input_device_tensors_.size(); ++j) {
+      (void)read_memories[i].emplace_back(
+        get_memory(plan_kernel.input_device_tensors_[j], plan_kernel.input_parameters_[j]));
+    }
+    for (const auto &output_device_tensor : plan_kernel.output_device_tensors_) {
+      (void)write_memories[i].emplace_back(get_memory(output_device_tensor, nullptr));
+    }
+    for (const auto &workspace_device_tensor : plan_kernel.workspace_device_tensors_) {
+      (void)write_memories[i].emplace_back(get_memory(workspace_device_tensor, nullptr));
+    }
+  }
+
+  // The level of kernel is after all the previous kernels which it conflicts with, and the barrier kernel is after all
+  // the previous kernels and before all the subsequent kernels.
+  std::vector<size_t> levels(linear_plan_kernels_.size(), 0);
+  size_t last_barrier = 0;
+  size_t min_level = 0;
+  size_t max_level = 0;
+  for (size_t i = 0; i < linear_plan_kernels_.size(); ++i) {
+    if (IsLinearPlanBarrier(linear_plan_kernels_[i].kernel_, graph_)) {
+      levels[i] = (i == 0) ? 0 : max_level + 1;
+      last_barrier = i;
+      min_level = levels[i] + 1;
+      max_level = levels[i];
+      continue;
+    }
+    levels[i] = min_level;
+    for (size_t j = last_barrier; j < i; ++j) {
+      if (levels[j] + 1 <= levels[i]) {
+        continue;
+      }
+      if (IsMemoryOverlapped(write_memories[j], read_memories[i]) ||
+          IsMemoryOverlapped(read_memories[j], write_memories[i]) ||
+          IsMemoryOverlapped(write_memories[j], write_memories[i])) {
+        levels[i] = levels[j] + 1;
+      }
+    }
+    max_level = std::max(max_level, levels[i]);
+  }
+
+  linear_plan_waves_.resize(linear_plan_kernels_.empty() ? 0 : max_level + 1);
+  for (size_t i = 0; i < levels.size(); ++i) {
+    (void)linear_plan_waves_[levels[i]].emplace_back(i);
+  }
+  MS_LOG(INFO) << "Super kernel actor(" << GetAID().Name() << ") builds " << linear_plan_waves_.size()
+               << " waves for " << linear_plan_kernels_.size() << " kernels.";
 }
 
 size_t SuperKernelActor::FetchInputNodePosition(const AnfNodePtr &intput_node) {
@@ -127,19 +305,26 @@ void SuperKernelActor::Run(OpContext<DeviceTensor> *const context) {
     SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
   }
 
-  try {
-    const std::vector<tensor::Tensor> inputs;
-    std::vector<tensor::Tensor> outputs;
-    const std::map<string, string> compile_options;
-    auto ret = device_contexts_[0]->graph_executor_->RunGraph(graph_, inputs, &outputs, compile_options);
-    if (!ret) {
-      std::string error_info = "Launch graph failed, graph id: " + std::to_string(graph_->graph_id());
+  if (enable_linear_plan_) {
+    RunLinearPlan(context);
+    if (IsRunningFailed(context)) {
+      return;
+    }
+  } else {
+    try {
+      const std::vector<tensor::Tensor> inputs;
+      std::vector<tensor::Tensor> outputs;
+      const std::map<string, string> compile_options;
+      auto ret = device_contexts_[0]->graph_executor_->RunGraph(graph_, inputs, &outputs, compile_options);
+      if (!ret) {
+        std::string error_info = "Launch graph failed, graph id: " + std::to_string(graph_->graph_id());
+        SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+      }
+    } catch (const std::exception &e) {
+      MsException::Instance().SetException();
+      std::string error_info = "Launch graph exception, graph id: " + std::to_string(graph_->graph_id());
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
     }
-  } catch (const std::exception &e) {
-    MsException::Instance().SetException();
-    std::string error_info = "Launch graph exception, graph id: " + std::to_string(graph_->graph_id());
-    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
   }
 
   for (auto item : ref_node_addr_map_) {
@@ -165,6 +350,157 @@ void SuperKernelActor::Run(OpContext<DeviceTensor> *const context) {
   PostRun(context);
 }
 
+bool SuperKernelActor::PrepareLinearPlanMemory(std::string *const error_info) {
+  MS_EXCEPTION_IF_NULL(error_info);
+  const auto &device_context = device_contexts_[0];
+  MS_EXCEPTION_IF_NULL(device_context);
+  MS_EXCEPTION_IF_NULL(device_context->device_res_manager_);
+  auto allocate_memory = [this, &device_context, error_info](DeviceTensor *const device_tensor,
+                                                             const CNodePtr &kernel) {
+    MS_EXCEPTION_IF_NULL(device_tensor);
+    if (device_tensor->GetPtr() != nullptr) {
+      return true;
+    }
+    device::DynamicMemAllocatorDebugInfo::SetDebugInfo(GetAID().Name(), device::AllocatorType::kKernelOutput);
+    if (!device_context->device_res_manager_->AllocateMemory(device_tensor)) {
+      *error_info = "Device(id:" + std::to_string(device_context->device_context_key().device_id_) +
+                    ") memory isn't enough and alloc failed, kernel name: " + kernel->fullname_with_scope() +
+                    ", alloc size: " + std::to_string(device_tensor->GetSize()) + "B.";
+      return false;
+    }
+    return true;
+  };
+
+  // The somas block is allocated at the first step, and the tensors which use the somas keep their addresses.
+  if ((somas_block_ == nullptr) && (!somas_device_tensors_.empty())) {
+    somas_block_ = device_context->device_res_manager_->CreateDeviceAddress(
+      nullptr, graph_->somas_whole_block_size(), kOpFormat_DEFAULT, kTypeUnknown, ShapeVector());
+    MS_EXCEPTION_IF_NULL(somas_block_);
+    device::DynamicMemAllocatorDebugInfo::SetDebugInfo(GetAID().Name(), device::AllocatorType::kKernelOutput);
+    if (!device_context->device_res_manager_->AllocateMemory(somas_block_.get())) {
+      *error_info = "Device(id:" + std::to_string(device_context->device_context_key().device_id_) +
+                    ") memory isn't enough and alloc the somas block failed, graph id: " +
+                    std::to_string(graph_->graph_id()) +
+                    ", alloc size: " + std::to_string(graph_->somas_whole_block_size()) + "B.";
+      somas_block_ = nullptr;
+      return false;
+    }
+    for (auto &somas_device_tensor : somas_device_tensors_) {
+      MS_EXCEPTION_IF_NULL(somas_device_tensor.first);
+      somas_device_tensor.first->set_ptr(AddressOffset(somas_block_->GetMutablePtr(), somas_device_tensor.second));
+    }
+  }
+
+  // The other tensors keep their memory between steps, unless the memory is taken away, such as the graph output.
+  for (auto &plan_kernel : linear_plan_kernels_) {
+    const auto &kernel = plan_kernel.kernel_;
+    auto &launch_info = plan_kernel.launch_info_;
+    for (size_t i = 0; i < plan_kernel.input_device_tensors_.size(); ++i) {
+      if (plan_kernel.input_parameters_[i] != nullptr) {
+        plan_kernel.input_device_tensors_[i] =
+          AnfAlgo::GetMutableOutputAddr(plan_kernel.input_parameters_[i], 0, false).get();
+      }
+      const auto &input_device_tensor = plan_kernel.input_device_tensors_[i];
+      MS_EXCEPTION_IF_NULL(input_device_tensor);
+      if (input_device_tensor->GetPtr() == nullptr) {
+        *error_info = "The input index: " + std::to_string(i) + " of kernel: " + kernel->fullname_with_scope() +
+                      " has no device memory.";
+        return false;
+      }
+      launch_info.inputs_[i]->addr = input_device_tensor->GetMutablePtr();
+      launch_info.inputs_[i]->size = input_device_tensor->GetSize();
+    }
+
+    for (size_t i = 0; i < plan_kernel.output_device_tensors_.size(); ++i) {
+      const auto &output_device_tensor = plan_kernel.output_device_tensors_[i];
+      if (!allocate_memory(output_device_tensor, kernel)) {
+        return false;
+      }
+      launch_info.outputs_[i]->addr = output_device_tensor->GetMutablePtr();
+      launch_info.outputs_[i]->size = output_device_tensor->GetSize();
+    }
+
+    for (size_t i = 0; i < plan_kernel.workspace_device_tensors_.size(); ++i) {
+      const auto &workspace_device_tensor = plan_kernel.workspace_device_tensors_[i];
+      if (!allocate_memory(workspace_device_tensor, kernel)) {
+        return false;
+      }
+      launch_info.workspaces_[i]->addr = workspace_device_tensor->GetMutablePtr();
+      launch_info.workspaces_[i]->size = workspace_device_tensor->GetSize();
+    }
+  }
+  return true;
+}
+
+bool SuperKernelActor::LaunchLinearPlanKernel(const LinearPlanKernel &plan_kernel) const {
+  const auto &launch_info = plan_kernel.launch_info_;
+  // The skipped kernel is the nop node whose output is the same memory as input.
+  if (plan_kernel.is_launch_skipped_) {
+    MS_EXCEPTION_IF_CHECK_FAIL((launch_info.inputs_.size() >= 1), "The inputs size is wrong.");
+    MS_EXCEPTION_IF_CHECK_FAIL((launch_info.outputs_.size() == 1), "The outputs size is wrong.");
+    if (launch_info.inputs_[0]->addr == launch_info.outputs_[0]->addr) {
+      return true;
+    }
+    MS_LOG(ERROR) << "Input address and output address are not equal of skipped launch kernel: "
+                  << plan_kernel.kernel_->fullname_with_scope();
+    return false;
+  }
+  return device_contexts_[0]->kernel_executor_->LaunchKernel(plan_kernel.kernel_, launch_info.inputs_,
+                                                             launch_info.workspaces_, launch_info.outputs_,
+                                                             AnfAlgo::GetStreamId(plan_kernel.kernel_));
+}
+
+void SuperKernelActor::RunLinearPlan(OpContext<DeviceTensor> *const context) {
+  MS_EXCEPTION_IF_NULL(context);
+  MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  MS_EXCEPTION_IF_NULL(device_contexts_[0]->kernel_executor_);
+  std::string error_info;
+  if (!PrepareLinearPlanMemory(&error_info)) {
+    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+  }
+
+  try {
+    // Launch the kernels one after another in the execution order.
+    if (linear_plan_waves_.empty()) {
+      for (const auto &plan_kernel : linear_plan_kernels_) {
+        if (!LaunchLinearPlanKernel(plan_kernel)) {
+          error_info = "Launch kernel failed: " + plan_kernel.kernel_->fullname_with_scope();
+          SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+        }
+      }
+      return;
+    }
+
+    // Launch the waves in order, and the kernels of a wave in parallel by the actor thread pool.
+    auto thread_pool = ActorMgr::GetActorMgrRef()->GetActorThreadPool();
+    MS_EXCEPTION_IF_NULL(thread_pool);
+    for (const auto &wave : linear_plan_waves_) {
+      auto task = [this, &wave](void *, int task_id, float, float) {
+        const auto &plan_kernel = linear_plan_kernels_[wave[IntToSize(task_id)]];
+        try {
+          if (!LaunchLinearPlanKernel(plan_kernel)) {
+            MS_LOG(ERROR) << "Launch kernel failed: " << plan_kernel.kernel_->fullname_with_scope();
+            return THREAD_ERROR;
+          }
+        } catch (const std::exception &e) {
+          MsException::Instance().SetException();
+          MS_LOG(ERROR) << "Launch kernel exception: " << plan_kernel.kernel_->fullname_with_scope();
+          return THREAD_ERROR;
+        }
+        return THREAD_OK;
+      };
+      if (thread_pool->ParallelLaunch(task, nullptr, SizeToInt(wave.size())) != THREAD_OK) {
+        error_info = "Launch the kernels of linear plan failed, graph id: " + std::to_string(graph_->graph_id());
+        SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+      }
+    }
+  } catch (const std::exception &e) {
+    MsException::Instance().SetException();
+    error_info = "Launch graph exception, graph id: " + std::to_string(graph_->graph_id());
+    SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), error_info);
+  }
+}
+
 void SuperKernelActor::SendDebugReq(OpContext<DeviceTensor> *const context) {
   running_dependent_msg_num_ = 1;
   ActorDispatcher::SendSync(*debug_aid_, &DebugActor::DebugForGraph, graph_, device_contexts_[0], context, &GetAID());
@@ -26,14 +26,32 @@
 #include "runtime/graph_scheduler/actor/debug_aware_actor.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "runtime/hardware/device_context.h"
+#include "kernel/kernel.h"
 #include "ir/anf.h"
 
 namespace mindspore {
 namespace runtime {
 using mindspore::device::DeviceAddress;
 using mindspore::device::DeviceContext;
+using mindspore::kernel::KernelLaunchInfo;
+
+// The kernel of the linear plan, whose device tensors are collected once when the plan is built.
+struct LinearPlanKernel {
+  CNodePtr kernel_;
+  bool is_launch_skipped_{false};
+  // The input which comes from the parameter is fetched at every step, because the data prepare actor may replace the
+  // device address of parameter.
+  std::vector<AnfNodePtr> input_parameters_;
+  std::vector<DeviceTensor *> input_device_tensors_;
+  std::vector<DeviceTensor *> output_device_tensors_;
+  std::vector<DeviceTensor *> workspace_device_tensors_;
+  KernelLaunchInfo launch_info_;
+};
 
 // The Super kernel actor is used to represent the sink executing of graph which is the combination of kernels.
+// The device which has no graph executor, such as CPU, launches the static graph by the linear plan of actor: the
+// kernels are launched in the execution order one after another by the actor itself, the memory of tensors is assigned
+// by the somas offsets at the first step and kept, instead of the messages between the kernel actors at every step.
 class SuperKernelActor : public DebugAwareActor {
  public:
   SuperKernelActor(const std::string &name, const KernelGraphPtr &graph, const DeviceContext *device_context,
@@ -63,6 +81,13 @@ class SuperKernelActor : public DebugAwareActor {
 
   bool CopyInputData(const OpContext<DeviceTensor> *context);
 
+  // The linear plan related functions.
+  void BuildLinearPlan();
+  void BuildLinearPlanWaves();
+  bool PrepareLinearPlanMemory(std::string *const error_info);
+  bool LaunchLinearPlanKernel(const LinearPlanKernel &plan_kernel) const;
+  void RunLinearPlan(OpContext<DeviceTensor> *const context);
+
   KernelGraphPtr graph_;
 
   // In the scheduler, check whether the parameters need to be copied after lunch. Only when the parameter has
@@ -73,6 +98,17 @@ class SuperKernelActor : public DebugAwareActor {
 
   // The lists of device tensors which need free by dynamic ref count, will be cleared at the end of step.
   std::queue<std::vector<DeviceTensor *>> memory_free_lists_;
+
+  // Whether the graph is launched by the linear plan, which is decided in the graph compiler.
+  bool enable_linear_plan_{false};
+  std::vector<LinearPlanKernel> linear_plan_kernels_;
+  // The kernels of a wave have no data or memory dependency on each other and are launched in parallel, the waves are
+  // launched in order. It is empty when the wave parallelism is disabled.
+  std::vector<std::vector<size_t>> linear_plan_waves_;
+  // The device tensors which use the somas with their offsets in the somas block.
+  std::vector<std::pair<DeviceTensor *, size_t>> somas_device_tensors_;
+  // The whole somas block of graph, which is allocated at the first step and kept until the actor is destroyed.
+  DeviceTensorPtr somas_block_;
 };
 
 using SuperKernelActorPtr = std::shared_ptr<SuperKernelActor>;
@@ -155,6 +155,55 @@ bool HasMonadInput(const CNodePtr &cnode) {
   return false;
 }
 
+// Whether the graph is launched by the linear plan of super kernel actor, only the static graph on CPU without the
+// communication, control flow and the nodes which need the dedicated actors is supported. The linear plan runs the
+// kernels on the offsets assigned by somas, so the graph must be assigned by somas before.
+bool EnableLinearPlan(const KernelGraphPtr &graph, const DeviceContext *device_context) {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(device_context);
+  const auto &linear_plan = common::GetEnv(kCPULinearPlan);
+  if (linear_plan.empty() || (linear_plan == "0")) {
+    return false;
+  }
+  if (graph->somas_whole_block_size() == 0) {
+    MS_LOG(WARNING) << "The graph " << graph->graph_id() << " is not assigned by somas, which needs the "
+                    << "memory_optimize_level O1, and it can't be launched by the linear plan.";
+    return false;
+  }
+  if ((device_context->GetDeviceType() != device::DeviceType::kCPU) || graph->is_graph_run_mode() ||
+      graph->is_dynamic_shape() || graph->summary_node_exist() || graph->has_flag(kFlagsIsCutGraph) ||
+      graph->execution_order().empty()) {
+    return false;
+  }
+#ifndef ENABLE_SECURITY
+  if (DumpJsonParser::GetInstance().e2e_dump_enabled()) {
+    return false;
+  }
+#endif
+#ifdef ENABLE_DEBUGGER
+  if (Debugger::GetInstance()->DebuggerBackendEnabled()) {
+    return false;
+  }
+#endif
+#ifdef WITH_BACKEND
+  if (ps::PSContext::instance()->cache_enable()) {
+    return false;
+  }
+#endif
+
+  const auto &execution_order = graph->execution_order();
+  if (std::any_of(execution_order.begin(), execution_order.end(), [](const CNodePtr &kernel) {
+        return common::AnfAlgo::IsCommunicationOp(kernel) || IsRpcActor(kernel) ||
+               IsDeviceQueueDSActor(kernel, GraphExecutionStrategy::kPipeline) ||
+               common::AnfAlgo::IsDynamicShape(kernel);
+      })) {
+    return false;
+  }
+  const auto &all_nodes = TopoSort(graph->get_return());
+  return std::none_of(all_nodes.begin(), all_nodes.end(),
+                      [](const AnfNodePtr &node) { return AnfUtils::IsCustomActorNode(node); });
+}
+
 // Collect all nopnodes which are input of kernel that not support multi-thread execute.
 std::set<CNodePtr> FetchNopNodeNotSupportEliminate(const KernelGraph *const graph) {
   MS_EXCEPTION_IF_NULL(graph);
@@ -331,6 +380,13 @@ GraphId GraphCompiler::CompileGraph(const GraphSegmentPtr &segment, const AnfNod
     }
   }
 
+  // The graph launched by the linear plan is scheduled as the sink graph, which is launched by the super kernel actor.
+  if ((!run_in_pynative) && EnableLinearPlan(graph, device_context)) {
+    MS_LOG(INFO) << "The graph " << graph_id << " is launched by the linear plan.";
+    graph->set_run_mode(device::RunMode::kGraphMode);
+    graph->set_flag(kFlagLinearPlan, true);
+  }
+
   MS_LOG(INFO) << "Status record: end compile graph. graph id: " << graph_id;
   return graph_id;
 }
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_MSG_H
 #define MINDSPORE_CORE_MINDRT_INCLUDE_ACTOR_MSG_H
 
+#include <new>
 #include <utility>
 #include <string>
 
@@ -24,7 +25,7 @@
 
 namespace mindspore {
 class ActorBase;
-class MessageBase {
+class MS_CORE_API MessageBase {
  public:
   enum class Type : char {
     KMSG = 1,
@@ -73,6 +74,12 @@ class MessageBase {
 
   virtual void Run(ActorBase *actor) {}
 
+  // The msgs are allocated from the pool cached by each thread, since they are allocated and freed frequently.
+  static void *operator new(size_t size);
+  static void *operator new(size_t size, const std::nothrow_t &) noexcept;
+  static void operator delete(void *ptr, size_t size) noexcept;
+  static void operator delete(void *ptr, const std::nothrow_t &) noexcept;
+
   friend class ActorBase;
   friend class TCPMgr;
   AID from;
@@ -85,6 +92,9 @@ class MessageBase {
   size_t size;
 
   Type type;
+
+  // The next msg in the mailbox which links the msgs intrusively.
+  MessageBase *next = nullptr;
 };
 }  // namespace mindspore
 
@@ -70,6 +70,68 @@ std::list<std::unique_ptr<MessageBase>> *NonblockingMailBox::GetMsgs() {
   return ret;
 }
 
+MpscMailBox::~MpscMailBox() {
+  auto msgs = head.exchange(nullptr);
+  if (msgs == Released()) {
+    msgs = nullptr;
+  }
+  for (auto list : {batch, msgs}) {
+    while (list != nullptr) {
+      std::unique_ptr<MessageBase> msg(list);
+      list = list->next;
+    }
+  }
+  batch = nullptr;
+}
+
+int MpscMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  MessageBase *msgPtr = msg.release();
+  MessageBase *oldHead = head.load(std::memory_order_relaxed);
+  do {
+    msgPtr->next = (oldHead == Released()) ? nullptr : oldHead;
+  } while (!head.compare_exchange_weak(oldHead, msgPtr, std::memory_order_release, std::memory_order_relaxed));
+  if (oldHead == Released() && notifyHook) {
+    (*notifyHook.get())();
+  }
+  return 0;
+}
+
+MessageBase *MpscMailBox::TakeAllMsgs() {
+  MessageBase *msgs = head.load(std::memory_order_acquire);
+  while (msgs == nullptr) {
+    // only the consumer releases the mailbox, so it fails only if a msg is enqueued.
+    if (head.compare_exchange_weak(msgs, Released(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+      return nullptr;
+    }
+  }
+  if (msgs == Released()) {
+    return nullptr;
+  }
+  msgs = head.exchange(nullptr, std::memory_order_acquire);
+  // reverse the msgs to the enqueue order
+  MessageBase *ret = nullptr;
+  while (msgs != nullptr) {
+    MessageBase *next = msgs->next;
+    msgs->next = ret;
+    ret = msgs;
+    msgs = next;
+  }
+  return ret;
+}
+
+std::unique_ptr<MessageBase> MpscMailBox::GetMsg() {
+  if (batch == nullptr) {
+    batch = TakeAllMsgs();
+    if (batch == nullptr) {
+      return nullptr;
+    }
+  }
+  std::unique_ptr<MessageBase> msg(batch);
+  batch = batch->next;
+  msg->next = nullptr;
+  return msg;
+}
+
 int HQueMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
   bool empty = mailbox.Empty();
   MessageBase *msgPtr = msg.release();
@@ -16,6 +16,7 @@
 
 #ifndef MINDSPORE_MAILBOX_H
 #define MINDSPORE_MAILBOX_H
+#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -82,6 +83,29 @@ class NonblockingMailBox : public MailBox {
   bool released_ = true;
 };
 
+// lock-free multiple producers single consumer mailbox, the msgs are linked intrusively by MessageBase::next.
+// the producers push the msgs to the head, and the consumer takes all the enqueued msgs at once and gets them one by one.
+class MpscMailBox : public MailBox {
+ public:
+  MpscMailBox() : head(Released()) { takeAllMsgsEachTime = false; }
+  virtual ~MpscMailBox();
+  int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
+  std::list<std::unique_ptr<MessageBase>> *GetMsgs() override { return nullptr; }
+  // the mailbox is released if there is no msg, and the next enqueued msg invokes the notify hook.
+  std::unique_ptr<MessageBase> GetMsg() override;
+  // take all the enqueued msgs linked in the enqueue order.
+  MessageBase *TakeAllMsgs();
+
+ private:
+  // the head is tagged as released instead of a msg when the consumer finds no msg.
+  inline MessageBase *Released() { return reinterpret_cast<MessageBase *>(&releasedTag); }
+
+  std::atomic<MessageBase *> head;
+  // the msgs taken by the consumer but not got yet.
+  MessageBase *batch = nullptr;
+  char releasedTag = 0;
+};
+
 class HQueMailBox : public MailBox {
  public:
   HQueMailBox() { takeAllMsgsEachTime = false; }
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "actor/msg.h"
+#include <vector>
+
+namespace mindspore {
+namespace {
+// the msgs are cached by the size aligned to kMsgAlignSize, and the larger ones are not cached.
+constexpr size_t kMsgAlignSize = 64;
+constexpr size_t kMsgBucketNum = 8;
+constexpr size_t kMsgMaxCacheNum = 256;
+
+class MsgPool {
+ public:
+  MsgPool() { state = kAlive; }
+  ~MsgPool() {
+    state = kDestroyed;
+    for (auto &bucket : buckets_) {
+      for (auto ptr : bucket) {
+        ::operator delete(ptr);
+      }
+      bucket.clear();
+    }
+  }
+
+  void *Alloc(size_t index) {
+    auto &bucket = buckets_[index];
+    if (bucket.empty()) {
+      return ::operator new((index + 1) * kMsgAlignSize);
+    }
+    void *ptr = bucket.back();
+    bucket.pop_back();
+    return ptr;
+  }
+
+  void Free(void *ptr, size_t index) {
+    auto &bucket = buckets_[index];
+    if (bucket.size() >= kMsgMaxCacheNum) {
+      ::operator delete(ptr);
+      return;
+    }
+    bucket.push_back(ptr);
+  }
+
+  // the msgs may be allocated or freed by the destructors of other thread local objects after the pool is destroyed.
+  enum State { kUninitialized, kAlive, kDestroyed };
+  static thread_local State state;
+
+  static MsgPool *Get() {
+    if (state == kDestroyed) {
+      return nullptr;
+    }
+    static thread_local MsgPool pool;
+    return &pool;
+  }
+
+ private:
+  std::vector<void *> buckets_[kMsgBucketNum];
+};
+thread_local MsgPool::State MsgPool::state = MsgPool::kUninitialized;
+
+size_t MsgBucketIndex(size_t size) { return size == 0 ? 0 : (size - 1) / kMsgAlignSize; }
+}  // namespace
+
+void *MessageBase::operator new(size_t size) {
+  size_t index = MsgBucketIndex(size);
+  if (index >= kMsgBucketNum) {
+    return ::operator new(size);
+  }
+  auto pool = MsgPool::Get();
+  if (pool == nullptr) {
+    return ::operator new((index + 1) * kMsgAlignSize);
+  }
+  return pool->Alloc(index);
+}
+
+void *MessageBase::operator new(size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return MessageBase::operator new(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void MessageBase::operator delete(void *ptr, size_t size) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  size_t index = MsgBucketIndex(size);
+  auto pool = index < kMsgBucketNum ? MsgPool::Get() : nullptr;
+  if (pool == nullptr) {
+    ::operator delete(ptr);
+    return;
+  }
+  pool->Free(ptr, index);
+}
+
+void MessageBase::operator delete(void *ptr, const std::nothrow_t &) noexcept { ::operator delete(ptr); }
+}  // namespace mindspore
@@ -23,6 +23,15 @@
 namespace mindspore {
 std::mutex ThreadPool::create_thread_pool_muntex_;
 
+namespace {
+// run the task split with its own scales, whichever worker it is stolen by
+void RunTaskSplit(TaskSplit *task_split) {
+  auto task = task_split->task_;
+  task->status |= task->func(task->content, task_split->task_id_, task_split->lhs_scale_, task_split->rhs_scale_);
+  (void)++task->finished;
+}
+}  // namespace
+
 Worker::~Worker() {
   {
     std::lock_guard<std::mutex> _l(mutex_);
@@ -140,9 +149,24 @@ bool Worker::RunLocalKernelTask() {
     auto task_split = local_task_queue_->Dequeue();
     res |= TryRunTask(task_split);
   }
+  if (!res) {
+    res = RunStealTask();
+  }
   return res;
 }
 
+bool Worker::RunStealTask() {
+  if (pool_ == nullptr) {
+    return false;
+  }
+  auto task_split = pool_->StealTask(worker_id_);
+  if (task_split == nullptr) {
+    return false;
+  }
+  RunTaskSplit(task_split);
+  return true;
+}
+
 void Worker::RunOtherKernelTask() {
   if (pool_ == nullptr || pool_->actor_thread_num() <= kMinActorRunOther) {
     return;
@@ -275,13 +299,16 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
     (void)task_list.emplace_back(TaskSplit{&task, i});
   }
   Worker *curr = CurrentWorker();
-  DistributeTask(&task_list, &task, task_num, curr);
+  if (curr != nullptr) {
+    // the current thread is a worker, which may be running a task split of the outer ParallelLaunch,
+    // its task splits are balanced by the idle workers stealing them
+    RunTaskBySteal(&task_list, &task, task_num, curr);
+  } else {
+    DistributeTask(&task_list, &task, task_num, curr);
+  }
   // synchronization
   // wait until the finished is equal to task_num
   while (task.finished != task_num) {
-    if (curr != nullptr) {
-      (void)curr->RunLocalKernelTask();
-    }
     std::this_thread::yield();
   }
   // check the return value of task
@@ -352,6 +379,75 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
   ActiveWorkers(assigned, task_list, task_num, curr);
 }
 
+void ThreadPool::RunTaskBySteal(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr) {
+  float per_scale = kMaxScale / task_num;
+  for (int i = 0; i < task_num; ++i) {
+    auto &task_split = (*task_list)[i];
+    task_split.lhs_scale_ = i * per_scale;
+    task_split.rhs_scale_ = i == task_num - 1 ? kMaxScale : (i + 1) * per_scale;
+  }
+  // push the splits in reverse order, so the current worker pops them from the first one
+  // and the thieves steal them from the last one
+  auto steal_queue = curr->steal_queue();
+  int unpushed_end = task_num;
+  for (; unpushed_end > 1; --unpushed_end) {
+    if (!steal_queue->Push(&(*task_list)[unpushed_end - 1])) {
+      break;
+    }
+  }
+  int pushed_num = task_num - unpushed_end;
+  steal_task_num_ += pushed_num;
+  ActiveStealWorkers(pushed_num, curr);
+
+  // run the splits which are not pushed since the steal queue is full
+  for (int i = 0; i < unpushed_end; ++i) {
+    RunTaskSplit(&(*task_list)[i]);
+  }
+  // the splits of this task are at the bottom of steal queue,
+  // and the splits of the outer tasks are under them, which are left to the outer ParallelLaunch
+  while (true) {
+    auto task_split = steal_queue->Pop();
+    if (task_split == nullptr) {
+      break;
+    }
+    if (task_split->task_ != task) {
+      (void)steal_queue->Push(task_split);
+      break;
+    }
+    --steal_task_num_;
+    RunTaskSplit(task_split);
+  }
+}
+
+void ThreadPool::ActiveStealWorkers(int worker_num, const Worker *curr) const {
+  int offset = occupied_actor_thread_ ? 0 : static_cast<int>(actor_thread_num_);
+  int count = 0;
+  for (int i = static_cast<int>(workers_.size()) - 1; i >= offset && count < worker_num; --i) {
+    if (workers_[i] != curr && workers_[i]->available()) {
+      workers_[i]->Active();
+      (void)++count;
+    }
+  }
+}
+
+TaskSplit *ThreadPool::StealTask(size_t thief_id) {
+  if (steal_task_num_.load(std::memory_order_relaxed) <= 0) {
+    return nullptr;
+  }
+  if (!occupied_actor_thread_ && thief_id < actor_thread_num_) {
+    return nullptr;
+  }
+  size_t worker_num = workers_.size();
+  for (size_t i = 1; i < worker_num; ++i) {
+    auto task_split = workers_[(thief_id + i) % worker_num]->steal_queue()->Steal();
+    if (task_split != nullptr) {
+      --steal_task_num_;
+      return task_split;
+    }
+  }
+  return nullptr;
+}
+
 void ThreadPool::CalculateScales(const std::vector<Worker *> &assigned, int sum_frequency) const {
   // divide task according to computing power(core frequency)
   float lhs_scale = 0;
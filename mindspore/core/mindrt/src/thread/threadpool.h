@@ -37,6 +37,7 @@
 #endif
 #include "utils/macros.h"
 #include "thread/hqueue.h"
+#include "thread/work_steal_queue.h"
 
 #define USE_HQUEUE
 namespace mindspore {
@@ -72,12 +73,17 @@ typedef struct TaskSplit {
   TaskSplit(Task *task, int task_id) : task_(task), task_id_(task_id) {}
   Task *task_;
   int task_id_;
+  // the scales of the task split which may be stolen by any worker
+  float lhs_scale_{0.};
+  float rhs_scale_{kMaxScale};
 } TaskSplit;
 
 class ThreadPool;
 class Worker {
  public:
-  explicit Worker(ThreadPool *pool, size_t index) : pool_(pool), worker_id_(index) {}
+  explicit Worker(ThreadPool *pool, size_t index) : pool_(pool), worker_id_(index) {
+    (void)steal_queue_.Init(kMaxHqueueSize);
+  }
   virtual ~Worker();
   // create thread and start running at the same time
   virtual void CreateThread();
@@ -94,6 +100,8 @@ class Worker {
   virtual void RunOtherKernelTask();
   // try to run a single task
   bool TryRunTask(TaskSplit *task_split);
+  // try to steal a single task from the other workers and run it
+  bool RunStealTask();
   // set max spin count before running
   void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
@@ -106,6 +114,8 @@ class Worker {
   float lhs_scale() const { return lhs_scale_; }
   float rhs_scale() const { return rhs_scale_; }
   HQueue<TaskSplit> *local_task_queue() { return local_task_queue_; }
+  // the task splits of ParallelLaunch called by this worker, which are stolen by the other workers
+  WorkStealQueue<TaskSplit> *steal_queue() { return &steal_queue_; }
 
   std::thread::id thread_id() const { return thread_.get_id(); }
 
@@ -146,6 +156,7 @@ class Worker {
   int max_spin_count_{kMinSpinCount};
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_;
+  WorkStealQueue<TaskSplit> steal_queue_;
   size_t worker_id_{0};
 };
 
@@ -176,6 +187,8 @@ class MS_CORE_API ThreadPool {
   void SetMinSpinCount(int spin_count);
   void ActiveWorkers();
   void SetWorkerIdMap();
+  // steal a task split from the workers except the thief
+  TaskSplit *StealTask(size_t thief_id);
   // init task queues
   int TaskQueuesInit(size_t thread_num);
   const std::unordered_map<std::thread::id, size_t> &GetWorkerIdMap() const { return worker_ids_; }
@@ -217,6 +230,9 @@ class MS_CORE_API ThreadPool {
   int InitAffinityInfo();
 
   void DistributeTask(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr) const;
+  // push the task splits into the steal queue of current worker, and run them together with the idle workers
+  void RunTaskBySteal(std::vector<TaskSplit> *task_list, Task *task, int task_num, Worker *curr);
+  void ActiveStealWorkers(int worker_num, const Worker *curr) const;
   void CalculateScales(const std::vector<Worker *> &workers, int sum_frequency) const;
   void ActiveWorkers(const std::vector<Worker *> &workers, std::vector<TaskSplit> *task_list, int task_num,
                      const Worker *curr) const;
@@ -232,6 +248,8 @@ class MS_CORE_API ThreadPool {
   size_t actor_thread_num_{0};
   size_t kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  // the number of task splits in the steal queues
+  std::atomic_int steal_task_num_{0};
   int max_spin_count_{kDefaultSpinCount};
   int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -19,10 +19,18 @@
 #define MPOL_BIND 2
 #endif
 
+#include <dirent.h>
 #include <dlfcn.h>
 #include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
 #include "utils/log_adapter.h"
 
 #define RETURN_STATUS_UNEXPECTED(_e)                                \
@@ -39,6 +47,50 @@ struct bitmask {
 
 std::weak_ptr<void> g_numa_lib_handle;
 std::mutex g_numa_lib_handle_mutex;
+
+constexpr char kPciDevicesPath[] = "/sys/bus/pci/devices";
+constexpr int64_t kNvidiaVendorId = 0x10de;
+constexpr int64_t kHuaweiVendorId = 0x19e5;
+// pci base class codes
+constexpr int64_t kDisplayControllerClass = 0x03;
+constexpr int64_t kProcessingAcceleratorClass = 0x12;
+constexpr int kPciBaseClassShift = 16;
+constexpr int64_t kPciBaseClassMask = 0xff;
+
+// Read an integer from a sysfs file, both decimal and 0x prefixed hexadecimal are accepted.
+bool ReadSysfsInt(const std::string &path, int64_t *value) {
+  std::ifstream ifs(path);
+  std::string text;
+  if (!ifs.is_open() || !(ifs >> text)) {
+    return false;
+  }
+  char *end = nullptr;
+  errno = 0;
+  *value = strtoll(text.c_str(), &end, 0);
+  return errno == 0 && end != text.c_str() && *end == '\0';
+}
+
+// Map a logical device id to the index of the physical device through the visible devices env,
+// e.g. CUDA_VISIBLE_DEVICES=4,5,6,7 maps device 1 to the physical device 5.
+int32_t GetPhysicalDeviceId(const char *visible_devices_env, int32_t device_id) {
+  const char *visible_devices = getenv(visible_devices_env);
+  if (visible_devices == nullptr || *visible_devices == '\0') {
+    return device_id;
+  }
+  std::vector<int32_t> ids;
+  std::stringstream ss(visible_devices);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    char *end = nullptr;
+    int64_t id = strtoll(item.c_str(), &end, 10);
+    if (end == item.c_str() || *end != '\0' || id < 0) {
+      // device uuids are not supported, assume the devices are in pci order
+      return device_id;
+    }
+    ids.push_back(static_cast<int32_t>(id));
+  }
+  return device_id < static_cast<int32_t>(ids.size()) ? ids[device_id] : -1;
+}
 }  // namespace
 
 inline void *LoadLibrary(const char *name) {
@@ -80,7 +132,9 @@ std::shared_ptr<void> GetNumaAdapterHandle() {
   return shared;
 }
 
-Status NumaBind(void *handle, const int32_t &rank_id) {
+namespace {
+// Check the handle and get the max numa node id of the host.
+Status GetNumaMaxNode(void *handle, int *numa_node_max_id) {
   if (handle == nullptr) {
     RETURN_STATUS_UNEXPECTED("Numa package not found.");
   }
@@ -88,6 +142,36 @@ Status NumaBind(void *handle, const int32_t &rank_id) {
   if (numa_max_node_func == nullptr) {
     RETURN_STATUS_UNEXPECTED("Numa api: numa_max_node not found.");
   }
+  auto numa_max_node = (int (*)(void))(numa_max_node_func);
+  *numa_node_max_id = numa_max_node();
+  if (*numa_node_max_id < 0) {
+    RETURN_STATUS_UNEXPECTED("Get numa max node failed.");
+  }
+  return Status::OK();
+}
+}  // namespace
+
+Status NumaBind(void *handle, const int32_t &rank_id) {
+  if (rank_id < 0) {
+    RETURN_STATUS_UNEXPECTED("Value error, rank_id is a negative value.");
+  }
+  int numa_node_max_id = -1;
+  auto ret = GetNumaMaxNode(handle, &numa_node_max_id);
+  if (ret != Status::OK()) {
+    return ret;
+  }
+  return NumaBindNode(handle, rank_id % (numa_node_max_id + 1));
+}
+
+Status NumaBindNode(void *handle, const int32_t &numa_node) {
+  int numa_node_max_id = -1;
+  auto ret = GetNumaMaxNode(handle, &numa_node_max_id);
+  if (ret != Status::OK()) {
+    return ret;
+  }
+  if (numa_node < 0 || numa_node > numa_node_max_id) {
+    RETURN_STATUS_UNEXPECTED("Value error, numa node " + std::to_string(numa_node) + " does not exist.");
+  }
   auto numa_allocate_nodemask_func = GetNumaAdapterFunc(handle, "numa_allocate_nodemask");
   if (numa_allocate_nodemask_func == nullptr) {
     RETURN_STATUS_UNEXPECTED("Numa api: numa_allocate_nodemask not found.");
@@ -117,7 +201,6 @@ Status NumaBind(void *handle, const int32_t &rank_id) {
   if (numa_bitmask_free_func == nullptr) {
     RETURN_STATUS_UNEXPECTED("Numa api: numa_bitmask_free not found.");
   }
-  auto numa_max_node = (int (*)(void))(numa_max_node_func);
   auto numa_allocate_nodemask = (struct bitmask * (*)(void))(numa_allocate_nodemask_func);
   auto numa_bitmask_clearall = (struct bitmask * (*)(struct bitmask *))(numa_bitmask_clearall_func);
   auto numa_bitmask_setbit = (struct bitmask * (*)(struct bitmask *, unsigned int))(numa_bitmask_setbit_func);
@@ -125,34 +208,71 @@ Status NumaBind(void *handle, const int32_t &rank_id) {
   auto set_mempolicy = (int (*)(int, const uint64_t *, uint64_t))(set_mempolicy_func);
   auto numa_set_membind = (void (*)(struct bitmask *))(numa_set_membind_func);
   auto numa_bitmask_free = (void (*)(struct bitmask *))(numa_bitmask_free_func);
-  int numa_node_max_id = numa_max_node();
-  if (numa_node_max_id < 0) {
-    RETURN_STATUS_UNEXPECTED("Get numa max node failed.");
+  uint32_t numa_bind_id = static_cast<uint32_t>(numa_node);
+  auto bm = numa_allocate_nodemask();
+  numa_bitmask_clearall(bm);
+  numa_bitmask_setbit(bm, numa_bind_id);
+  if (numa_run_on_node_mask(bm) < 0) {
+    MS_LOG(WARNING) << "Try to bind numa id: " << numa_bind_id
+                    << ", but execute numa_run_on_node_mask failed, errno: " << strerror(errno)
+                    << ". Please use mindspore.dataset.config.set_numa_enable(False) to disable numa bind.";
+    numa_bitmask_free(bm);
+    return Status::OK();
   }
-  if (rank_id >= 0) {
-    uint32_t numa_bind_id = static_cast<uint32_t>(rank_id % (numa_node_max_id + 1));
-    auto bm = numa_allocate_nodemask();
-    numa_bitmask_clearall(bm);
-    numa_bitmask_setbit(bm, numa_bind_id);
-    if (numa_run_on_node_mask(bm) < 0) {
-      MS_LOG(WARNING) << "Try to bind numa id: " << numa_bind_id
-                      << ", but execute numa_run_on_node_mask failed, errno: " << strerror(errno)
-                      << ". Please use mindspore.dataset.config.set_numa_enable(False) to disable numa bind.";
-      numa_bitmask_free(bm);
-      return Status::OK();
-    }
-    if (set_mempolicy(MPOL_BIND, bm->maskp, bm->size + 1) < 0) {
-      MS_LOG(WARNING) << "Try to bind numa id: " << numa_bind_id
-                      << ", but execute set_mempolicy failed, errno: " << strerror(errno)
-                      << ". Please use mindspore.dataset.config.set_numa_enable(False) to disable numa bind.";
-      numa_bitmask_free(bm);
-      return Status::OK();
-    }
-    numa_set_membind(bm);
+  if (set_mempolicy(MPOL_BIND, bm->maskp, bm->size + 1) < 0) {
+    MS_LOG(WARNING) << "Try to bind numa id: " << numa_bind_id
+                    << ", but execute set_mempolicy failed, errno: " << strerror(errno)
+                    << ". Please use mindspore.dataset.config.set_numa_enable(False) to disable numa bind.";
     numa_bitmask_free(bm);
-  } else {
-    RETURN_STATUS_UNEXPECTED("Value error, rank_id is a negative value.");
+    return Status::OK();
   }
+  numa_set_membind(bm);
+  numa_bitmask_free(bm);
   return Status::OK();
 }
+
+int32_t GetDeviceNumaNode(const int32_t &device_id) {
+  if (device_id < 0) {
+    return -1;
+  }
+  DIR *dir = opendir(kPciDevicesPath);
+  if (dir == nullptr) {
+    return -1;
+  }
+  // numa node of the accelerators by pci address, devices are numbered in pci address order
+  std::map<std::string, int64_t> gpu_nodes;
+  std::map<std::string, int64_t> npu_nodes;
+  struct dirent *entry = nullptr;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string address = entry->d_name;
+    if (address.empty() || address[0] == '.') {
+      continue;
+    }
+    std::string device_path = std::string(kPciDevicesPath) + "/" + address;
+    int64_t vendor = 0;
+    int64_t pci_class = 0;
+    int64_t numa_node = -1;
+    if (!ReadSysfsInt(device_path + "/vendor", &vendor) || !ReadSysfsInt(device_path + "/class", &pci_class) ||
+        !ReadSysfsInt(device_path + "/numa_node", &numa_node)) {
+      continue;
+    }
+    int64_t base_class = (pci_class >> kPciBaseClassShift) & kPciBaseClassMask;
+    if (vendor == kNvidiaVendorId && base_class == kDisplayControllerClass) {
+      gpu_nodes[address] = numa_node;
+    } else if (vendor == kHuaweiVendorId && base_class == kProcessingAcceleratorClass) {
+      npu_nodes[address] = numa_node;
+    }
+  }
+  (void)closedir(dir);
+  const auto &nodes = gpu_nodes.empty() ? npu_nodes : gpu_nodes;
+  int32_t physical_id = GetPhysicalDeviceId(gpu_nodes.empty() ? "ASCEND_RT_VISIBLE_DEVICES" : "CUDA_VISIBLE_DEVICES",
+                                            device_id);
+  if (physical_id < 0 || physical_id >= static_cast<int32_t>(nodes.size())) {
+    return -1;
+  }
+  auto it = nodes.begin();
+  std::advance(it, physical_id);
+  // numa_node is -1 if the platform does not report the locality
+  return static_cast<int32_t>(it->second);
+}
 }  // namespace mindspore
@@ -30,5 +30,14 @@ MS_CORE_API std::shared_ptr<void> GetNumaAdapterHandle();
 // 1. Get function pointer of numa api
 // 2. Do numa_bind
 MS_CORE_API Status NumaBind(void *handle, const int32_t &rank_id);
+
+// Same as NumaBind, but bind to the given numa node instead of
+// choosing one from the rank_id.
+MS_CORE_API Status NumaBindNode(void *handle, const int32_t &numa_node);
+
+// Get the numa node of the accelerator (gpu or npu) which is seen as
+// device_id by this process, from the pci devices in sysfs. Return -1
+// if the device or its numa node is unknown.
+MS_CORE_API int32_t GetDeviceNumaNode(const int32_t &device_id);
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_UTILS_NUMA_INTERFACE_H_
@@ -45,7 +45,16 @@ __all__ = ['set_sending_batches', 'load', '_init_device_info',
            'set_autotune_interval', 'get_autotune_interval',
            'set_auto_offload', 'get_auto_offload',
            'set_enable_watchdog', 'get_enable_watchdog',
-           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval']
+           'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval',
+           'set_enable_mindrecord_mmap', 'get_enable_mindrecord_mmap',
+           'set_enable_lock_free_queue', 'get_enable_lock_free_queue',
+           'set_enable_jpeg_scaled_decode', 'get_enable_jpeg_scaled_decode',
+           'set_enable_autotune_cost_model', 'get_enable_autotune_cost_model',
+           'set_enable_seekable_shuffle', 'get_enable_seekable_shuffle',
+           'set_enable_row_tracing', 'get_enable_row_tracing',
+           'set_enable_row_block', 'get_enable_row_block',
+           'set_enable_csv_split', 'get_enable_csv_split',
+           'set_source_snapshot_dir', 'get_source_snapshot_dir']
 
 INT32_MAX = 2147483647
 UINT32_MAX = 4294967295
@@ -235,6 +244,10 @@ def set_numa_enable(numa_enable):
     """
     Set the default state of numa enabled. If numa_enable is True, need to ensure numa library is installed.
 
+    When enabled, the dataset pipeline threads and their memory are bound to the numa node which the device
+    fed by the pipeline is attached to. If the numa node of the device can not be found, the numa node is
+    chosen by the rank id.
+
     Args:
         numa_enable (bool): Whether to use numa bind feature.
 
@@ -799,3 +812,341 @@ def get_dynamic_shape():
         >>> is_dynamic_shape = ds.config.get_dynamic_shape()
     """
     return _config.get_dynamic_shape()
+
+
+def set_enable_mindrecord_mmap(enable):
+    """
+    Set the default state of MindRecord mmap read mode. If enabled, MindRecordDataset maps each MindRecord file
+    into memory once and reads blob data from the mapped region instead of opening one file stream per worker.
+
+    Note:
+        `set_enable_mindrecord_mmap` is not supported on Windows platform yet.
+
+    Args:
+        enable (bool): Whether to read MindRecord files through mmap. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable mmap read mode to reduce the copies and system calls when reading MindRecord files.
+        >>> ds.config.set_enable_mindrecord_mmap(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_mindrecord_mmap(enable)
+
+
+def get_enable_mindrecord_mmap():
+    """
+    Get the default state of MindRecord mmap read mode.
+
+    Returns:
+        bool, whether MindRecord files are read through mmap.
+
+    Examples:
+        >>> # Get the flag of MindRecord mmap read mode.
+        >>> mindrecord_mmap_flag = ds.config.get_enable_mindrecord_mmap()
+    """
+    return _config.get_enable_mindrecord_mmap()
+
+
+def set_enable_lock_free_queue(enable):
+    """
+    Set the default state of lock free worker queues. If enabled, the queues between the main thread, the worker
+    threads and the collector thread of parallel operations such as map and batch are lock free ring buffers,
+    which only fall back to a blocking wait after a short spin. This reduces the hand-off cost per row when rows
+    are small and the throughput is high.
+
+    Args:
+        enable (bool): Whether to use lock free worker queues. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable lock free worker queues for pipelines with many small rows.
+        >>> ds.config.set_enable_lock_free_queue(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_lock_free_queue(enable)
+
+
+def get_enable_lock_free_queue():
+    """
+    Get the default state of lock free worker queues.
+
+    Returns:
+        bool, whether parallel operations use lock free worker queues.
+
+    Examples:
+        >>> # Get the flag of lock free worker queues.
+        >>> lock_free_queue_flag = ds.config.get_enable_lock_free_queue()
+    """
+    return _config.get_enable_lock_free_queue()
+
+
+def set_enable_jpeg_scaled_decode(enable):
+    """
+    Set the default state of JPEG scaled decode. If enabled, RandomCropDecodeResize and the fused Decode and Resize
+    operation decode a JPEG image at the smallest DCT scale of 1/2, 1/4 or 1/8 which still keeps the (cropped)
+    image not smaller than the output size, instead of decoding it at full resolution. The output is close to but
+    not exactly the same as the output of a full resolution decode.
+
+    Args:
+        enable (bool): Whether to decode JPEG images at a reduced scale. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable JPEG scaled decode to reduce the decode cost of large images which are resized to a small size.
+        >>> ds.config.set_enable_jpeg_scaled_decode(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_jpeg_scaled_decode(enable)
+
+
+def get_enable_jpeg_scaled_decode():
+    """
+    Get the default state of JPEG scaled decode.
+
+    Returns:
+        bool, whether JPEG images may be decoded at a reduced scale.
+
+    Examples:
+        >>> # Get the flag of JPEG scaled decode.
+        >>> jpeg_scaled_decode_flag = ds.config.get_enable_jpeg_scaled_decode()
+    """
+    return _config.get_enable_jpeg_scaled_decode()
+
+
+def set_enable_autotune_cost_model(enable):
+    """
+    Set whether AutoTune tunes the data pipeline with a cost model. If enabled, AutoTune estimates how much CPU
+    each operation needs per batch from the profiling data, and sets the number of workers and the prefetch size of
+    all operations at once to reach the speed the device needs within the CPU budget, instead of stepping them up
+    a little each time. This option only takes effect when AutoTune is enabled.
+
+    Args:
+        enable (bool): Whether AutoTune uses the cost model. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable the cost model of AutoTune to let it converge faster.
+        >>> ds.config.set_enable_autotune(True)
+        >>> ds.config.set_enable_autotune_cost_model(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_autotune_cost_model(enable)
+
+
+def get_enable_autotune_cost_model():
+    """
+    Get whether AutoTune tunes the data pipeline with a cost model.
+
+    Returns:
+        bool, whether AutoTune uses the cost model.
+
+    Examples:
+        >>> # Get the flag of the AutoTune cost model.
+        >>> autotune_cost_model_flag = ds.config.get_enable_autotune_cost_model()
+    """
+    return _config.get_enable_autotune_cost_model()
+
+
+def set_enable_seekable_shuffle(enable):
+    """
+    Set whether RandomSampler shuffles the rows with a seekable permutation. If enabled, the shuffled order of each
+    epoch is computed row by row from the seed and the epoch number instead of shuffling a list of all row indices, so
+    that when the pipeline is reset to a step, e.g. to resume training from a checkpoint, RandomSampler of a mappable
+    dataset and MindDataset start directly from the row of that step instead of reading and dropping the rows before
+    it. Shuffled DistributedSampler also permutes the rows of each epoch this way, so that neither sampler allocates
+    a list of all row indices. This option only changes the order of the rows when RandomSampler draws without
+    replacement or DistributedSampler shuffles.
+
+    Args:
+        enable (bool): Whether RandomSampler uses a seekable permutation. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable the seekable shuffle to let the pipeline resume from any step without replaying the data.
+        >>> ds.config.set_enable_seekable_shuffle(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_seekable_shuffle(enable)
+
+
+def get_enable_seekable_shuffle():
+    """
+    Get whether RandomSampler shuffles the rows with a seekable permutation.
+
+    Returns:
+        bool, whether RandomSampler uses a seekable permutation.
+
+    Examples:
+        >>> # Get the flag of the seekable shuffle.
+        >>> seekable_shuffle_flag = ds.config.get_enable_seekable_shuffle()
+    """
+    return _config.get_enable_seekable_shuffle()
+
+
+def set_enable_row_tracing(enable):
+    """
+    Set whether the profiler traces how long each row stays in each operation of the pipeline. If enabled, rows are
+    stamped with the time they enter an operation, and the latency from entering to leaving the operation is kept in
+    a histogram per operation. The p50 and p99 latencies of each operation are saved together with the other profiling
+    data as a Chrome trace file `row_tracing_<rank_id>.json`, which can be opened by chrome://tracing or Perfetto.
+    This option only takes effect when profiling of the dataset pipeline is enabled.
+
+    Args:
+        enable (bool): Whether to trace the latency of the rows. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable the row tracing to find the operation which the rows wait for the longest.
+        >>> ds.config.set_enable_row_tracing(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_row_tracing(enable)
+
+
+def get_enable_row_tracing():
+    """
+    Get whether the profiler traces how long each row stays in each operation of the pipeline.
+
+    Returns:
+        bool, whether the row tracing is enabled.
+
+    Examples:
+        >>> # Get the flag of the row tracing.
+        >>> row_tracing_flag = ds.config.get_enable_row_tracing()
+    """
+    return _config.get_enable_row_tracing()
+
+
+def set_enable_row_block(enable):
+    """
+    Set whether CSVDataset carries its rows as row blocks into a batch. If enabled, when a batch without padding,
+    per_batch_map or a batch size function is built on CSVDataset, and the operations between them are only maps of
+    elementwise operations such as TypeCast, projects and renames, each worker of CSVDataset sends the values of as
+    many rows as the batch size together as one column per row block, instead of one tensor per field. This saves
+    building and concatenating the tensors of every single row. The rows of a worker stay in order, but when
+    CSVDataset reads with several workers, the rows of the workers are interleaved block by block instead of row by
+    row, so the rows in a batch differ from the rows in the same batch when this option is disabled.
+
+    Args:
+        enable (bool): Whether to carry the rows of CSVDataset as row blocks. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable the row blocks to speed up batching the columns of large CSV files.
+        >>> ds.config.set_enable_row_block(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_row_block(enable)
+
+
+def get_enable_row_block():
+    """
+    Get whether CSVDataset carries its rows as row blocks into a batch.
+
+    Returns:
+        bool, whether the row blocks are enabled.
+
+    Examples:
+        >>> # Get the flag of the row blocks.
+        >>> row_block_flag = ds.config.get_enable_row_block()
+    """
+    return _config.get_enable_row_block()
+
+
+def set_enable_csv_split(enable):
+    """
+    Set whether CSVDataset splits a large file across its workers. If enabled, a file larger than 16MB is cut into
+    ranges of about 16MB at row boundaries, and the ranges are read by different workers, so that a single large file
+    is parsed by several threads. The rows of a range stay in order, but the rows of the ranges are interleaved, so
+    even with `shuffle` set to False the rows of a large file are no longer returned in file order.
+
+    Args:
+        enable (bool): Whether to split large files of CSVDataset across the workers. Default: False
+
+    Raises:
+        TypeError: If `enable` is not a boolean data type.
+
+    Examples:
+        >>> # Enable the split to read a single large CSV file with several workers.
+        >>> ds.config.set_enable_csv_split(True)
+    """
+    if not isinstance(enable, bool):
+        raise TypeError("enable must be of type bool.")
+    _config.set_enable_csv_split(enable)
+
+
+def get_enable_csv_split():
+    """
+    Get whether CSVDataset splits a large file across its workers.
+
+    Returns:
+        bool, whether the split of large files is enabled.
+
+    Examples:
+        >>> # Get the flag of the split of large CSV files.
+        >>> csv_split_flag = ds.config.get_enable_csv_split()
+    """
+    return _config.get_enable_csv_split()
+
+
+def set_source_snapshot_dir(snapshot_dir):
+    """
+    Set the directory where source datasets keep the metadata of their inputs between launches. If set,
+    ImageFolderDataset saves the file list of its folders, and CocoDataset saves the index parsed from its annotation
+    file, so that the next pipeline reading the same inputs starts without scanning the folders or parsing the
+    annotation file again. A snapshot records the size and the modification time of the files and folders it is built
+    from, and it is built again once any of them has changed. Snapshots of the same dataset can be shared by pipelines
+    on different devices.
+
+    Args:
+        snapshot_dir (str): The directory of the snapshots, which is created if it does not exist. An empty string
+            disables the snapshots. Default: ''
+
+    Raises:
+        TypeError: If `snapshot_dir` is not of type str.
+
+    Examples:
+        >>> # Keep the file lists of the datasets to speed up the startup of the next evaluation.
+        >>> ds.config.set_source_snapshot_dir("/path/to/snapshot_dir")
+    """
+    if not isinstance(snapshot_dir, str):
+        raise TypeError("snapshot_dir must be of type str.")
+    if snapshot_dir:
+        snapshot_dir = os.path.realpath(snapshot_dir)
+    _config.set_source_snapshot_dir(snapshot_dir)
+
+
+def get_source_snapshot_dir():
+    """
+    Get the directory where source datasets keep the metadata of their inputs between launches.
+
+    Returns:
+        str, the directory of the snapshots, or an empty string if the snapshots are disabled.
+
+    Examples:
+        >>> # Get the directory of the source snapshots.
+        >>> snapshot_dir = ds.config.get_source_snapshot_dir()
+    """
+    return _config.get_source_snapshot_dir()
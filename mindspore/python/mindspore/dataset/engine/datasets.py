@@ -2730,6 +2730,8 @@ class _PythonCallable:
         self.pool = pool
         # Python callable index
         self.idx = idx
+        # The inputs are only copied to the worker processes, so they can be passed as read-only views of the tensors
+        self.zero_copy_inputs = True
 
     def __call__(self, *args):
         result = None
@@ -2740,6 +2742,9 @@ class _PythonCallable:
                 pass
         if result is None:
             # Invoke original Python callable in master process in case the pool is gone.
+            # The callable may modify its inputs, so the read-only views are copied.
+            args = tuple(np.copy(arg) if isinstance(arg, np.ndarray) and not arg.flags.writeable else arg
+                         for arg in args)
             result = self.py_callable(*args)
         return result
 
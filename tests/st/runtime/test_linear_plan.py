@@ -0,0 +1,116 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import glob
+import os
+import re
+import numpy as np
+import pytest
+import mindspore
+from mindspore import context, ops, nn, Tensor, Parameter
+
+
+class NetWithAssign(nn.Cell):
+    def __init__(self):
+        super().__init__()
+        self.relu = ops.ReLU()
+        self.add = ops.Add()
+        self.mul = ops.Mul()
+        self.assign = ops.Assign()
+        self.param = Parameter(Tensor(np.ones(4), mindspore.float32), name="param")
+
+    def construct(self, input_x1, input_x2):
+        output1 = self.relu(input_x1)
+        output2 = self.relu(input_x2)
+        for _ in range(10):
+            output1 = self.add(output1, 1)
+            output2 = self.mul(output2, 2)
+        self.assign(self.param, self.add(self.param, output1))
+        return self.add(output1, output2), self.param
+
+
+def run_net(linear_plan):
+    if linear_plan is not None:
+        os.environ['MS_CPU_LINEAR_PLAN'] = linear_plan
+    try:
+        net = NetWithAssign()
+        input_x1 = Tensor(np.array([-1, 0, 1, 2]), mindspore.float32)
+        input_x2 = Tensor(np.array([1, 2, 3, 4]), mindspore.float32)
+        outputs = []
+        for _ in range(3):
+            output, param = net(input_x1, input_x2)
+            outputs.append((output.asnumpy(), param.asnumpy()))
+        return outputs
+    finally:
+        os.environ.pop('MS_CPU_LINEAR_PLAN', None)
+
+
+def check_outputs(outputs, expects):
+    assert len(outputs) == len(expects)
+    for (output, param), (expect_output, expect_param) in zip(outputs, expects):
+        assert np.allclose(output, expect_output)
+        assert np.allclose(param, expect_param)
+
+
+def read_somas_tensors(save_graphs_path):
+    """Read the aligned sizes and the offsets of the tensors from the somas offsets saved with the graphs."""
+    files = glob.glob(os.path.join(save_graphs_path, "**", "CPU_somas_tensor_offset_*.ir"), recursive=True)
+    assert len(files) == 1
+    tensors = []
+    with open(files[0], "r") as f:
+        for line in f:
+            match = re.match(r"^%\d+T\t#(\d+)S\t#\d+S\t&(\d+)\t", line)
+            if match:
+                tensors.append((int(match.group(1)), int(match.group(2))))
+    return tensors
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+@pytest.mark.parametrize('linear_plan', ['1', 'parallel'])
+def test_linear_plan(linear_plan, tmp_path):
+    """
+    Feature: Launch the static graph on CPU by the linear plan of super kernel actor.
+    Description: Run the net with the independent branches and the assign of parameter for several steps with the
+        memory_optimize_level O1, which lets somas assign the offsets that the linear plan runs on.
+    Expectation: The outputs and the parameter are the same as the net launched by the kernel actors, and the somas
+        block is smaller than the tensors in it, which means the memory of the tensors is reused.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    expects = run_net(None)
+    context.set_context(memory_optimize_level="O1", save_graphs=True, save_graphs_path=str(tmp_path))
+    try:
+        outputs = run_net(linear_plan)
+    finally:
+        context.set_context(memory_optimize_level="O0", save_graphs=False)
+    check_outputs(outputs, expects)
+
+    tensors = read_somas_tensors(str(tmp_path))
+    assert tensors
+    block_size = max(size + offset for size, offset in tensors)
+    assert block_size < sum(size for size, _ in tensors)
+
+
+@pytest.mark.level1
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_linear_plan_without_somas():
+    """
+    Feature: Launch the static graph on CPU by the linear plan of super kernel actor.
+    Description: Run the net with MS_CPU_LINEAR_PLAN set and the default memory_optimize_level O0, without somas.
+    Expectation: The graph falls back to the kernel actors and the outputs are the same.
+    """
+    context.set_context(mode=context.GRAPH_MODE, device_target="CPU")
+    check_outputs(run_net('1'), run_net(None))
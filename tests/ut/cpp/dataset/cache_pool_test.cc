@@ -0,0 +1,222 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/client.h"
+#include "minddata/dataset/engine/cache/cache_hw.h"
+#include "minddata/dataset/engine/cache/cache_numa.h"
+#include "minddata/dataset/engine/cache/cache_pool.h"
+#include "minddata/dataset/engine/cache/cache_server.h"
+#include "minddata/dataset/util/task_manager.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+constexpr size_t kRowSize = 4096;
+constexpr int32_t kNumWorkers = 2;
+// The memory pool is so small that every buffer is spilled to disk.
+constexpr float kSpillAllRatio = 0.0001;
+
+std::string MakeRow(CachePool::key_type key) { return std::string(kRowSize, static_cast<char>('a' + key % 26)); }
+
+Status InsertRow(CachePool *cp, CachePool::key_type key) {
+  auto row = MakeRow(key);
+  return cp->Insert(key, {ReadableSlice(row.data(), row.size())});
+}
+
+Status CheckRow(CachePool *cp, CachePool::key_type key) {
+  std::string buf(kRowSize, '\0');
+  WritableSlice dest(&buf[0], buf.size());
+  size_t bytes_read = 0;
+  RETURN_IF_NOT_OK(cp->Read(key, &dest, &bytes_read));
+  CHECK_FAIL_RETURN_UNEXPECTED(bytes_read == kRowSize && buf == MakeRow(key),
+                               "Wrong buffer of key " + std::to_string(key));
+  return Status::OK();
+}
+
+// The read ahead is done by the spill tasks in the background.
+bool WaitForStaged(CachePool *cp, CachePool::key_type key) {
+  constexpr int kMaxRetry = 500;
+  for (int i = 0; i < kMaxRetry; ++i) {
+    if (cp->IsStaged(key)) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return false;
+}
+}  // namespace
+
+class MindDataTestCachePool : public UT::DatasetOpTesting {
+ public:
+  void SetUp() override {
+    DatasetOpTesting::SetUp();
+    GlobalInit();
+    hw_ = std::make_shared<CacheServerHW>();
+    ASSERT_OK(hw_->GetNumaNodeInfo());
+    // The CachePool sizes its StorageManager by the number of server workers.
+    ASSERT_OK(CacheServer::CreateInstance(spill_root_, kNumWorkers, kCfgDefaultCachePort, 1, kSpillAllRatio, 1, hw_));
+    mp_ = std::make_shared<NumaMemoryPool>(hw_, kSpillAllRatio);
+  }
+
+  std::shared_ptr<CachePool> CreateCachePool(int32_t staged_rows) {
+    auto cp = std::make_shared<CachePool>(mp_, spill_root_, staged_rows * kRowSize);
+    EXPECT_OK(cp->ServiceStart());
+    return cp;
+  }
+
+  const std::string spill_root_ = "/tmp";
+  std::shared_ptr<CacheServerHW> hw_;
+  std::shared_ptr<NumaMemoryPool> mp_;
+};
+
+/// Feature: CachePool
+/// Description: Spill buffers through the staging area and read them before and after they are written to disk
+/// Expectation: All the buffers are spilled and read back correctly
+TEST_F(MindDataTestCachePool, TestSpillAndRead) {
+  constexpr int32_t kNumRows = 64;
+  auto cp = CreateCachePool(kNumRows);
+  for (auto key = 0; key < kNumRows; ++key) {
+    ASSERT_OK(InsertRow(cp.get(), key));
+  }
+  // Some of the buffers may not be written yet.
+  for (auto key = 0; key < kNumRows; ++key) {
+    EXPECT_OK(CheckRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->Flush());
+  auto stat = cp->GetStat();
+  EXPECT_EQ(stat.num_mem_cached, 0);
+  EXPECT_EQ(stat.num_disk_cached, kNumRows);
+  for (auto key = 0; key < kNumRows; ++key) {
+    EXPECT_TRUE(cp->IsStaged(key));
+    EXPECT_OK(CheckRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->ServiceStop());
+}
+
+/// Feature: CachePool
+/// Description: Spill more buffers than the staging area can hold after some of the staged buffers are read
+/// Expectation: The least read buffer is evicted first, and it is still read back correctly from disk
+TEST_F(MindDataTestCachePool, TestEvictLeastRead) {
+  constexpr int32_t kStagedRows = 4;
+  auto cp = CreateCachePool(kStagedRows);
+  for (auto key = 0; key < kStagedRows; ++key) {
+    ASSERT_OK(InsertRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->Flush());
+  // Row 0 is read once, the others twice.
+  for (auto key = 0; key < kStagedRows; ++key) {
+    ASSERT_OK(CheckRow(cp.get(), key));
+    if (key > 0) {
+      ASSERT_OK(CheckRow(cp.get(), key));
+    }
+  }
+  ASSERT_OK(InsertRow(cp.get(), kStagedRows));
+  ASSERT_OK(cp->Flush());
+  EXPECT_FALSE(cp->IsStaged(0));
+  for (auto key = 1; key <= kStagedRows; ++key) {
+    EXPECT_TRUE(cp->IsStaged(key));
+  }
+  // Among the buffers read as often, the least recently staged goes first.
+  ASSERT_OK(CheckRow(cp.get(), kStagedRows));
+  ASSERT_OK(CheckRow(cp.get(), kStagedRows));
+  ASSERT_OK(InsertRow(cp.get(), kStagedRows + 1));
+  ASSERT_OK(cp->Flush());
+  EXPECT_FALSE(cp->IsStaged(1));
+  EXPECT_TRUE(cp->IsStaged(kStagedRows + 1));
+  // A read from disk doesn't bring the buffer back to the staging area.
+  EXPECT_OK(CheckRow(cp.get(), 0));
+  EXPECT_FALSE(cp->IsStaged(0));
+  ASSERT_OK(cp->ServiceStop());
+}
+
+/// Feature: CachePool
+/// Description: Prefetch evicted buffers into the staging area, more than half of the staging area
+/// Expectation: Only the buffers which fit in half of the staging area are read ahead
+TEST_F(MindDataTestCachePool, TestPrefetch) {
+  constexpr int32_t kStagedRows = 8;
+  constexpr int32_t kNumRows = 2 * kStagedRows;
+  auto cp = CreateCachePool(kStagedRows);
+  // Write each buffer before the next one, so that the later buffers evict the earlier ones from the staging area
+  // instead of bypassing it.
+  for (auto key = 0; key < kNumRows; ++key) {
+    ASSERT_OK(InsertRow(cp.get(), key));
+    ASSERT_OK(cp->Flush());
+  }
+  for (auto key = 0; key < kStagedRows; ++key) {
+    ASSERT_FALSE(cp->IsStaged(key));
+  }
+  ASSERT_OK(cp->Prefetch({0, 1, 2, 3}));
+  for (auto key = 0; key < kStagedRows / 2; ++key) {
+    EXPECT_TRUE(WaitForStaged(cp.get(), key));
+  }
+  // The unread prefetched buffers take up half of the staging area already.
+  ASSERT_OK(cp->Prefetch({4}));
+  EXPECT_FALSE(cp->IsStaged(4));
+  // Reading a prefetched buffer makes room for the next one.
+  EXPECT_OK(CheckRow(cp.get(), 0));
+  ASSERT_OK(cp->Prefetch({4}));
+  EXPECT_TRUE(WaitForStaged(cp.get(), 4));
+  for (auto key = 1; key <= kStagedRows / 2; ++key) {
+    EXPECT_OK(CheckRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->ServiceStop());
+}
+
+/// Feature: CachePool
+/// Description: Prefetch and read the spilled buffers from several threads at the same time
+/// Expectation: All the reads return the right buffer
+TEST_F(MindDataTestCachePool, TestConcurrentPrefetchAndRead) {
+  constexpr int32_t kStagedRows = 16;
+  constexpr int32_t kNumRows = 256;
+  constexpr int32_t kNumReaders = 4;
+  constexpr int32_t kPrefetchSize = 8;
+  auto cp = CreateCachePool(kStagedRows);
+  for (auto key = 0; key < kNumRows; ++key) {
+    ASSERT_OK(InsertRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->Flush());
+  TaskGroup vg;
+  auto f = [&cp](int32_t k) -> Status {
+    TaskManager::FindMe()->Post();
+    // Each reader walks through the rows from a different starting point, hinting the next few rows ahead.
+    for (auto i = 0; i < kNumRows; ++i) {
+      std::vector<CachePool::key_type> keys;
+      for (auto j = 1; j <= kPrefetchSize; ++j) {
+        keys.push_back((k * kNumRows / kNumReaders + i + j) % kNumRows);
+      }
+      RETURN_IF_NOT_OK(cp->Prefetch(keys));
+      RETURN_IF_NOT_OK(CheckRow(cp.get(), (k * kNumRows / kNumReaders + i) % kNumRows));
+    }
+    return Status::OK();
+  };
+  for (auto k = 0; k < kNumReaders; ++k) {
+    ASSERT_OK(vg.CreateAsyncTask("Prefetch and read", std::bind(f, k)));
+  }
+  ASSERT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  for (auto key = 0; key < kNumRows; ++key) {
+    EXPECT_OK(CheckRow(cp.get(), key));
+  }
+  ASSERT_OK(cp->ServiceStop());
+}
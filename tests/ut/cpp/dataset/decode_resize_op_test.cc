@@ -0,0 +1,69 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/decode_resize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestDecodeResizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestDecodeResizeOp() : CVOpCommon() {}
+
+  void TearDown() override { GlobalContext::config_manager()->set_enable_jpeg_scaled_decode(false); }
+
+  // Run Decode and Resize separately and fused, return the mean absolute difference of the two outputs
+  double DecodeResizeDiff(int32_t size1, int32_t size2) {
+    std::shared_ptr<Tensor> decoded, expected, fused;
+    EXPECT_OK(DecodeOp(true).Compute(raw_input_tensor_, &decoded));
+    ResizeOp resize(size1, size2);
+    EXPECT_OK(resize.Compute(decoded, &expected));
+    DecodeResizeOp decode_resize(resize);
+    EXPECT_OK(decode_resize.Compute(raw_input_tensor_, &fused));
+    EXPECT_EQ(expected->shape(), fused->shape());
+    cv::Mat expected_mat = CVTensor::AsCVTensor(expected)->mat();
+    cv::Mat fused_mat = CVTensor::AsCVTensor(fused)->mat();
+    return cv::norm(expected_mat, fused_mat, cv::NORM_L1) / static_cast<double>(expected->Size());
+  }
+};
+
+/// Feature: DecodeResize op
+/// Description: Test DecodeResizeOp without scaled decode against DecodeOp followed by ResizeOp
+/// Expectation: The outputs are exactly the same
+TEST_F(MindDataTestDecodeResizeOp, TestOpFullDecode) {
+  MS_LOG(INFO) << "Doing MindDataTestDecodeResizeOp-TestOpFullDecode.";
+  GlobalContext::config_manager()->set_enable_jpeg_scaled_decode(false);
+  EXPECT_EQ(DecodeResizeDiff(200, 160), 0.0);
+  EXPECT_EQ(DecodeResizeDiff(100, 0), 0.0);
+}
+
+/// Feature: DecodeResize op
+/// Description: Test DecodeResizeOp with scaled decode against DecodeOp followed by ResizeOp
+/// Expectation: The output shapes are the same and the pixel values are close
+TEST_F(MindDataTestDecodeResizeOp, TestOpScaledDecode) {
+  MS_LOG(INFO) << "Doing MindDataTestDecodeResizeOp-TestOpScaledDecode.";
+  GlobalContext::config_manager()->set_enable_jpeg_scaled_decode(true);
+  constexpr double kMeanDiffThreshold = 8.0;
+  EXPECT_LT(DecodeResizeDiff(200, 160), kMeanDiffThreshold);
+  EXPECT_LT(DecodeResizeDiff(100, 0), kMeanDiffThreshold);
+  // larger than the image, decoded at full scale and resized up
+  EXPECT_LT(DecodeResizeDiff(1000, 1000), kMeanDiffThreshold);
+}
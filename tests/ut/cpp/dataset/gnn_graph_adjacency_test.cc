@@ -0,0 +1,158 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/gnn/graph_adjacency.h"
+
+using namespace mindspore::dataset;
+using namespace mindspore::dataset::gnn;
+
+class MindDataTestGNNGraphAdjacency : public UT::Common {
+ protected:
+  MindDataTestGNNGraphAdjacency() = default;
+
+  using Edge = std::tuple<NodeIdType, NodeIdType, NodeType, WeightType>;
+
+  // Nodes 1 and 2 are of type 0, nodes 3, 4 and 5 are of type 1. Every edge also has its reverse edge, except the
+  // edge to node 5. The edge from node 1 to node 4 has no weight.
+  void BuildGraph(GraphAdjacency *adjacency) {
+    const std::vector<NodeIdType> node_ids = {1, 2, 3, 4, 5};
+    const std::vector<Edge> edges = {{1, 3, 1, 1.0}, {1, 2, 0, 1.0}, {1, 4, 1, 0.0}, {3, 1, 0, 1.0},
+                                     {2, 1, 0, 1.0}, {4, 1, 0, 1.0}, {2, 5, 1, 2.0}, {2, 3, 1, 1.0},
+                                     {3, 2, 0, 1.0}};
+    ASSERT_OK(adjacency->Init(node_ids));
+    for (const auto &edge : edges) {
+      ASSERT_OK(adjacency->CountEdge(std::get<0>(edge), std::get<2>(edge)));
+    }
+    for (const auto &edge : edges) {
+      ASSERT_OK(adjacency->AddEdge(std::get<0>(edge), std::get<1>(edge), std::get<2>(edge), std::get<3>(edge)));
+    }
+    ASSERT_OK(adjacency->Finalize());
+  }
+
+  std::vector<NodeIdType> GetNeighbors(const GraphAdjacency &adjacency, NodeIdType id, NodeType neighbor_type) {
+    const NodeIdType *neighbors = nullptr;
+    int64_t num_neighbors = -1;
+    Status rc = adjacency.GetNeighbors(id, neighbor_type, &neighbors, &num_neighbors);
+    EXPECT_OK(rc);
+    if (rc.IsError() || num_neighbors <= 0) {
+      return {};
+    }
+    return std::vector<NodeIdType>(neighbors, neighbors + num_neighbors);
+  }
+};
+
+/// Feature: GraphAdjacency
+/// Description: Get the neighbors of each type of the nodes, along the edges and along the reverse edges
+/// Expectation: The neighbors of a node keep the order of their edges, and a missing type has no neighbors
+TEST_F(MindDataTestGNNGraphAdjacency, TestGetNeighbors) {
+  GraphAdjacency adjacency;
+  BuildGraph(&adjacency);
+  EXPECT_EQ(GetNeighbors(adjacency, 1, 0), std::vector<NodeIdType>({2}));
+  EXPECT_EQ(GetNeighbors(adjacency, 1, 1), std::vector<NodeIdType>({3, 4}));
+  EXPECT_EQ(GetNeighbors(adjacency, 2, 0), std::vector<NodeIdType>({1}));
+  EXPECT_EQ(GetNeighbors(adjacency, 2, 1), std::vector<NodeIdType>({5, 3}));
+  // the reverse edges
+  EXPECT_EQ(GetNeighbors(adjacency, 3, 0), std::vector<NodeIdType>({1, 2}));
+  EXPECT_EQ(GetNeighbors(adjacency, 4, 0), std::vector<NodeIdType>({1}));
+  EXPECT_TRUE(GetNeighbors(adjacency, 5, 0).empty());
+  EXPECT_TRUE(GetNeighbors(adjacency, 3, 1).empty());
+
+  // a type of neighbor which no edge leads to
+  const NodeIdType *neighbors = nullptr;
+  int64_t num_neighbors = -1;
+  EXPECT_OK(adjacency.GetNeighbors(1, 2, &neighbors, &num_neighbors));
+  EXPECT_EQ(num_neighbors, 0);
+  EXPECT_ERROR(adjacency.GetNeighbors(6, 0, &neighbors, &num_neighbors));
+  EXPECT_ERROR(adjacency.GetNeighbors(1, 0, nullptr, &num_neighbors));
+}
+
+/// Feature: GraphAdjacency
+/// Description: Sample the neighbors of a batch of nodes randomly and by edge weight
+/// Expectation: Random sampling takes every neighbor once per round, weighted sampling skips the edge without weight,
+///     and nodes without neighbors get kDefaultNodeId
+TEST_F(MindDataTestGNNGraphAdjacency, TestSampleNeighbors) {
+  GraphAdjacency adjacency;
+  BuildGraph(&adjacency);
+  std::mt19937 rnd(0);
+  const std::vector<NodeIdType> nodes = {1, kDefaultNodeId, 3, 2};
+  const int32_t samples_num = 5;
+  std::vector<NodeIdType> out(nodes.size() * samples_num);
+  ASSERT_OK(adjacency.SampleNeighbors(nodes.data(), nodes.size(), 1, samples_num, SamplingStrategy::kRandom, &rnd,
+                                      out.data()));
+  std::map<NodeIdType, int32_t> count;
+  for (int32_t i = 0; i < samples_num; ++i) {
+    count[out[i]]++;
+  }
+  // two rounds and one more
+  EXPECT_EQ(count.size(), 2);
+  EXPECT_GE(count[3], 2);
+  EXPECT_GE(count[4], 2);
+  for (size_t i = 1; i <= 2; ++i) {
+    EXPECT_TRUE(std::all_of(out.begin() + i * samples_num, out.begin() + (i + 1) * samples_num,
+                            [](NodeIdType id) { return id == kDefaultNodeId; }));
+  }
+
+  const int32_t weighted_samples_num = 1000;
+  out.resize(nodes.size() * weighted_samples_num);
+  ASSERT_OK(adjacency.SampleNeighbors(nodes.data(), nodes.size(), 1, weighted_samples_num,
+                                      SamplingStrategy::kEdgeWeight, &rnd, out.data()));
+  EXPECT_TRUE(std::all_of(out.begin(), out.begin() + weighted_samples_num, [](NodeIdType id) { return id == 3; }));
+  // node 5 is twice as likely as node 3
+  auto num_node5 = std::count(out.begin() + 3 * weighted_samples_num, out.end(), 5);
+  auto num_node3 = std::count(out.begin() + 3 * weighted_samples_num, out.end(), 3);
+  EXPECT_EQ(num_node5 + num_node3, weighted_samples_num);
+  EXPECT_GT(num_node5, num_node3);
+
+  const NodeIdType invalid_node = 6;
+  EXPECT_ERROR(adjacency.SampleNeighbors(&invalid_node, 1, 1, samples_num, SamplingStrategy::kRandom, &rnd,
+                                         out.data()));
+}
+
+/// Feature: GraphAdjacency
+/// Description: Build the adjacency with an unknown node, with an edge which is not counted and with a missing edge
+/// Expectation: Building the adjacency fails
+TEST_F(MindDataTestGNNGraphAdjacency, TestBuildInvalid) {
+  {
+    GraphAdjacency adjacency;
+    ASSERT_OK(adjacency.Init({1, 2}));
+    EXPECT_ERROR(adjacency.Init({1, 2}));
+    EXPECT_ERROR(adjacency.CountEdge(3, 0));
+  }
+  {
+    GraphAdjacency adjacency;
+    ASSERT_OK(adjacency.Init({1, 2}));
+    ASSERT_OK(adjacency.CountEdge(1, 0));
+    EXPECT_ERROR(adjacency.AddEdge(1, 2, 1, 1.0));
+    ASSERT_OK(adjacency.AddEdge(1, 2, 0, 1.0));
+    EXPECT_ERROR(adjacency.AddEdge(1, 2, 0, 1.0));
+    EXPECT_ERROR(adjacency.CountEdge(2, 0));
+  }
+  {
+    GraphAdjacency adjacency;
+    ASSERT_OK(adjacency.Init({1, 2}));
+    ASSERT_OK(adjacency.CountEdge(1, 0));
+    ASSERT_OK(adjacency.CountEdge(2, 0));
+    ASSERT_OK(adjacency.AddEdge(1, 2, 0, 1.0));
+    EXPECT_ERROR(adjacency.Finalize());
+  }
+}
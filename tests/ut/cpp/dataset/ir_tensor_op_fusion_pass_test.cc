@@ -106,3 +106,38 @@ TEST_F(MindDataTestTensorOpFusionPass, RandomCropDecodeResizeEnabled) {
     // EXPECT_EQ(++func_it, tfuncs.end());
   }
 }
+
+/// Feature: MindData Tensor Op Fusion Pass Support
+/// Description: Test Decode op and Resize op with IR optimization pass
+/// Expectation: The two ops are fused into one DecodeResizeOp
+TEST_F(MindDataTestTensorOpFusionPass, DecodeResizeEnabled) {
+  MS_LOG(INFO) << "Doing MindDataTestTensorOpFusionPass-DecodeResizeEnabled";
+
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, false, std::make_shared<SequentialSampler>(0, 11));
+
+  // Create objects for the tensor ops
+  auto decode = std::make_shared<vision::Decode>();
+  auto resize = std::make_shared<vision::Resize>(std::vector<int32_t>{32, 32});
+  ds = ds->Map({decode, resize}, {"image"});
+
+  std::shared_ptr<DatasetNode> node = ds->IRNode();
+  auto ir_tree = std::make_shared<TreeAdapter>();
+  // Enable IR optimization pass
+  ir_tree->SetOptimize(true);
+  Status rc;
+  rc = ir_tree->Compile(node);
+  EXPECT_TRUE(rc);
+  auto root_op = ir_tree->GetRoot();
+
+  auto tree = std::make_shared<ExecutionTree>();
+  auto it = tree->begin(static_cast<std::shared_ptr<DatasetOp>>(root_op));
+  ++it;
+  auto *map_op = &(*it);
+  auto tfuncs = static_cast<MapOp *>(map_op)->TFuncs();
+  for (size_t i = 0; i < tfuncs.size(); i++) {
+    auto func_it = tfuncs[i].begin();
+    EXPECT_EQ((*func_it)->Name(), kDecodeResizeOp);
+    EXPECT_EQ(++func_it, tfuncs[i].end());
+  }
+}
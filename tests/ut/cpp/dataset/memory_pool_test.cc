@@ -16,6 +16,8 @@
 
 #include "minddata/dataset/util/memory_pool.h"
 #include "minddata/dataset/util/circular_pool.h"
+#include "minddata/dataset/util/recycling_pool.h"
+#include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/util/allocator.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
@@ -100,3 +102,57 @@ TEST_F(MindDataTestMemoryPool, TestMemGuard) {
     p[sz / 2] = 'a';
   }
 }
+
+/// Feature: RecyclingPool
+/// Description: Test released blocks are handed out again to allocations of the same size
+/// Expectation: Runs successfully
+TEST_F(MindDataTestMemoryPool, TestRecyclingPool) {
+  auto pool = std::make_shared<RecyclingPool>();
+  void *p1 = nullptr;
+  void *p2 = nullptr;
+  ASSERT_OK(pool->Allocate(100, &p1));
+  ASSERT_OK(pool->Allocate(100, &p2));
+  pool->Deallocate(p1);
+  // p2 is still in use, so p1 is kept
+  ASSERT_EQ(pool->CachedBytes(), 100);
+  void *p3 = nullptr;
+  ASSERT_OK(pool->Allocate(100, &p3));
+  ASSERT_EQ(p3, p1);
+  ASSERT_EQ(pool->NumRecycled(), 1);
+  ASSERT_EQ(pool->NumMalloced(), 2);
+  pool->Deallocate(p2);
+  pool->Deallocate(p3);
+  // nothing is in use any more, only one block is kept
+  ASSERT_EQ(pool->CachedBytes(), 100);
+
+  // a block of a new size replaces the blocks of the old size
+  void *p4 = nullptr;
+  ASSERT_OK(pool->Allocate(300, &p4));
+  pool->Deallocate(p4);
+  ASSERT_EQ(pool->CachedBytes(), 300);
+  void *p5 = nullptr;
+  ASSERT_OK(pool->Allocate(300, &p5));
+  ASSERT_EQ(p5, p4);
+  ASSERT_OK(pool->Reallocate(&p5, 300, 400));
+  pool->Deallocate(p5);
+  ASSERT_EQ(pool->CachedBytes(), 400);
+}
+
+/// Feature: RecyclingPool
+/// Description: Test a tensor buffer allocated from a RecyclingPool is reused by the next tensor of the same size
+/// Expectation: Runs successfully
+TEST_F(MindDataTestMemoryPool, TestRecyclingPoolTensor) {
+  auto pool = std::make_shared<RecyclingPool>();
+  std::shared_ptr<Tensor> t1;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({4, 8}), DataType(DataType::DE_FLOAT32), pool, &t1));
+  ASSERT_OK(t1->Fill<float>(1.0));
+  const uchar *buf = t1->GetBuffer();
+  t1.reset();
+  std::shared_ptr<Tensor> t2;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({8, 4}), DataType(DataType::DE_INT32), pool, &t2));
+  ASSERT_EQ(t2->GetBuffer(), buf);
+  ASSERT_EQ(pool->NumRecycled(), 1);
+
+  std::shared_ptr<Tensor> t3;
+  ASSERT_ERROR(Tensor::CreateEmpty(TensorShape({2}), DataType(DataType::DE_STRING), pool, &t3));
+}
@@ -279,4 +279,93 @@ TEST_F(MindDataTestQueue, TestResize2) {
   ASSERT_EQ(1, queue.size());
   queue.Reset();
   ASSERT_EQ(0, queue.size());
-}
\ No newline at end of file
+}
+
+/// Feature: Queue
+/// Description: Test lock free Queue with one producer task and one consumer task on a small capacity
+/// Expectation: All elements are received in the order they are added, including the emplaced ones
+TEST_F(MindDataTestQueue, TestLockFree1) {
+  const int num_elements = 100000;
+  const int queue_capacity = 4;
+  Queue<std::unique_ptr<int>> que(queue_capacity, true);
+  ASSERT_TRUE(que.lock_free());
+  TaskGroup vg;
+  auto producer = [&]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int i = 0; i < num_elements; i++) {
+      if (i % 2 == 0) {
+        RETURN_IF_NOT_OK(que.Add(std::make_unique<int>(i)));
+      } else {
+        RETURN_IF_NOT_OK(que.EmplaceBack(new int(i)));
+      }
+    }
+    return Status::OK();
+  };
+  int64_t mismatch = 0;
+  auto consumer = [&]() -> Status {
+    TaskManager::FindMe()->Post();
+    for (int i = 0; i < num_elements; i++) {
+      std::unique_ptr<int> v;
+      RETURN_IF_NOT_OK(que.PopFront(&v));
+      if (v == nullptr || *v != i) {
+        mismatch++;
+      }
+    }
+    return Status::OK();
+  };
+  EXPECT_OK(vg.CreateAsyncTask("LockFreeProducer", producer));
+  EXPECT_OK(vg.CreateAsyncTask("LockFreeConsumer", consumer));
+  EXPECT_OK(vg.join_all());
+  EXPECT_OK(vg.GetTaskErrorIfAny());
+  EXPECT_EQ(mismatch, 0);
+  EXPECT_TRUE(que.empty());
+}
+
+/// Feature: Queue
+/// Description: Test QueueList in lock free mode, including a queue added after Init and Resize on a lock free queue
+/// Expectation: Every queue is lock free, elements round trip and Resize is rejected
+TEST_F(MindDataTestQueue, TestLockFree2) {
+  QueueList<TensorRow> my_list_of_queues;
+  const int num_queues = 2;
+  const int queue_capacity = 3;
+  my_list_of_queues.Init(num_queues, queue_capacity, true);
+  TaskGroup vg;
+  EXPECT_OK(my_list_of_queues.AddQueue(&vg));
+  ASSERT_EQ(my_list_of_queues.size(), num_queues + 1);
+  for (int i = 0; i < my_list_of_queues.size(); i++) {
+    ASSERT_TRUE(my_list_of_queues[i]->lock_free());
+    EXPECT_OK(my_list_of_queues[i]->EmplaceBack(TensorRow(TensorRow::TensorRowFlags::kFlagEOE)));
+    EXPECT_OK(my_list_of_queues[i]->Add(TensorRow(TensorRow::TensorRowFlags::kFlagEOF)));
+    ASSERT_EQ(my_list_of_queues[i]->size(), 2);
+    TensorRow row;
+    EXPECT_OK(my_list_of_queues[i]->PopFront(&row));
+    EXPECT_TRUE(row.eoe());
+    EXPECT_OK(my_list_of_queues[i]->PopFront(&row));
+    EXPECT_TRUE(row.eof());
+  }
+  EXPECT_ERROR(my_list_of_queues[0]->Resize(1));
+  ASSERT_EQ(my_list_of_queues[0]->capacity(), queue_capacity);
+}
+
+/// Feature: Queue
+/// Description: Test TryAdd on a full and a non-full Queue, in both the default and the lock free mode
+/// Expectation: TryAdd returns false without blocking when the queue is full, and the elements keep their order
+TEST_F(MindDataTestQueue, TestTryAdd) {
+  const int queue_capacity = 2;
+  for (bool lock_free : {false, true}) {
+    Queue<int> que(queue_capacity, lock_free);
+    EXPECT_TRUE(que.TryAdd(1));
+    EXPECT_TRUE(que.TryAdd(2));
+    EXPECT_FALSE(que.TryAdd(3));
+    EXPECT_EQ(que.size(), queue_capacity);
+    int v = 0;
+    EXPECT_OK(que.PopFront(&v));
+    EXPECT_EQ(v, 1);
+    EXPECT_TRUE(que.TryAdd(4));
+    EXPECT_OK(que.PopFront(&v));
+    EXPECT_EQ(v, 2);
+    EXPECT_OK(que.PopFront(&v));
+    EXPECT_EQ(v, 4);
+    EXPECT_TRUE(que.empty());
+  }
+}
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "common/common.h"
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/core/global_context.h"
@@ -150,4 +152,63 @@ TEST_F(MindDataTestStandAloneSampler, TestStandAloneSkipFirstEpochSampler) {
   sampler->GetNextSample(&sample_row);
   tensor = sample_row[0];
   EXPECT_TRUE((*tensor) == (*label));
-}
\ No newline at end of file
+}
+
+/// Feature: MindData RT RandomSampler Support
+/// Description: Test MindData RT RandomSampler with enable_seekable_shuffle starting from a row of a later epoch
+/// Expectation: The sampler outputs the same ids as a sampler which has sampled the earlier rows
+TEST_F(MindDataTestStandAloneSampler, TestStandAloneSeekableRandomSampler) {
+  MS_LOG(INFO) << "Doing MindDataTestStandAloneSampler-TestStandAloneSeekableRandomSampler.";
+  uint32_t original_seed = GlobalContext::config_manager()->seed();
+  bool original_seekable = GlobalContext::config_manager()->enable_seekable_shuffle();
+  GlobalContext::config_manager()->set_seed(1234);
+  GlobalContext::config_manager()->set_enable_seekable_shuffle(true);
+
+  const int64_t num_rows = 10;
+  MockStorageOp mock(num_rows);
+  TensorRow sample_row;
+  auto sampler = std::make_shared<RandomSamplerRT>(false, 0, true);
+  ASSERT_OK(sampler->HandshakeRandomAccessOp(&mock));
+  std::vector<std::vector<int64_t>> epochs(3);
+  for (auto &epoch : epochs) {
+    ASSERT_OK(sampler->GetNextSample(&sample_row));
+    for (auto it = sample_row[0]->begin<int64_t>(); it != sample_row[0]->end<int64_t>(); ++it) {
+      epoch.push_back(*it);
+    }
+    ASSERT_OK(sampler->GetNextSample(&sample_row));
+    EXPECT_TRUE(sample_row.eoe());
+    ASSERT_OK(sampler->ResetSampler());
+  }
+  // Each epoch is a permutation of all rows and the epochs are shuffled differently
+  for (const auto &epoch : epochs) {
+    std::vector<int64_t> sorted_ids(epoch);
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    for (int64_t i = 0; i < num_rows; i++) {
+      EXPECT_EQ(sorted_ids[i], i);
+    }
+  }
+  EXPECT_NE(epochs[0], epochs[1]);
+
+  // Start from the 4th row of the 2nd epoch, then continue with the 3rd epoch
+  auto seek_sampler = std::make_shared<RandomSamplerRT>(false, 0, true);
+  seek_sampler->SetStartPosition(1, 4);
+  ASSERT_OK(seek_sampler->HandshakeRandomAccessOp(&mock));
+  ASSERT_OK(seek_sampler->GetNextSample(&sample_row));
+  std::vector<int64_t> ids;
+  for (auto it = sample_row[0]->begin<int64_t>(); it != sample_row[0]->end<int64_t>(); ++it) {
+    ids.push_back(*it);
+  }
+  EXPECT_EQ(ids, std::vector<int64_t>(epochs[1].begin() + 4, epochs[1].end()));
+  ASSERT_OK(seek_sampler->GetNextSample(&sample_row));
+  EXPECT_TRUE(sample_row.eoe());
+  ASSERT_OK(seek_sampler->ResetSampler());
+  ASSERT_OK(seek_sampler->GetNextSample(&sample_row));
+  ids.clear();
+  for (auto it = sample_row[0]->begin<int64_t>(); it != sample_row[0]->end<int64_t>(); ++it) {
+    ids.push_back(*it);
+  }
+  EXPECT_EQ(ids, epochs[2]);
+
+  GlobalContext::config_manager()->set_seed(original_seed);
+  GlobalContext::config_manager()->set_enable_seekable_shuffle(original_seekable);
+}
@@ -39,8 +39,10 @@ class TestShardReader : public UT::Common {
     for (int i = 1; i <= 4; i++) {
       string filename = std::string("./imagenet.shard0") + std::to_string(i);
       string db_name = std::string("./imagenet.shard0") + std::to_string(i) + ".db";
+      string idx_name = std::string("./imagenet.shard0") + std::to_string(i) + ".idx";
       remove(common::SafeCStr(filename));
       remove(common::SafeCStr(db_name));
+      remove(common::SafeCStr(idx_name));
     }
   }
 };
@@ -90,6 +92,91 @@ TEST_F(TestShardReader, TestShardReaderLazyLoad) {
   dataset.Close();
 }
 
+TEST_F(TestShardReader, TestShardReaderMmap) {
+  MS_LOG(INFO) << FormatInfo("Test read imageNet in mmap mode");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+
+  ShardReader stream_dataset;
+  stream_dataset.Open({file_name}, true, 4, column_list);
+  stream_dataset.Launch();
+
+  ShardReader mmap_dataset;
+  mmap_dataset.SetMmapRead(true);
+  mmap_dataset.Open({file_name}, true, 4, column_list);
+  mmap_dataset.Launch();
+
+  uint32_t count = 0;
+  while (true) {
+    auto x = stream_dataset.GetNext();
+    auto y = mmap_dataset.GetNext();
+    ASSERT_EQ(x.size(), y.size());
+    if (x.empty()) break;
+    for (size_t i = 0; i < x.size(); i++) {
+      ASSERT_EQ(std::get<0>(x[i]), std::get<0>(y[i]));
+      ASSERT_EQ(std::get<1>(x[i]), std::get<1>(y[i]));
+    }
+    count++;
+  }
+  ASSERT_TRUE(count == 10);
+  stream_dataset.Close();
+  mmap_dataset.Close();
+}
+
+TEST_F(TestShardReader, TestShardReaderColumnarIndex) {
+  MS_LOG(INFO) << FormatInfo("Test read imageNet with columnar index");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+
+  auto read_all = [&file_name, &column_list]() {
+    std::vector<std::tuple<std::vector<uint8_t>, json>> rows;
+    ShardReader dataset;
+    dataset.Open({file_name}, true, 4, column_list);
+    dataset.Launch();
+    while (true) {
+      auto x = dataset.GetNext();
+      if (x.empty()) break;
+      rows.insert(rows.end(), x.begin(), x.end());
+    }
+    dataset.Close();
+    return rows;
+  };
+
+  auto index_rows = read_all();
+  for (int i = 1; i <= 4; i++) {
+    string idx_name = std::string("./imagenet.shard0") + std::to_string(i) + ".idx";
+    ASSERT_EQ(remove(common::SafeCStr(idx_name)), 0);
+  }
+  auto sql_rows = read_all();
+
+  ASSERT_EQ(index_rows.size(), 10);
+  ASSERT_EQ(index_rows, sql_rows);
+}
+
+TEST_F(TestShardReader, TestShardReaderColumnarIndexNumClasses) {
+  MS_LOG(INFO) << FormatInfo("Test count classes of imageNet with columnar index");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+
+  auto num_classes = [&file_name, &column_list]() {
+    ShardReader dataset;
+    EXPECT_TRUE(dataset.Open({file_name}, true, 4, column_list).IsOk());
+    auto num = dataset.GetNumClasses("label");
+    dataset.Close();
+    return num;
+  };
+
+  auto index_num = num_classes();
+  for (int i = 1; i <= 4; i++) {
+    string idx_name = std::string("./imagenet.shard0") + std::to_string(i) + ".idx";
+    ASSERT_EQ(remove(common::SafeCStr(idx_name)), 0);
+  }
+  auto sql_num = num_classes();
+
+  ASSERT_GT(index_num, 0);
+  ASSERT_EQ(index_num, sql_num);
+}
+
 TEST_F(TestShardReader, TestShardReaderSample) {
   MS_LOG(INFO) << FormatInfo("Test read imageNet");
   std::string file_name = "./imagenet.shard01";
@@ -0,0 +1,196 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "actor/mailbox.h"
+#include "common/common_test.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace {
+// take the msgs in the mailbox of any kind, and return the number of them
+size_t DrainMsgs(MailBox *mailbox, std::vector<std::string> *names = nullptr) {
+  size_t num = 0;
+  if (mailbox->TakeAllMsgsEachTime()) {
+    auto msgs = mailbox->GetMsgs();
+    if (msgs == nullptr) {
+      return 0;
+    }
+    for (auto &msg : *msgs) {
+      if (names != nullptr) {
+        names->push_back(msg->Name());
+      }
+      ++num;
+    }
+    msgs->clear();
+    return num;
+  }
+  while (auto msg = mailbox->GetMsg()) {
+    if (names != nullptr) {
+      names->push_back(msg->Name());
+    }
+    ++num;
+  }
+  return num;
+}
+
+// the round trip latency of one msg between two threads
+double PingPongLatency(MailBox *ping, MailBox *pong, size_t round_num) {
+  std::thread peer([ping, pong, round_num]() {
+    for (size_t i = 0; i < round_num;) {
+      size_t num = DrainMsgs(ping);
+      if (num == 0) {
+        std::this_thread::yield();
+      }
+      for (size_t j = 0; j < num; ++j) {
+        (void)pong->EnqueueMessage(std::make_unique<MessageBase>("pong"));
+      }
+      i += num;
+    }
+  });
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < round_num; ++i) {
+    (void)ping->EnqueueMessage(std::make_unique<MessageBase>("ping"));
+    while (DrainMsgs(pong) == 0) {
+      std::this_thread::yield();
+    }
+  }
+  auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  peer.join();
+  return cost / round_num;
+}
+
+// the number of msgs per second received by one thread from several threads
+double FanInThroughput(MailBox *mailbox, size_t producer_num, size_t msg_num) {
+  std::vector<std::thread> producers;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < producer_num; ++i) {
+    producers.emplace_back([mailbox, msg_num]() {
+      for (size_t j = 0; j < msg_num; ++j) {
+        (void)mailbox->EnqueueMessage(std::make_unique<MessageBase>("fan_in"));
+      }
+    });
+  }
+  for (size_t received = 0; received < producer_num * msg_num;) {
+    size_t num = DrainMsgs(mailbox);
+    if (num == 0) {
+      std::this_thread::yield();
+    }
+    received += num;
+  }
+  auto cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  return producer_num * msg_num / cost;
+}
+}  // namespace
+
+class TestMailBox : public UT::Common {
+ public:
+  TestMailBox() {}
+};
+
+/// Feature: Lock-free mailbox of actors.
+/// Description: Enqueue the msgs before and after the consumer finds no msg.
+/// Expectation: The msgs are got in the enqueue order and the hook is invoked once the mailbox is released.
+TEST_F(TestMailBox, test_mpsc_mailbox_order) {
+  MpscMailBox mailbox;
+  int notify_num = 0;
+  mailbox.SetNotifyHook(std::make_unique<std::function<void()>>([&notify_num]() { ++notify_num; }));
+  for (int i = 0; i < 3; ++i) {
+    (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>(std::to_string(i)));
+  }
+  EXPECT_EQ(notify_num, 1);
+  auto msg = mailbox.GetMsg();
+  ASSERT_NE(msg, nullptr);
+  EXPECT_EQ(msg->Name(), "0");
+  (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>("3"));
+  EXPECT_EQ(notify_num, 1);
+  std::vector<std::string> names;
+  EXPECT_EQ(DrainMsgs(&mailbox, &names), 3);
+  EXPECT_EQ(names, std::vector<std::string>({"1", "2", "3"}));
+  (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>("4"));
+  EXPECT_EQ(notify_num, 2);
+  // the msgs left are freed with the mailbox
+}
+
+/// Feature: Lock-free mailbox of actors.
+/// Description: Enqueue the msgs from several threads, and get them in another thread.
+/// Expectation: All the msgs are got once, and the msgs from the same thread are in order.
+TEST_F(TestMailBox, test_mpsc_mailbox_multi_producer) {
+  constexpr size_t kProducerNum = 4;
+  constexpr size_t kMsgNum = 10000;
+  MpscMailBox mailbox;
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducerNum; ++i) {
+    producers.emplace_back([&mailbox, i]() {
+      for (size_t j = 0; j < kMsgNum; ++j) {
+        (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>(std::to_string(i) + "_" + std::to_string(j)));
+      }
+    });
+  }
+  std::vector<std::string> names;
+  while (names.size() < kProducerNum * kMsgNum) {
+    if (DrainMsgs(&mailbox, &names) == 0) {
+      std::this_thread::yield();
+    }
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  std::vector<size_t> next_ids(kProducerNum, 0);
+  for (const auto &name : names) {
+    auto pos = name.find('_');
+    auto producer = std::stoul(name.substr(0, pos));
+    EXPECT_EQ(std::stoul(name.substr(pos + 1)), next_ids[producer]++);
+  }
+}
+
+/// Feature: Lock-free mailbox of actors.
+/// Description: Measure the ping-pong latency and fan-in throughput of the mailboxes.
+/// Expectation: The benchmark results are logged.
+TEST_F(TestMailBox, DISABLED_benchmark_mailbox) {
+  constexpr size_t kRoundNum = 10000;
+  constexpr size_t kProducerNum = 4;
+  constexpr size_t kMsgNum = 50000;
+  // measure before logging, since the stream of MS_LOG is not evaluated when the log level is higher than INFO
+  {
+    NonblockingMailBox ping;
+    NonblockingMailBox pong;
+    auto latency = PingPongLatency(&ping, &pong, kRoundNum);
+    NonblockingMailBox fan_in;
+    auto throughput = FanInThroughput(&fan_in, kProducerNum, kMsgNum);
+    MS_LOG(INFO) << "NonblockingMailBox ping-pong latency: " << latency << " ns, fan-in throughput: " << throughput
+                 << " msgs/s";
+  }
+  {
+    MpscMailBox ping;
+    MpscMailBox pong;
+    auto latency = PingPongLatency(&ping, &pong, kRoundNum);
+    MpscMailBox fan_in;
+    auto throughput = FanInThroughput(&fan_in, kProducerNum, kMsgNum);
+    MS_LOG(INFO) << "MpscMailBox ping-pong latency: " << latency << " ns, fan-in throughput: " << throughput
+                 << " msgs/s";
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,177 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "thread/threadpool.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+class TestThreadPool : public UT::Common {
+ public:
+  TestThreadPool() {}
+};
+
+/// Feature: Work stealing of thread pool.
+/// Description: Push and pop the task splits by the owner, and steal them by the other threads.
+/// Expectation: Each task split is taken only once.
+TEST_F(TestThreadPool, test_work_steal_queue) {
+  constexpr int kTaskNum = 100000;
+  constexpr int kThiefNum = 4;
+  WorkStealQueue<int> queue;
+  ASSERT_TRUE(queue.Init(64));
+  std::vector<int> values(kTaskNum);
+  std::vector<std::atomic_int> taken(kTaskNum);
+  std::atomic_bool done{false};
+  std::vector<std::thread> thieves;
+  for (int i = 0; i < kThiefNum; ++i) {
+    thieves.emplace_back([&]() {
+      while (!done) {
+        auto value = queue.Steal();
+        if (value != nullptr) {
+          (void)++taken[value - values.data()];
+        }
+      }
+    });
+  }
+  for (int i = 0; i < kTaskNum; ++i) {
+    while (!queue.Push(&values[i])) {
+      auto value = queue.Pop();
+      if (value != nullptr) {
+        (void)++taken[value - values.data()];
+      }
+    }
+  }
+  for (auto value = queue.Pop(); value != nullptr; value = queue.Pop()) {
+    (void)++taken[value - values.data()];
+  }
+  while (!queue.Empty()) {
+    std::this_thread::yield();
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  for (int i = 0; i < kTaskNum; ++i) {
+    EXPECT_EQ(taken[i], 1);
+  }
+}
+
+/// Feature: Work stealing of thread pool.
+/// Description: Launch the uneven tasks in the workers, and each task launches the nested tasks.
+/// Expectation: All the tasks are run once and the error of a nested task is returned.
+TEST_F(TestThreadPool, test_nested_parallel_launch) {
+  constexpr size_t kThreadNum = 4;
+  constexpr int kOuterTaskNum = 8;
+  constexpr int kInnerTaskNum = 32;
+  std::unique_ptr<ThreadPool> pool(ThreadPool::CreateThreadPool(kThreadNum));
+  ASSERT_NE(pool, nullptr);
+  std::vector<std::atomic_int> counts(kOuterTaskNum * kInnerTaskNum);
+  auto inner = [&counts](void *content, int task_id, float, float) {
+    auto outer_id = *static_cast<int *>(content);
+    if (task_id == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    (void)++counts[outer_id * kInnerTaskNum + task_id];
+    return THREAD_OK;
+  };
+  auto outer = [&pool, &inner](void *, int task_id, float, float) {
+    return pool->ParallelLaunch(inner, &task_id, kInnerTaskNum);
+  };
+  auto outer_launch = [&pool, &outer](void *, int, float, float) {
+    return pool->ParallelLaunch(outer, nullptr, kOuterTaskNum);
+  };
+  // the first launch is from the external thread, and the others are from the workers
+  EXPECT_EQ(pool->ParallelLaunch(outer_launch, nullptr, 2), THREAD_OK);
+  for (const auto &count : counts) {
+    EXPECT_EQ(count, 2);
+  }
+
+  auto failed = [](void *, int task_id, float, float) { return task_id == 1 ? THREAD_ERROR : THREAD_OK; };
+  auto failed_launch = [&pool, &failed](void *, int, float, float) {
+    return pool->ParallelLaunch(failed, nullptr, kInnerTaskNum);
+  };
+  EXPECT_EQ(pool->ParallelLaunch(failed_launch, nullptr, 2), THREAD_ERROR);
+}
+
+/// Feature: Work stealing of thread pool.
+/// Description: Launch the tasks in the workers, and the first split of each launch waits for all its other splits.
+/// Expectation: The other splits are stolen and run by the idle workers, not by the launching worker.
+TEST_F(TestThreadPool, test_parallel_launch_steal_by_other_workers) {
+  constexpr size_t kThreadNum = 4;
+  constexpr int kOuterTaskNum = 2;
+  constexpr int kInnerTaskNum = 16;
+  // the thread pool has no more threads than cores, and the two launchers need two idle workers to steal from them
+  if (std::thread::hardware_concurrency() < kThreadNum) {
+    return;
+  }
+  std::unique_ptr<ThreadPool> pool(ThreadPool::CreateThreadPool(kThreadNum));
+  ASSERT_NE(pool, nullptr);
+  auto external_thread = std::this_thread::get_id();
+  std::vector<std::thread::id> launchers(kOuterTaskNum);
+  std::vector<std::thread::id> runners(kOuterTaskNum * kInnerTaskNum);
+  std::vector<std::atomic_int> stolen(kOuterTaskNum);
+  auto inner = [&runners, &stolen](void *content, int task_id, float, float) {
+    auto outer_id = *static_cast<int *>(content);
+    runners[outer_id * kInnerTaskNum + task_id] = std::this_thread::get_id();
+    if (task_id != 0) {
+      (void)++stolen[outer_id];
+      return THREAD_OK;
+    }
+    // the launcher is held in its first split, so only the other workers can take the remaining splits
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (stolen[outer_id] != kInnerTaskNum - 1 && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    return stolen[outer_id] == kInnerTaskNum - 1 ? THREAD_OK : THREAD_ERROR;
+  };
+  auto outer = [&pool, &inner, &launchers, external_thread](void *, int task_id, float, float) {
+    // only a launch from a worker is balanced by stealing, the external thread may run a split of its own launch
+    if (std::this_thread::get_id() == external_thread) {
+      return THREAD_OK;
+    }
+    launchers[task_id] = std::this_thread::get_id();
+    return pool->ParallelLaunch(inner, &task_id, kInnerTaskNum);
+  };
+  // the outer splits are only given to the idle workers, retry until a worker gets one
+  constexpr int kMaxRetry = 100;
+  for (int retry = 0; retry < kMaxRetry; ++retry) {
+    ASSERT_EQ(pool->ParallelLaunch(outer, nullptr, kOuterTaskNum), THREAD_OK);
+    if (std::any_of(launchers.begin(), launchers.end(), [](const auto &id) { return id != std::thread::id(); })) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  int launched = 0;
+  for (int i = 0; i < kOuterTaskNum; ++i) {
+    if (launchers[i] == std::thread::id()) {
+      continue;
+    }
+    ++launched;
+    EXPECT_EQ(runners[i * kInnerTaskNum], launchers[i]);
+    for (int j = 1; j < kInnerTaskNum; ++j) {
+      EXPECT_NE(runners[i * kInnerTaskNum + j], std::thread::id());
+      EXPECT_NE(runners[i * kInnerTaskNum + j], launchers[i]);
+    }
+  }
+  EXPECT_GT(launched, 0);
+}
+}  // namespace mindspore
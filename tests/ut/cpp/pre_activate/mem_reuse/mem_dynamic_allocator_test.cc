@@ -0,0 +1,140 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/mem_reuse/mem_dynamic_allocator.h"
+#include "utils/convert_utils_base.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace device {
+class TestMemPool : public DynamicMemPoolBestFit {
+ public:
+  explicit TestMemPool(bool enable_size_class_cache) {
+    if (enable_size_class_cache) {
+      EnableSizeClassCache();
+    }
+  }
+  ~TestMemPool() override { ReleaseDeviceRes(); }
+
+  size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override {
+    *addr = malloc(size);
+    return *addr == nullptr ? 0 : size;
+  }
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override {
+    free(addr);
+    return true;
+  }
+  size_t free_mem_size() override { return kFreeMemSize; }
+
+ private:
+  static constexpr size_t kFreeMemSize = 4UL << 30;
+};
+
+class TestMemDynamicAllocator : public UT::Common {
+ public:
+  TestMemDynamicAllocator() {}
+};
+
+/// Feature: Size class cache of dynamic memory pool.
+/// Description: Alloc and free the small memory of the same size repeatedly.
+/// Expectation: The freed memory is reused by the thread and the used memory statistics is restored.
+TEST_F(TestMemDynamicAllocator, test_size_class_reuse) {
+  TestMemPool mem_pool(true);
+  auto addr = mem_pool.AllocTensorMem(1000);
+  ASSERT_NE(addr, nullptr);
+  auto used_size = mem_pool.TotalUsedMemStatistics();
+  EXPECT_EQ(used_size, 1024);
+  mem_pool.FreeTensorMem(addr);
+  EXPECT_EQ(mem_pool.TotalUsedMemStatistics(), 0);
+  EXPECT_EQ(mem_pool.AllocTensorMem(1024), addr);
+  mem_pool.FreeTensorMem(addr);
+
+  // The memory larger than the size classes and the continuous memory are from the best-fit pool.
+  auto large_addr = mem_pool.AllocTensorMem(1 << 20);
+  ASSERT_NE(large_addr, nullptr);
+  auto addr_list = mem_pool.AllocContinuousTensorMem({512, 512, 1024});
+  ASSERT_EQ(addr_list.size(), 3);
+  EXPECT_EQ(addr_list[1], AddressOffset(addr_list[0], 512));
+  EXPECT_EQ(addr_list[2], AddressOffset(addr_list[1], 512));
+  for (auto &continuous_addr : addr_list) {
+    mem_pool.FreeTensorMem(continuous_addr);
+  }
+  mem_pool.FreeTensorMem(large_addr);
+  EXPECT_EQ(mem_pool.TotalUsedMemStatistics(), 0);
+}
+
+/// Feature: Size class cache of dynamic memory pool.
+/// Description: Alloc the small memory in several threads and free it in other threads.
+/// Expectation: The memory allocated at the same time doesn't overlap and all the memory is freed.
+TEST_F(TestMemDynamicAllocator, test_size_class_multi_thread) {
+  TestMemPool mem_pool(true);
+  constexpr size_t kThreadNum = 8;
+  constexpr size_t kAllocNum = 1000;
+  std::vector<std::vector<DeviceMemPtr>> addr_lists(kThreadNum);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&mem_pool, &addr_lists, i]() {
+      for (size_t j = 0; j < kAllocNum; ++j) {
+        addr_lists[i].emplace_back(mem_pool.AllocTensorMem((j % 64 + 1) * 512));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::set<DeviceMemPtr> addrs;
+  for (const auto &addr_list : addr_lists) {
+    for (const auto &addr : addr_list) {
+      ASSERT_NE(addr, nullptr);
+      EXPECT_TRUE(addrs.insert(addr).second);
+    }
+  }
+
+  threads.clear();
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&mem_pool, &addr_lists, i]() {
+      for (const auto &addr : addr_lists[(i + 1) % kThreadNum]) {
+        mem_pool.FreeTensorMem(addr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(mem_pool.TotalUsedMemStatistics(), 0);
+}
+
+/// Feature: Size class cache of dynamic memory pool.
+/// Description: Alloc the memory from the pool without size class cache.
+/// Expectation: The freed memory is merged and reused by the best-fit pool.
+TEST_F(TestMemDynamicAllocator, test_best_fit) {
+  TestMemPool mem_pool(false);
+  auto addr1 = mem_pool.AllocTensorMem(512);
+  auto addr2 = mem_pool.AllocTensorMem(512);
+  ASSERT_NE(addr1, nullptr);
+  EXPECT_EQ(addr2, AddressOffset(addr1, 512));
+  EXPECT_EQ(mem_pool.TotalUsedMemStatistics(), 1024);
+  mem_pool.FreeTensorMem(addr1);
+  mem_pool.FreeTensorMem(addr2);
+  EXPECT_EQ(mem_pool.AllocTensorMem(1024), addr1);
+}
+}  // namespace device
+}  // namespace mindspore
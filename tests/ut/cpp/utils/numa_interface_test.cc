@@ -0,0 +1,73 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+#include "utils/numa_interface.h"
+#include "utils/log_adapter.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+class TestNumaInterface : public UT::Common {
+ public:
+  TestNumaInterface() {}
+};
+
+/// Feature: Numa bind of the dataset pipeline.
+/// Description: Bind without the numa library, with a negative rank id and to a numa node out of range.
+/// Expectation: All of them fail without binding.
+TEST_F(TestNumaInterface, test_numa_bind_invalid) {
+  EXPECT_NE(NumaBind(nullptr, 0), Status::OK());
+  EXPECT_NE(NumaBindNode(nullptr, 0), Status::OK());
+  auto handle = GetNumaAdapterHandle();
+  if (handle == nullptr) {
+    MS_LOG(WARNING) << "libnuma.so is not found, skip the checks with the numa library.";
+    return;
+  }
+  EXPECT_NE(NumaBind(handle.get(), -1), Status::OK());
+  EXPECT_NE(NumaBindNode(handle.get(), -1), Status::OK());
+  // there is no host with so many numa nodes
+  constexpr int32_t kInvalidNumaNode = 1 << 20;
+  EXPECT_NE(NumaBindNode(handle.get(), kInvalidNumaNode), Status::OK());
+}
+
+/// Feature: Numa bind of the dataset pipeline.
+/// Description: Get the numa node of a negative device id and of a device which is not visible.
+/// Expectation: The numa node is unknown.
+TEST_F(TestNumaInterface, test_get_device_numa_node_unknown) {
+  EXPECT_EQ(GetDeviceNumaNode(-1), -1);
+  constexpr int32_t kInvalidDeviceId = 1 << 20;
+  EXPECT_EQ(GetDeviceNumaNode(kInvalidDeviceId), -1);
+
+  // only the first device is visible to the process
+  const std::vector<std::string> envs = {"CUDA_VISIBLE_DEVICES", "ASCEND_RT_VISIBLE_DEVICES"};
+  std::vector<std::pair<bool, std::string>> old_values;
+  for (const auto &env : envs) {
+    auto value = getenv(env.c_str());
+    old_values.emplace_back(value != nullptr, value == nullptr ? "" : value);
+    (void)setenv(env.c_str(), "0", 1);
+  }
+  EXPECT_EQ(GetDeviceNumaNode(1), -1);
+  for (size_t i = 0; i < envs.size(); ++i) {
+    if (old_values[i].first) {
+      (void)setenv(envs[i].c_str(), old_values[i].second.c_str(), 1);
+    } else {
+      (void)unsetenv(envs[i].c_str());
+    }
+  }
+}
+}  // namespace mindspore
@@ -15,11 +15,15 @@
 """
 Testing Autotune support in DE
 """
+import json
+import os
+import re
 import sys
 import numpy as np
 import pytest
 import mindspore._c_dataengine as cde
 import mindspore.dataset as ds
+import mindspore.dataset.vision as vision
 
 def err_out_log(out, err, log=False):
     if log:
@@ -206,3 +210,49 @@ class TestAutotuneWithProfiler:
                 pass
 
         ds.config.set_enable_autotune(False)
+
+    @staticmethod
+    @pytest.mark.skipif(os.cpu_count() < 2, reason="AutoTune can not add workers beyond the number of cpu threads")
+    def test_autotune_cost_model_pipeline(tmp_path):
+        """
+        Feature: Autotuning
+        Description: Test simple pipeline of autotune with the cost model - Generator -> Map -> Batch, where the map
+            with a single worker is the bottleneck
+        Expectation: Pipeline runs successfully, the final configuration has more workers for the map,
+            and the cost model flag is restored
+        """
+        ds.config.set_enable_autotune(True, str(tmp_path / "cost_model"))
+        ds.config.set_enable_autotune_cost_model(True)
+        assert ds.config.get_enable_autotune_cost_model()
+        interval_original = ds.config.get_autotune_interval()
+        ds.config.set_autotune_interval(10)
+
+        source = [(np.random.randint(0, 255, (64, 64, 3), dtype=np.uint8),) for _ in range(512)]
+        data1 = ds.GeneratorDataset(source, ["image"])
+        data1 = data1.map(operations=[vision.GaussianBlur(11)], input_columns=["image"], num_parallel_workers=1)
+        data1 = data1.batch(4)
+
+        itr = data1.create_dict_iterator(num_epochs=3, output_numpy=True)
+        num_rows = 0
+        for _ in range(3):
+            for _ in itr:
+                num_rows += 1
+        assert num_rows == 3 * 128
+        del itr
+
+        ds.config.set_autotune_interval(interval_original)
+        ds.config.set_enable_autotune_cost_model(False)
+        ds.config.set_enable_autotune(False)
+
+        # the summary of the final configuration has a line per op, e.g.
+        # "MapOp(ID:1)         (num_parallel_workers: 2, prefetch_size:16)"
+        config_files = list(tmp_path.glob("cost_model_*.json"))
+        assert len(config_files) == 1
+        with config_files[0].open() as f:
+            summary = json.load(f)["summary"]
+        workers = {}
+        for line in summary:
+            matched = re.match(r"(\w+)\(ID:\d+\)\s*\(num_parallel_workers:\s*(\w+)", line)
+            assert matched
+            workers[matched.group(1)] = matched.group(2)
+        assert int(workers["MapOp"]) > 1
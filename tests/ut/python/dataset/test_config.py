@@ -489,6 +489,30 @@ def test_config_bool_type_error():
     # set_multiprocessing_timeout_interval will raise TypeError if input is a boolean
     config_error_func(ds.config.set_multiprocessing_timeout_interval, True, TypeError, "interval isn't of type int")
 
+    # set_enable_mindrecord_mmap will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_mindrecord_mmap, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_lock_free_queue will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_lock_free_queue, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_jpeg_scaled_decode will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_jpeg_scaled_decode, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_autotune_cost_model will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_autotune_cost_model, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_seekable_shuffle will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_seekable_shuffle, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_row_tracing will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_row_tracing, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_row_block will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_row_block, 1, TypeError, "enable must be of type bool")
+
+    # set_enable_csv_split will raise TypeError if input is not a boolean
+    config_error_func(ds.config.set_enable_csv_split, 1, TypeError, "enable must be of type bool")
+
 
 if __name__ == '__main__':
     test_basic()
@@ -12,6 +12,8 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 # ==============================================================================
+import pathlib
+import tempfile
 import numpy as np
 import mindspore.dataset as ds
 import mindspore.dataset.vision as vision
@@ -598,6 +600,32 @@ def test_coco_case_exception():
         assert "map operation: [PyFunc] failed. The corresponding data files" in str(e)
 
 
+def test_coco_source_snapshot(tmp_path):
+    """
+    Feature: CocoDataset
+    Description: Test CocoDataset with set_source_snapshot_dir, which saves the parsed annotations and restores them
+        in the next launch instead of parsing the annotation file
+    Expectation: The dataset and the class indexing restored from the snapshot are the same as the parsed ones
+    """
+    original_snapshot_dir = ds.config.get_source_snapshot_dir()
+    snapshot_dir = tmp_path / "snapshot"
+    ds.config.set_source_snapshot_dir(str(snapshot_dir))
+
+    def get_rows():
+        data1 = ds.CocoDataset(DATA_DIR, annotation_file=ANNOTATION_FILE, task="Detection", decode=False,
+                               shuffle=False)
+        rows = [(data["bbox"].tolist(), data["category_id"].tolist(), data["iscrowd"].tolist())
+                for data in data1.create_dict_iterator(num_epochs=1, output_numpy=True)]
+        return rows, data1.get_class_indexing()
+
+    rows, class_index = get_rows()
+    assert len(rows) == 6
+    assert len(list(snapshot_dir.glob("CocoOp_*.msgpack"))) == 1
+    assert get_rows() == (rows, class_index)
+
+    ds.config.set_source_snapshot_dir(original_snapshot_dir)
+
+
 if __name__ == '__main__':
     test_coco_captioning()
     test_coco_detection()
@@ -611,3 +639,5 @@ if __name__ == '__main__':
     test_coco_case_2()
     test_coco_case_3()
     test_coco_case_exception()
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        test_coco_source_snapshot(pathlib.Path(tmp_dir))
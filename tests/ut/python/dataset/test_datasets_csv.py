@@ -12,9 +12,13 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 # ==============================================================================
+import os
+
 import numpy as np
 import pytest
+import mindspore.common.dtype as mstype
 import mindspore.dataset as ds
+import mindspore.dataset.transforms as data_trans
 
 DATA_FILE = '../data/dataset/testCSV/1.csv'
 
@@ -384,6 +388,167 @@ def test_csv_dataset_duplicate_columns():
     assert "column_names" in str(info.value)
 
 
+def test_csv_dataset_quoted_rows(tmp_path):
+    """
+    Feature: CSVDataset
+    Description: Test CSVDataset with several workers on a file with quoted fields containing delimiters and
+        line breaks, with and without shards
+    Expectation: Every row is read exactly once with the correct fields
+    """
+    num_rows = 3000
+    csv_file = str(tmp_path / "quoted.csv")
+    with open(csv_file, "w") as f:
+        f.write("id,text,value\n")
+        for i in range(num_rows):
+            if i % 3 == 0:
+                f.write('{},"quoted, field\nwith ""line"" {}",{}\n'.format(i, i, i * 2))
+            else:
+                f.write("{},plain text of the row {},{}\n".format(i, i, i * 2))
+
+    def expected_text(i):
+        if i % 3 == 0:
+            return 'quoted, field\nwith "line" {}'.format(i)
+        return "plain text of the row {}".format(i)
+
+    data = ds.CSVDataset(csv_file, column_defaults=[0, "", 0], num_parallel_workers=4, shuffle=False)
+    assert data.get_dataset_size() == num_rows
+    ids = []
+    for item in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+        i = int(item["id"])
+        assert item["text"].item() == expected_text(i)
+        assert int(item["value"]) == i * 2
+        ids.append(i)
+    assert sorted(ids) == list(range(num_rows))
+
+    ids = []
+    for shard_id in range(2):
+        data = ds.CSVDataset(csv_file, column_defaults=[0, "", 0], num_parallel_workers=4, shuffle=False,
+                             num_shards=2, shard_id=shard_id)
+        ids.extend(int(item["id"]) for item in data.create_dict_iterator(num_epochs=1, output_numpy=True))
+    assert sorted(ids) == list(range(num_rows))
+
+
+def test_csv_dataset_split_order(tmp_path):
+    """
+    Feature: CSVDataset
+    Description: Test CSVDataset with several workers and shuffle=False on a single file larger than the split size,
+        with the split of large files disabled by default and enabled
+    Expectation: By default the rows are returned in file order, with the split every row is read exactly once
+    """
+    num_rows = 90000
+    csv_file = str(tmp_path / "large.csv")
+    text = "x" * 200
+    with open(csv_file, "w") as f:
+        for i in range(num_rows):
+            f.write("{},{}\n".format(i, text))
+    assert os.path.getsize(csv_file) > 16 * 1024 * 1024
+
+    def read_ids():
+        data = ds.CSVDataset(csv_file, column_defaults=[0, ""], column_names=["id", "text"], num_parallel_workers=4,
+                             shuffle=False)
+        return [int(item["id"]) for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+
+    original_csv_split = ds.config.get_enable_csv_split()
+    assert not original_csv_split
+    assert read_ids() == list(range(num_rows))
+
+    ds.config.set_enable_csv_split(True)
+    assert sorted(read_ids()) == list(range(num_rows))
+    ds.config.set_enable_csv_split(original_csv_split)
+
+
+def test_csv_dataset_row_block(tmp_path):
+    """
+    Feature: CSVDataset
+    Description: Test CSVDataset followed by elementwise map operations and batch, where the rows are carried as
+        row blocks, with a remainder batch and with num_samples cutting a row block
+    Expectation: The batches are the same as the batches of plain rows
+    """
+    original_row_block = ds.config.get_enable_row_block()
+    ds.config.set_enable_row_block(True)
+    num_rows = 1000
+    csv_file = str(tmp_path / "tabular.csv")
+    with open(csv_file, "w") as f:
+        f.write("id,count,ratio,name\n")
+        for i in range(num_rows):
+            f.write("{},{},{},name_{}\n".format(i, i % 7, i / 4, i))
+
+    def check(num_samples, batch_size, drop_remainder):
+        data = ds.CSVDataset(csv_file, column_defaults=[0, 0, 0.0, ""], num_samples=num_samples,
+                             num_parallel_workers=1, shuffle=False)
+        data = data.map(operations=[data_trans.TypeCast(mstype.float32)], input_columns=["count"])
+        data = data.map(operations=[data_trans.Duplicate()], input_columns=["id"], output_columns=["id", "id2"])
+        data = data.batch(batch_size, drop_remainder=drop_remainder)
+        expected_rows = num_samples if num_samples else num_rows
+        begin = 0
+        for item in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+            end = min(begin + batch_size, expected_rows)
+            ids = np.arange(begin, end)
+            np.testing.assert_array_equal(item["id"], ids.astype(np.int32))
+            np.testing.assert_array_equal(item["id2"], ids.astype(np.int32))
+            np.testing.assert_array_equal(item["count"], (ids % 7).astype(np.float32))
+            assert item["count"].dtype == np.float32
+            np.testing.assert_array_equal(item["ratio"], (ids / 4).astype(np.float32))
+            np.testing.assert_array_equal(item["name"], np.array(["name_{}".format(i) for i in ids]))
+            begin = end
+        if drop_remainder:
+            expected_rows -= expected_rows % batch_size
+        assert begin == expected_rows
+
+    check(None, 64, False)
+    check(None, 64, True)
+    check(150, 64, False)
+    check(None, 1, False)
+    ds.config.set_enable_row_block(original_row_block)
+
+
+def test_csv_dataset_row_block_order(tmp_path):
+    """
+    Feature: CSVDataset
+    Description: Test the order of the rows of CSVDataset followed by an elementwise map operation and batch, read
+        from several files by one worker and by several workers, with row blocks enabled and disabled
+    Expectation: Row blocks are only used when enabled, one worker reads the rows in the same order either way, and
+        several workers read the same rows with the rows of each file in order
+    """
+    num_files = 3
+    rows_per_file = 500
+    csv_files = []
+    for i in range(num_files):
+        csv_file = str(tmp_path / "tabular_{}.csv".format(i))
+        with open(csv_file, "w") as f:
+            f.write("id,count\n")
+            for j in range(i * rows_per_file, (i + 1) * rows_per_file):
+                f.write("{},{}\n".format(j, j % 7))
+        csv_files.append(csv_file)
+
+    def read_ids(num_workers, enable_row_block=None):
+        if enable_row_block is not None:
+            ds.config.set_enable_row_block(enable_row_block)
+        data = ds.CSVDataset(csv_files, column_defaults=[0, 0], num_parallel_workers=num_workers, shuffle=False)
+        data = data.map(operations=[data_trans.TypeCast(mstype.float32)], input_columns=["count"])
+        data = data.batch(32)
+        ids = []
+        for item in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+            np.testing.assert_array_equal(item["count"], (item["id"] % 7).astype(np.float32))
+            ids.extend(item["id"].tolist())
+        return ids
+
+    original_row_block = ds.config.get_enable_row_block()
+    assert not original_row_block
+    num_workers = 4
+    # row blocks are disabled by default, which keeps the order of several workers
+    default_ids = read_ids(num_workers)
+    assert default_ids == read_ids(num_workers, False)
+    assert read_ids(1, True) == read_ids(1, False)
+
+    block_ids = read_ids(num_workers, True)
+    assert sorted(block_ids) == sorted(default_ids)
+    for i in range(num_files):
+        file_ids = [j for j in block_ids if i * rows_per_file <= j < (i + 1) * rows_per_file]
+        assert file_ids == list(range(i * rows_per_file, (i + 1) * rows_per_file))
+    ds.config.set_enable_row_block(original_row_block)
+
+
 if __name__ == "__main__":
     test_csv_dataset_basic()
     test_csv_dataset_one_file()
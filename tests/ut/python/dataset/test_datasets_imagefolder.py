@@ -13,7 +13,9 @@
 # limitations under the License.
 # ==============================================================================
 import os
+import pathlib
 import shutil
+import tempfile
 import numpy as np
 import pytest
 import mindspore.dataset as ds
@@ -1011,6 +1013,41 @@ def test_imagefolder_decrypt():
         shutil.rmtree(DATA_DIR_3)
 
 
+def test_imagefolder_source_snapshot(tmp_path):
+    """
+    Feature: ImageFolderDataset
+    Description: Test ImageFolderDataset with set_source_snapshot_dir, which saves the file list of the folders and
+        restores it in the next launch until the folders change
+    Expectation: The dataset restored from the snapshot is the same as the walked one, and a new image is found
+    """
+    original_snapshot_dir = ds.config.get_source_snapshot_dir()
+    data_dir = str(tmp_path / "data")
+    snapshot_dir = tmp_path / "snapshot"
+    shutil.copytree(DATA_DIR, data_dir)
+    ds.config.set_source_snapshot_dir(str(snapshot_dir))
+
+    def get_rows():
+        data = ds.ImageFolderDataset(data_dir, shuffle=False)
+        rows = [(item["label"].item(), item["image"].shape[0])
+                for item in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+        assert data.get_dataset_size() == len(rows)
+        return rows
+
+    rows = get_rows()
+    assert len(rows) == 44
+    assert len(list(snapshot_dir.glob("ImageFolderOp_*.msgpack"))) == 1
+    # the second launch restores the file list from the snapshot
+    assert get_rows() == rows
+
+    # adding an image changes the folder, so the snapshot is outdated and the folders are walked again
+    class_dir = os.path.join(data_dir, sorted(os.listdir(data_dir))[0])
+    image = sorted(os.listdir(class_dir))[0]
+    shutil.copyfile(os.path.join(class_dir, image), os.path.join(class_dir, "zz_" + image))
+    assert len(get_rows()) == 45
+
+    ds.config.set_source_snapshot_dir(original_snapshot_dir)
+
+
 if __name__ == '__main__':
     test_imagefolder_basic()
     logger.info('test_imagefolder_basic Ended.\n')
@@ -1098,3 +1135,7 @@ if __name__ == '__main__':
 
     test_imagefolder_decrypt()
     logger.info('test_imagefolder_decrypt Ended.\n')
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        test_imagefolder_source_snapshot(pathlib.Path(tmp_dir))
+    logger.info('test_imagefolder_source_snapshot Ended.\n')
@@ -379,6 +379,28 @@ def test_tfrecord_invalid_files():
     assert nonexistent_file in str(info.value)
 
 
+def test_tfrecord_corrupted_data(tmp_path):
+    """
+    Feature: TFRecordDataset
+    Description: Test TFRecordDataset with a file whose record data does not match its crc
+    Expectation: Error is raised as expected
+    """
+    logger.info("test_tfrecord_corrupted_data")
+    with open(FILES[0], "rb") as f:
+        content = bytearray(f.read())
+    # the header of the first record is 8 bytes of length and 4 bytes of crc, flip a byte of its data
+    content[20] ^= 0xFF
+    corrupted_file = str(tmp_path / "corrupted.data")
+    with open(corrupted_file, "wb") as f:
+        f.write(content)
+
+    data = ds.TFRecordDataset([corrupted_file], SCHEMA_FILE, shuffle=False)
+    with pytest.raises(RuntimeError) as info:
+        for _ in data.create_dict_iterator(num_epochs=1, output_numpy=True):
+            pass
+    assert "the data of record 0 is corrupted" in str(info.value)
+
+
 def test_tf_wrong_schema():
     """
     Feature: TFRecordDataset
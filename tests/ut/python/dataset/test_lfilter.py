@@ -74,6 +74,32 @@ def test_func_lfilter_pipeline():
         i += 1
 
 
+def test_lfilter_batched_multichannel():
+    """
+    Feature: LFilter op
+    Description: Test LFilter op on a batch of multichannel waveforms, more channels than one group of simd lanes
+    Expectation: Output is equal to the difference equation evaluated channel by channel
+    """
+    a_coeffs = [1.0, -0.5, 0.2]
+    b_coeffs = [0.3, 0.2, 0.1]
+    waveform = np.random.RandomState(0).uniform(-1, 1, (3, 5, 300)).astype(np.float64)
+    expect_waveform = np.zeros_like(waveform)
+    channels = waveform.reshape(-1, waveform.shape[-1])
+    expect_channels = expect_waveform.reshape(-1, waveform.shape[-1])
+    for c in range(channels.shape[0]):
+        for n in range(channels.shape[1]):
+            value = 0.0
+            for j in range(len(b_coeffs)):
+                if n >= j:
+                    value += b_coeffs[j] * channels[c, n - j]
+            for j in range(1, len(a_coeffs)):
+                if n >= j:
+                    value -= a_coeffs[j] * expect_channels[c, n - j]
+            expect_channels[c, n] = value
+    output = audio.LFilter(a_coeffs, b_coeffs, False)(waveform)
+    count_unequal_element(expect_waveform, output, 0.0001, 0.0001)
+
+
 def test_invalid_input_all():
     """
     Feature: LFilter op
@@ -107,5 +133,6 @@ def test_invalid_input_all():
 if __name__ == '__main__':
     test_func_lfilter_eager()
     test_func_lfilter_pipeline()
+    test_lfilter_batched_multichannel()
     test_invalid_input_all()
     
\ No newline at end of file
@@ -631,3 +631,42 @@ class TestMinddataProfilingManager:
 
         # Confirm dataset iterator file content
         self.confirm_dataset_iterator_file(dataset_iterator_file, 20)
+
+    def test_profiling_row_tracing(self, tmp_path):
+        """
+        Feature: MindData Profiling Manager
+        Description: Test row tracing of the latency of each op in pipeline (Generator -> Map -> Batch)
+        Expectation: Latency of the rows in each op is saved as a Chrome trace file
+        """
+        origin_row_tracing = ds.config.get_enable_row_tracing()
+        ds.config.set_enable_row_tracing(True)
+
+        source = [(np.array([x]),) for x in range(1024)]
+        data1 = ds.GeneratorDataset(source, ["data"])
+        data1 = data1.map(operations=[(lambda x: x + 1)], input_columns=["data"])
+        data1 = data1.batch(32)
+        num_iter = 0
+        for _ in data1.create_dict_iterator(num_epochs=1):
+            num_iter += 1
+        assert num_iter == 32
+
+        # Stop MindData Profiling and save output files to tmp_path
+        self.md_profiler.stop()
+        self.md_profiler.save(str(tmp_path))
+        ds.config.set_enable_row_tracing(origin_row_tracing)
+
+        row_tracing_file = str(tmp_path) + "/row_tracing_0.json"
+        with open(row_tracing_file) as file1:
+            data = json.load(file1)
+        op_latency = {op["op_type"]: op for op in data["otherData"]["op_latency"]}
+        assert set(op_latency.keys()) == {"GeneratorOp", "MapOp", "BatchOp"}
+        # Every row leaves the generator and map, and every batch leaves the batch op
+        assert op_latency["GeneratorOp"]["count"] == 1024
+        assert op_latency["MapOp"]["count"] == 1024
+        assert op_latency["BatchOp"]["count"] == 32
+        for op in op_latency.values():
+            assert op["p50_us"] <= op["p99_us"]
+        # One thread name for each op, and the sampled rows as complete events
+        thread_names = [event for event in data["traceEvents"] if event["name"] == "thread_name"]
+        assert len(thread_names) == 3
+        assert any(event["ph"] == "X" for event in data["traceEvents"])
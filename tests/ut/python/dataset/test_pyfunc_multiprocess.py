@@ -62,6 +62,31 @@ def test_pyfunc_multiproc_shrmem():
     ds.config.set_prefetch_size(prefetch_original)
 
 
+@pytest.mark.parametrize("shared_mem", (True, False))
+def test_pyfunc_multiproc_inplace_update(shared_mem):
+    """
+    Feature: PyFunc in Map op
+    Description: Test python_multiprocessing=True with a function which updates its input in place
+    Expectation: Input data is passed to the workers unchanged and the workers can write to it
+    """
+
+    def pyfunc(x):
+        x += 1
+        return x
+
+    mem_original = ds.config.get_enable_shared_mem()
+    ds.config.set_enable_shared_mem(shared_mem)
+
+    np_data = np.arange(64, dtype=np.int32).reshape((8, 8))
+    data1 = ds.NumpySlicesDataset(np_data, shuffle=False)
+    data1 = data1.map(pyfunc, num_parallel_workers=2, python_multiprocessing=True)
+
+    for i, data in enumerate(data1.create_tuple_iterator(num_epochs=1, output_numpy=True)):
+        np.testing.assert_equal(data[0], np_data[i] + 1)
+
+    ds.config.set_enable_shared_mem(mem_original)
+
+
 def create_dataset_pyop_multiproc(num_parallel_workers=None, max_rowsize=16, batch_size=32, repeat_size=1,
                                   num_samples=None):
     """
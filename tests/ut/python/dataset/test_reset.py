@@ -69,15 +69,27 @@ def create_imagenet_dataset(size):
     return data
 
 
-def create_minddata_dataset(size):
+def create_minddata_dataset(size, shuffle=False):
     columns_list = ["data"]
     num_readers = 2
     file_name = os.environ.get('PYTEST_CURRENT_TEST').split(':')[-1].split(' ')[0]
-    data = ds.MindDataset(file_name + "0", columns_list, num_readers, shuffle=False, num_samples=size)
+    if shuffle:
+        data = ds.MindDataset(file_name + "0", columns_list, num_readers, sampler=ds.RandomSampler(num_samples=size))
+    else:
+        data = ds.MindDataset(file_name + "0", columns_list, num_readers, shuffle=False, num_samples=size)
     data = data.rename(input_columns=["data"], output_columns="fake_data")
     return data
 
 
+def create_shuffled_cifar_dataset(size):
+    data_dir = "../data/dataset/testCifar100Data"
+    batch_size = 2
+    data = ds.Cifar100Dataset(data_dir, sampler=ds.RandomSampler(num_samples=size * batch_size))
+    data = data.project(["image", "fine_label"])
+    data = data.batch(batch_size)
+    return data
+
+
 def run_reset(data, num_epochs, failure_point: int, reset_step: int):
     size = data.get_dataset_size()
     expected = []
@@ -209,6 +221,50 @@ def test_reset_mindrecord(add_and_remove_cv_file):  # pylint: disable=unused-arg
             run_reset(data, num_epochs=num_epochs, failure_point=failure_point, reset_step=reset_step)
 
 
+def test_reset_seekable_shuffle_cifar():
+    """
+    Feature: Dataset recovery
+    Description: Test data pipeline reset on a shuffled Cifar100Dataset with enable_seekable_shuffle
+    Expectation: Same datasets after reset, RandomSampler starts from the order of the epoch of the reset step
+    """
+    original_seed = ds.config.get_seed()
+    original_seekable = ds.config.get_enable_seekable_shuffle()
+    ds.config.set_seed(1)
+    ds.config.set_enable_seekable_shuffle(True)
+
+    dataset_size = 5
+    num_epochs = 3
+    data = create_shuffled_cifar_dataset(size=dataset_size)
+    for failure_point in range(0, dataset_size * num_epochs, 4):
+        for reset_step in range(0, dataset_size * num_epochs, 3):
+            run_reset(data, num_epochs=num_epochs, failure_point=failure_point, reset_step=reset_step)
+
+    ds.config.set_seed(original_seed)
+    ds.config.set_enable_seekable_shuffle(original_seekable)
+
+
+def test_reset_seekable_shuffle_mindrecord(add_and_remove_cv_file):  # pylint: disable=unused-argument, redefined-outer-name
+    """
+    Feature: Dataset recovery
+    Description: Test data pipeline reset on a shuffled MindDataset with enable_seekable_shuffle
+    Expectation: Same datasets after reset, MindDataset starts from the order of the epoch of the reset step
+    """
+    original_seed = ds.config.get_seed()
+    original_seekable = ds.config.get_enable_seekable_shuffle()
+    ds.config.set_seed(1)
+    ds.config.set_enable_seekable_shuffle(True)
+
+    dataset_size = 10
+    num_epochs = 3
+    data = create_minddata_dataset(size=dataset_size, shuffle=True)
+    for failure_point in range(0, dataset_size * num_epochs, 7):
+        for reset_step in range(0, dataset_size * num_epochs, 4):
+            run_reset(data, num_epochs=num_epochs, failure_point=failure_point, reset_step=reset_step)
+
+    ds.config.set_seed(original_seed)
+    ds.config.set_enable_seekable_shuffle(original_seekable)
+
+
 def test_reset_np_error():
     """
     Feature: Dataset recovery
@@ -229,4 +285,6 @@ if __name__ == "__main__":
     test_reset_cifar2()
     test_reset_imagenet()
     test_reset_mindrecord(add_and_remove_cv_file)
+    test_reset_seekable_shuffle_cifar()
+    test_reset_seekable_shuffle_mindrecord(add_and_remove_cv_file)
     test_reset_np_error()
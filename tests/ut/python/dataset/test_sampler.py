@@ -354,6 +354,43 @@ def test_distributed_sampler_invalid_offset():
     assert "DistributedSampler: offset must be no more than num_shards(4)" in str(info.value)
 
 
+def test_distributed_sampler_seekable_shuffle():
+    """
+    Feature: DistributedSampler op
+    Description: Test shuffled DistributedSampler with enable_seekable_shuffle, which permutes the ids of each epoch
+        without building the shuffled list of all ids
+    Expectation: The shards of each epoch cover all the rows, and the order only depends on the seed
+    """
+    original_seed = ds.config.get_seed()
+    original_seekable = ds.config.get_enable_seekable_shuffle()
+    ds.config.set_seed(1234)
+    ds.config.set_enable_seekable_shuffle(True)
+
+    manifest_file = "../data/dataset/testManifestData/test5trainimgs.json"
+    map_ = {(172876, 0): 0, (54214, 0): 1, (54214, 1): 2, (173673, 0): 3, (64631, 1): 4}
+    num_shards = 2
+    num_epochs = 3
+
+    def get_shard_epochs(shard_id):
+        sampler = ds.DistributedSampler(num_shards=num_shards, shard_id=shard_id, shuffle=True)
+        data1 = ds.ManifestDataset(manifest_file, sampler=sampler)
+        epochs = []
+        itr = data1.create_dict_iterator(num_epochs=num_epochs, output_numpy=True)
+        for _ in range(num_epochs):
+            epochs.append([map_[(item["image"].shape[0], item["label"].item())] for item in itr])
+        return epochs
+
+    shards = [get_shard_epochs(shard_id) for shard_id in range(num_shards)]
+    for epoch in range(num_epochs):
+        # 5 rows are evenly distributed to 2 shards of 3 rows, the last one is padded with a duplicated row
+        assert [len(shard[epoch]) for shard in shards] == [3, 3]
+        assert set(shards[0][epoch] + shards[1][epoch]) == {0, 1, 2, 3, 4}
+    assert shards == [get_shard_epochs(shard_id) for shard_id in range(num_shards)]
+
+    ds.config.set_seed(original_seed)
+    ds.config.set_enable_seekable_shuffle(original_seekable)
+
+
 def test_sampler_list():
     """
     Feature: Sampler op
@@ -399,4 +436,5 @@ if __name__ == '__main__':
     test_sampler_chain()
     test_add_sampler_invalid_input()
     test_distributed_sampler_invalid_offset()
+    test_distributed_sampler_seekable_shuffle()
     test_sampler_list()
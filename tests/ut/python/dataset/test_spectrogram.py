@@ -84,6 +84,25 @@ def test_spectrogram_eager():
     count_unequal_element(out, result, 0.0001, 0.0001)
 
 
+def test_spectrogram_batched_rfft():
+    """
+    Feature: Mindspore eager mode normal testcase: spectrogram op.
+    Description: Input a batch of waveforms and compare with the power of numpy rfft of each frame.
+    Expectation: Success.
+    """
+    logger.info("test_spectrogram_batched_rfft")
+
+    n_fft = 16
+    hop_length = 4
+    wav = np.random.RandomState(0).uniform(-1, 1, (2, 3, 64)).astype(np.float32)
+    out = audio.Spectrogram(n_fft=n_fft, hop_length=hop_length, center=False)(wav)
+    window = 0.5 - 0.5 * np.cos(2 * np.pi * np.arange(n_fft) / n_fft)
+    n_frames = (wav.shape[-1] - n_fft) // hop_length + 1
+    frames = np.stack([wav[..., j * hop_length:j * hop_length + n_fft] for j in range(n_frames)], axis=-2)
+    expect = np.abs(np.fft.rfft(frames * window, axis=-1)) ** 2
+    count_unequal_element(np.swapaxes(expect, -1, -2).astype(np.float32), out, 0.0001, 0.0001)
+
+
 def test_spectrogram_window_hamming_padmode_constant():
     """
     Feature: Test spectrogram parameter: window, pad_mode.
@@ -421,6 +440,7 @@ def test_spectrogram_param():
 if __name__ == "__main__":
     test_spectrogram_pipeline()
     test_spectrogram_eager()
+    test_spectrogram_batched_rfft()
     test_spectrogram_window_hamming_padmode_constant()
     test_spectrogram_nfft_10_window_bartlett_padmode_edge()
     test_spectrogram_onsided_false()
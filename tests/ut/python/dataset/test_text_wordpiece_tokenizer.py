@@ -160,6 +160,33 @@ def test_wordpiece_tokenizer_with_offsets():
         check_wordpiece_tokenizer_with_offsets(**paras)
 
 
+def test_wordpiece_tokenizer_longest_match():
+    """
+    Feature: WordpieceTokenizer
+    Description: Test WordpieceTokenizer with subwords which are prefixes of each other, multi-byte chars and
+        words which are only partially split
+    Expectation: The longest subwords are taken and a word which can't be split is a single unknown token
+    """
+    vocab = text.Vocab.from_list(["un", "unaff", "##or", "##ordable", "##aff", "我最", "##喜", "##喜欢"])
+    words = ["unaffordable", "unaffx", "我最喜欢", "我最喜", "un"]
+    expect_str = [["unaff", "##ordable"], ["[UNK]"], ["我最", "##喜欢"], ["我最", "##喜"], ["un"]]
+    expected_offsets_start = [[0, 5], [0], [0, 6], [0, 6], [0]]
+    expected_offsets_limit = [[5, 12], [6], [6, 12], [6, 9], [2]]
+    dataset = ds.NumpySlicesDataset(words, column_names=["text"], shuffle=False)
+    tokenizer_op = text.WordpieceTokenizer(vocab=vocab, with_offsets=True)
+    dataset = dataset.map(operations=tokenizer_op, input_columns=['text'],
+                          output_columns=['token', 'offsets_start', 'offsets_limit'],
+                          column_order=['token', 'offsets_start', 'offsets_limit'])
+    count = 0
+    for i in dataset.create_dict_iterator(num_epochs=1, output_numpy=True):
+        np.testing.assert_array_equal(i['token'], expect_str[count])
+        np.testing.assert_array_equal(i['offsets_start'], expected_offsets_start[count])
+        np.testing.assert_array_equal(i['offsets_limit'], expected_offsets_limit[count])
+        count = count + 1
+    assert count == len(words)
+
+
 if __name__ == '__main__':
     test_wordpiece_tokenizer_default()
     test_wordpiece_tokenizer_with_offsets()
+    test_wordpiece_tokenizer_longest_match()
@@ -14,6 +14,7 @@
 # ============================================================================
 """test mindrecord base"""
 import os
+import sqlite3
 import uuid
 import pytest
 import numpy as np
@@ -219,6 +220,47 @@ def test_cv_file_append_writer_absolute_path():
     remove_multi_files(mindrecord_file_name, 4)
 
 
+def test_cv_file_append_writer_incremental_index():
+    """appending rows twice keeps the indexed rows and indexes the new ones."""
+    mindrecord_file_name = os.environ.get('PYTEST_CURRENT_TEST').split(':')[-1].split(' ')[0]
+    remove_one_file(mindrecord_file_name)
+    remove_one_file(mindrecord_file_name + ".db")
+    remove_one_file(mindrecord_file_name + ".idx")
+    data = get_data("../data/mindrecord/testImageNetData/")
+    cv_schema_json = {"file_name": {"type": "string"},
+                      "label": {"type": "int64"}, "data": {"type": "bytes"}}
+    writer = FileWriter(mindrecord_file_name, 1)
+    writer.add_schema(cv_schema_json, "img_schema")
+    writer.add_index(["file_name", "label"])
+    writer.write_raw_data(data[0:4])
+    writer.commit()
+    for start, end in ((4, 7), (7, 10)):
+        write_append = FileWriter.open_for_append(mindrecord_file_name)
+        write_append.write_raw_data(data[start:end])
+        write_append.commit()
+
+    conn = sqlite3.connect(mindrecord_file_name + ".db")
+    rows = conn.execute("SELECT ROW_ID, label_0 FROM INDEXES ORDER BY ROW_ID;").fetchall()
+    conn.close()
+    assert rows == [(i, x["label"]) for i, x in enumerate(data[0:10])]
+
+    reader = FileReader(mindrecord_file_name)
+    labels = [x["label"] for x in reader.get_next()]
+    assert labels == [x["label"] for x in data[0:10]]
+    reader.close()
+
+    reader = MindPage(mindrecord_file_name)
+    assert reader.set_category_field("label") == SUCCESS
+    for x in (data[0], data[5], data[9]):
+        row = reader.read_at_page_by_name(str(x["label"]), 0, 1)
+        assert len(row) == 1
+        assert row[0]["file_name"] == x["file_name"]
+
+    remove_one_file(mindrecord_file_name)
+    remove_one_file(mindrecord_file_name + ".db")
+    remove_one_file(mindrecord_file_name + ".idx")
+
+
 def test_cv_file_writer_loop_and_read():
     """tutorial for cv dataset loop writer."""
     mindrecord_file_name = os.environ.get('PYTEST_CURRENT_TEST').split(':')[-1].split(' ')[0]